@@ -12,10 +12,11 @@
 //        CREATED:  9/30/2014
 //
 //    DESCRIPTION:  This is the main program file.  This contains the CodeBreaker
-//                  main function which utilizes states to get to the different
-//                  parts of the game.  This also contains the two special helper
-//                  functions that generate the secret code and compares a user
-//                  input with the secret code.
+//                  main function, which takes the events the key, UART and
+//                  timer ISRs post, passes them to the game library in game.c
+//                  and carries out what each step of the game asks for on the
+//                  board.  It idles, rather than polls, while the queue is
+//                  empty.
 //
 //*****************************************************************************
 //*****************************************************************************
@@ -25,6 +26,7 @@
 //                    Include Files
 //*****************************************************************************
 #include <stdio.h>                    // for NULL
+#include <string.h>                   // for strcmp, memcpy
 #include <sys/alt_irq.h>              // for irq support function
 #include "system.h"                   // for QSYS defines
 #include "nios_std_types.h"           // for standard embedded types
@@ -32,158 +34,354 @@
 #include "display.h"                  // for display functions
 #include "pio.h"                      // for pio funcitons
 #include "timer.h"
+#include "score.h"                    // for the table driven scoring engine
+#include "solver.h"                   // for the auto-solver
+#include "rng.h"                      // for the random number generator
+#include "advisor.h"                  // for the hint advisor
+#include "game.h"                     // for the game state machine
+#include "event.h"                    // for the event queue
+#include "outq.h"                     // for the output queue
 
 
 //*****************************************************************************
 //                    Define Symbolic Constants
 //*****************************************************************************
-#define NUM_OF_COLORS_INCODE  4
+// build with GAME_FIXED_SEED defined to replay the same secret codes
+#define GAME_DEFAULT_SEED 0x5EED
 
-#define eGAME_IDLE      0
-#define eINIT_GAME      1
-#define eREQUEST_GUESS  2
-#define eWAITING_4_USER 3
-#define eWIN_GAME       4
-#define eLOSE_GAME      5
-#define eWAIT_4_KEY1    6
-#define eEND_GAME       7
+#define STATS_LINE_MAX    80          // the longest line of the statistics
+#define STATS_HISTOGRAM_MAX (24 + 18 * UART_STATS_BUCKETS)
 
-#define KEY1 1
-#define KEY2 2
+// lets a host harness see every pass through the state machine
+#ifndef GAME_STATE_HOOK
+#define GAME_STATE_HOOK(state)
+#endif
 
-#define SECOND  1
-#define HALFSEC 2
-#define QUARTER 3
-
-#define TIME_OUT_PERIOD 60
-//*****************************************************************************
-//                    Define Global Variables
-//*****************************************************************************
-uint8  compared_answer[NUM_OF_COLORS_INCODE + 1] = "----";
+// a queued EventItem line is copied whole into a GameEvent
+typedef char mainEventLineFitsGame[(EVENT_LINE_MAX == GAME_LINE_MAX) ?
+                                   1 : -1];
 
+#if(DEBUG_ENABLE)
 //----------------------------------------------------------------------------
-// NAME: Generate Secret Code
+// NAME: Verify Score Engine
 //
 // DESCRIPTION:
-//    This function creates a random secret code using the random function
-//    to output a value between 0 and 5 and setting the color based on the
-//    output number.  There is a check routine to see if the random function
-//    outputs a number already stored in the code
+//    This function checks the table driven scoring engine against
+//    game_ScoreGuess for every pair of distinct-color codes.  Both the number
+//    of exact matches and the rendered hint string must agree.
 //
 // INPUT:
-//   code - the value that the code is to be sent in
+//   none
 //
 // OUTPUT:
 //   none
 //
 // RETURN:
-//   none
+//   the number of pairs that did not match
 //----------------------------------------------------------------------------
-void GenerateSecretCode(uint8* code)
+int VerifyScoreEngine(void)
 {
-  int i = 0;
-  int j = 0;
-  int same_value = FALSE;
-  int random_value = 0;
-  uint8 rand_code[NUM_OF_COLORS_INCODE + 1] = "----";
-  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  int guess;
+  int secret;
+  int mismatches = 0;
+  uint8 guess_code[NUM_OF_COLORS_INCODE + 1];
+  uint8 secret_code[NUM_OF_COLORS_INCODE + 1];
+  uint8 hint[NUM_OF_COLORS_INCODE + 1];
+
+  for (guess = 0; guess < SCORE_NUM_SECRETS; guess++)
   {
-    random_value = rand()%6;
-    for (j = 0; j < NUM_OF_COLORS_INCODE; j++)
+    score_UnpackCode(score_IndexToCode(guess), guess_code);
+    for (secret = 0; secret < SCORE_NUM_SECRETS; secret++)
     {
-      if (rand_code[j] == random_value)
+      GameHint compared;
+      int color = 0;
+      int i;
+      uint8 feedback = SCORE_LOOKUP(guess, secret);
+
+      score_UnpackCode(score_IndexToCode(secret), secret_code);
+      compared = game_ScoreGuess(guess_code, secret_code);
+      for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
       {
-        same_value = TRUE;
+        color += (compared.text[i] == 'C');
+      }
+      score_RenderHint(score_IndexToCode(guess), score_IndexToCode(secret),
+                       hint);
+
+      if ((feedback != SCORE_FEEDBACK(compared.exact, color)) ||
+          (0 != strcmp((char*)hint, (char*)compared.text)))
+      {
+        mismatches++;
       }
     }
-    if (!same_value)
-    {
-      rand_code[i] = random_value;
-    }
-    else
+  }
+  return mismatches;
+}
+#endif
+
+#if(UART_STATS_ENABLE)
+//----------------------------------------------------------------------------
+// NAME: Show Histogram
+//
+// DESCRIPTION:
+//    This function shows the buckets of a log2 histogram that are not
+//    empty, each as the power of two its values are under and its count,
+//    or none.
+//
+// INPUT:
+//   title - what the histogram counts
+//   histogram - the UART_STATS_BUCKETS buckets
+//
+// OUTPUT:
+//   queue - the output of the step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void ShowHistogram(OutQueue* queue, const char* title,
+                   const uint32* histogram)
+{
+  char* line = outq_Reserve(queue, STATS_HISTOGRAM_MAX);
+  int length;
+  int n;
+
+  length = sprintf(line, "%-20s", title);
+  for (n = 0; n < UART_STATS_BUCKETS; n++)
+  {
+    if (histogram[n] != 0)
     {
-      i--;
+      length += sprintf(&line[length], " <2^%d:%lu", n,
+                        (unsigned long)histogram[n]);
     }
-    same_value = FALSE;
   }
-  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  if (length == 20)
+  {
+    length += sprintf(&line[length], " none");
+  }
+  line[length++] = '\n';
+  outq_Commit(queue, (uint32)length);
+}
+#endif
+
+//----------------------------------------------------------------------------
+// NAME: Show Stats
+//
+// DESCRIPTION:
+//    This function shows the statistics of the board's drivers for the
+//    STATS menu option, with the UART's counters and histograms when the
+//    driver keeps them.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   queue - the output of the step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void ShowStats(OutQueue* queue)
+{
+  char* line = outq_Reserve(queue, STATS_LINE_MAX);
+  #if(UART_STATS_ENABLE)
+    UartStats stats;
+  #endif
+
+  sprintf(line, "\nUART bytes dropped:  %lu\nEvents dropped:      %lu\n",
+          (unsigned long)uart_TxDropped(), (unsigned long)event_Dropped());
+  outq_Commit(queue, (uint32)strlen(line));
+
+  #if(UART_STATS_ENABLE)
+    uart_GetStats(&stats);
+    line = outq_Reserve(queue, 3 * STATS_LINE_MAX);
+    sprintf(line, "UART bytes sent:     %lu\nUART bytes received: %lu\n"
+            "Characters ignored:  %lu\nReceive stalls:      %lu\n",
+            (unsigned long)stats.tx_bytes, (unsigned long)stats.rx_bytes,
+            (unsigned long)stats.rx_ignored, (unsigned long)stats.rx_stalls);
+    outq_Commit(queue, (uint32)strlen(line));
+
+    line = outq_Reserve(queue, 3 * STATS_LINE_MAX);
+    sprintf(line, "Writes that waited:  %lu (%lu tries, at most %lu; "
+            "%lu cycles, at most %lu)\n"
+            "ISR calls:           %lu (%lu cycles, at most %lu)\n",
+            (unsigned long)stats.tx_waits, (unsigned long)stats.tx_spins,
+            (unsigned long)stats.tx_spin_max,
+            (unsigned long)stats.tx_stall_cycles,
+            (unsigned long)stats.tx_stall_max,
+            (unsigned long)stats.isr_calls, (unsigned long)stats.isr_cycles,
+            (unsigned long)stats.isr_max);
+    outq_Commit(queue, (uint32)strlen(line));
+
+    ShowHistogram(queue, "ISR cycles:", stats.isr_histogram);
+    ShowHistogram(queue, "Tries of a wait:", stats.spin_histogram);
+  #endif
+}
+
+//----------------------------------------------------------------------------
+// NAME: Send Output
+//
+// DESCRIPTION:
+//    This function is the sink of the output queue: it hands the
+//    descriptors to the UART, which copies their text into its transmit
+//    ring.
+//
+// INPUT:
+//   descs - the descriptors
+//   count - the number of descriptors
+//   context - not used
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void SendOutput(const OutDesc* descs, uint32 count, void* context)
+{
+  (void)context;
+  uart_WriteVector(descs, count);
+}
+
+//----------------------------------------------------------------------------
+// NAME: Show Output
+//
+// DESCRIPTION:
+//    This function carries out the output of one step of the game on the
+//    board: timer and key actions go to their drivers, and the messages
+//    are queued by the display functions and sent together at the end.
+//
+// INPUT:
+//   session - the session that was stepped
+//   output - the output of the step
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void ShowOutput(const GameSession* session, const GameOutput* output)
+{
+  static OutQueue queue;
+  int i;
+
+  outq_Init(&queue, SendOutput, NULL);
+
+  for (i = 0; i < output->count; i++)
   {
-    switch(rand_code[i])
+    const GameOutputItem* item = &output->items[i];
+    switch (item->type)
     {
-    case 0:
-      code[i] = 'G';
+    case GAME_OUT_END:
+      timer_DisableTimerInterrupt();
       break;
-    case 1:
-      code[i] = 'B';
+    case GAME_OUT_TIMER_STOP:
+      timer_StopTimer();
       break;
-    case 2:
-      code[i] = 'R';
+    case GAME_OUT_TIMER_START:
+      timer_StartTimer(item->value);
       break;
-    case 3:
-      code[i] = 'O';
+    case GAME_OUT_TIMER_LIMIT:
+      timer_SetTimeLimit(item->value);
       break;
-    case 4:
-      code[i] = 'Y';
+    case GAME_OUT_CLEAR_KEY:
+      pio_ClearKeyPressedFlag(item->value);
       break;
-    case 5:
-      code[i] = 'W';
+    case GAME_OUT_STATS:
+      ShowStats(&queue);
       break;
-    }
+    } /* switch */
+    display_QueueOutput(&queue, session, item);
   }
+  outq_Drain(&queue);
 }
 
-
 //----------------------------------------------------------------------------
-// NAME: Compare Code
+// NAME: Wait For Event
 //
 // DESCRIPTION:
-//    This function compares the secret code with the user input.
+//    This function takes the next event from the ISRs, idling until there
+//    is one.  The UART's EVENT_RX only says characters came; they are made
+//    into a line here, outside the ISR, and a line RETURN ended is passed
+//    on as EVENT_LINE.  A line typed ahead is taken before waiting.
 //
 // INPUT:
-//   guess - the user's guess
-//   answer - the secret code
+//   none
 //
 // OUTPUT:
-//   none
+//   queued - the event
 //
 // RETURN:
-//   none
+//   the number of times the queue was found empty
 //----------------------------------------------------------------------------
-int compareCode(uint8* guess, uint8* answer)
+uint32 WaitForEvent(EventItem* queued)
 {
-  int i;
-  int j;
-  int match_counter = 0;
-  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  uint32 idle_spins = 0;
+
+  while (!uart_GetLine(queued->line))
   {
-    compared_answer[i] = '-';
+    idle_spins += event_Wait(queued);
+    if (queued->type != EVENT_RX)
+    {
+      return idle_spins;
+    }
   }
-  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  queued->type = EVENT_LINE;
+  return idle_spins;
+}
+
+//----------------------------------------------------------------------------
+// NAME: Get Game Event
+//
+// DESCRIPTION:
+//    This function turns an event from the ISRs into an event for the
+//    game.  A line only counts at the main menu and KEY2 only during a
+//    guess, where it enters what has been typed.  A key press or timeout
+//    whose flag was cleared after it was posted, e.g. by a new guess, is
+//    stale and is passed on as a tick.
+//
+// INPUT:
+//   queued - the event from the queue
+//   state - the state of the game
+//
+// OUTPUT:
+//   event - the event for game_Step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void GetGameEvent(const EventItem* queued, uint8 state, GameEvent* event)
+{
+  event->type = GAME_EVENT_TICK;
+  switch (queued->type)
   {
-    for (j = 0; j < NUM_OF_COLORS_INCODE; j++)
+  case EVENT_KEY1:
+    if (pio_IsKey1Pressed())
     {
-      if ((guess[i] == answer[j]) && (i == j))
-      {
-        compared_answer[i] = 'P';
-        match_counter++;
-      }
-      else if ((guess[i] == answer[j]) && (i != j))
-      {
-        if (compared_answer[i] != 'P')
-        {
-          compared_answer[i] = 'C';
-        }
-      }
-      else
-      {
-        if ((compared_answer[i] != 'P') && (compared_answer[i] != 'C'))
-        {
-          compared_answer[i] = '-';
-        }
-      }
+      event->type = GAME_EVENT_KEY1;
     }
-  }
-  return match_counter;
+    break;
+  case EVENT_KEY2:
+    if ((state == eWAITING_4_USER) && pio_IsKey2Pressed())
+    {
+      uart_GetUserInput(&event->line[0], GAME_LINE_MAX + 1);
+      event->type = GAME_EVENT_LINE;
+    }
+    break;
+  case EVENT_LINE:
+    if (state == eGAME_IDLE)
+    {
+      memcpy(event->line, queued->line, EVENT_LINE_MAX + 1);
+      uart_ClearUserInput();
+      event->type = GAME_EVENT_LINE;
+    }
+    break;
+  case EVENT_TIMEOUT:
+    if (timer_IsTimerExpired())
+    {
+      event->type = GAME_EVENT_TIMEOUT;
+    }
+    break;
+  } /* switch */
 }
 
 int main(void)
@@ -199,157 +397,53 @@ int main(void)
   timer_EnableTimerInterrupt();
 
   uint32 game_done = FALSE;
-  uint8  secret_code[NUM_OF_COLORS_INCODE + 1] = "----";
-  uint8  user_input[NUM_OF_COLORS_INCODE + 1] = "----";
-
-  uint8 sPresentState = eGAME_IDLE;
-
-  srand(time(NULL));
+  uint32 idle_spins = 0;
+
+  GameSession session;
+  GameEvent   event;
+  GameOutput  output;
+  EventItem   queued;
+
+  score_Init();
+  solver_Init();
+  advisor_Init();
+  #if(DEBUG_ENABLE)
+    if (0 != VerifyScoreEngine())
+    {
+      display_DisplayMsg("Score engine does not match game_ScoreGuess\n");
+    }
+  #endif
+
+  #ifdef GAME_FIXED_SEED
+    game_Init(&session, GAME_FIXED_SEED, &output);
+  #else
+    game_Init(&session, GAME_DEFAULT_SEED, &output);
+  #endif
+  ShowOutput(&session, &output);
   do
   {
-    switch (sPresentState)
-    {
-    case eGAME_IDLE:
-      display_DisplayWelcomeMsg();
-      timer_StopTimer();
-      while (!uart_IsUserInputReady());
-      {
-        uart_GetUserInput(&user_input[0], NUM_OF_COLORS_INCODE);
+    GAME_STATE_HOOK(session.state);
 
-        if (0 == strcmp((char*)user_input, "HELP"))
-        {
-          display_DisplayHelpMsg();
-          sPresentState = eWAIT_4_KEY1;
-        }/* if */
-
-        else if (0 == strcmp(user_input, "PLAY"))
-        {
-          sPresentState = eINIT_GAME;
-        }
-
-        else if (0 == strcmp(user_input, "EXIT"))
-        {
-          sPresentState = eEND_GAME;
-        }
+    // the states that wait for the player take the next event from the
+    // ISRs, idling until there is one; the others run straight away
+    event.type = GAME_EVENT_NONE;
+    if (game_IsWaiting(session.state))
+    {
+      idle_spins = WaitForEvent(&queued);
+      GetGameEvent(&queued, session.state, &event);
 
-        else
+      // how long the player takes to type varies from game to game, so
+      // it is mixed into the generator unless a fixed seed was asked for
+      #ifndef GAME_FIXED_SEED
+        if ((session.state == eGAME_IDLE) && (event.type == GAME_EVENT_LINE))
         {
-          display_DisplayMsg("\nIncorrect Response\n\n");
+          rng_Seed(&session.rng, rng_Next(&session.rng) ^ idle_spins);
         }
-        uart_ClearUserInput();
-      }
-     break;
-
-
-
-    case eINIT_GAME:
-        pio_ClearKeyPressedFlag(KEY1);
-        pio_ClearKeyPressedFlag(KEY2);
-
-        timer_SetTimeLimit(TIME_OUT_PERIOD);
-
-        GenerateSecretCode(&secret_code[0]);
-
-        #if(DEBUG_ENABLE)
-          display_DisplayMsg("Secret Code = ");
-          display_DisplayMsg(secret_code);
-          display_DisplayMsg("\n");
-        #endif
-
-        sPresentState = eREQUEST_GUESS;
-        break;
-
-
-
-      case eREQUEST_GUESS:
-        pio_ClearKeyPressedFlag(KEY1);
-        pio_ClearKeyPressedFlag(KEY2);
-        timer_StartTimer(SECOND);
-        display_DisplayMsg("\n\nEnter Your guess:");
-        sPresentState = eWAITING_4_USER;
-        break;
-
-
-
-      case eWAITING_4_USER:
-        // if KEY1 pressed then restart game
-        if (pio_IsKey1Pressed())
-        {
-          timer_StopTimer();
-          sPresentState = eGAME_IDLE;
-        } /* if */
-
-        // if KEY2 pressed then check user_input
-        if (pio_IsKey2Pressed())
-        {
-          timer_StopTimer();
-          uart_GetUserInput(&user_input[0], NUM_OF_COLORS_INCODE);
-
-          if (NUM_OF_COLORS_INCODE == compareCode(user_input, secret_code))
-          {
-            sPresentState = eWIN_GAME;
-          }  /*if correct guess*/
-
-          else
-          {
-            display_DisplayMsg("\n\nThat guess is incorrect.  Your guess was:  ");
-            display_DisplayMsg(user_input);
-            display_DisplayMsg("\nThis is the hint from your guess:  ");
-            display_DisplayMsg(compared_answer);
-            timer_SetTimeLimit(TIME_OUT_PERIOD);
-            sPresentState = eREQUEST_GUESS;
-          }  /*else bad guess*/
-
-        } /* if */
-
-        // if timer expired then user loses game
-        if (timer_IsTimerExpired() )
-        {
-          timer_StopTimer();
-          pio_ClearKeyPressedFlag(KEY1);
-          sPresentState = eLOSE_GAME;
-        } /* if timer expired */
-        break;
-
-
-
-      case eWIN_GAME:
-        timer_StartTimer(QUARTER);
-        display_DisplayWinnerMsg();
-
-        sPresentState = eWAIT_4_KEY1;
-        break;
-
-
-
-      case eLOSE_GAME:
-        display_DisplayLoserMsg();
-        timer_StartTimer(HALFSEC);
-        display_DisplayMsg("The secret code was ");
-        display_DisplayMsg((char*)secret_code);
-        sPresentState = eWAIT_4_KEY1;
-        break;
-
-
-
-      case eWAIT_4_KEY1:
-        pio_ClearKeyPressedFlag(KEY1);
-        display_DisplayMsg("\n\nPress KEY1 to return to the main menu.\n");
-
-        while (!pio_IsKey1Pressed());
-        sPresentState = eGAME_IDLE;
-        break;
-
-
-
-      case eEND_GAME:
-        timer_StopTimer();
-        timer_DisableTimerInterrupt();
+      #endif
+    }
 
-        display_DisplayEndMsg();
-        game_done = TRUE;
-        break;
-    } /* switch */
+    game_done = !game_Step(&session, &event, &output);
+    ShowOutput(&session, &output);
 
   } while (!game_done);
 
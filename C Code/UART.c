@@ -14,6 +14,34 @@
 //
 // DESCRIPTION: This file contains the functions that work the UART
 //
+//              Output goes through a transmit ring.  uart_WriteVector
+//              copies the text of a list of descriptors straight in with
+//              the interrupts masked, and uart_Write that of one; each then
+//              fills the write FIFO as far as it has room and sets WE for
+//              the rest.  The ISR moves more of the ring into the FIFO each
+//              time WSPACE opens and clears WE once the ring is empty.
+//              What happens when the ring is full is the transmit policy:
+//              BLOCK waits until the bytes fit, DROP loses the whole write,
+//              and PARTIAL keeps what fits.
+//
+//              Input goes through a receive ring shared by the ISR and the
+//              main loop without a lock: the ISR only moves its tail and the
+//              main loop only its head, each publishing with a release store
+//              that the other reads with an acquire load.  The ISR copies
+//              what the read FIFO holds into the ring and posts EVENT_RX;
+//              the main loop feeds the ring to the line discipline in
+//              uart_GetLine, which edits, echoes and ends the lines, so the
+//              ISR does the same small work for every character.  When the
+//              ring is full the ISR turns RE off and leaves the rest in the
+//              FIFO, so the JTAG host waits instead of a character being
+//              lost, and uart_GetLine turns it back on once it has made
+//              room.
+//
+//              With UART_STATS_ENABLE the driver keeps counters for the
+//              STATS command.  They are added once per burst, per ISR call
+//              or per write that waits, never per byte, and the ISR is timed
+//              from entry to exit with UART_CYCLES.
+//
 //*****************************************************************************
 //*****************************************************************************
 
@@ -21,11 +49,15 @@
 //                         Include Files
 //*****************************************************************************
 #include <stdio.h>                    // for NULL
+#include <string.h>                   // for strlen
+#include <io.h>                       // for IORD and IOWR
 #include <sys/alt_irq.h>              // for irq support function
 #include "system.h"                   // for QSYS defines
-#include "uart.h"                   // for QSYS defines
+#include "UART.h"                     // for UART definitions
 #include "nios_std_types.h"           // for standard embedded types
 #include "pio.h"
+#include "event.h"                    // for the event queue
+#include "linedisc.h"                 // for the line discipline
 
 
 
@@ -37,27 +69,76 @@
 
 #define JTAG_DATA_REG_OFFSET          0
 #define JTAG_CNTRL_REG_OFFSET         1
-#define JTAG_UART_INT_ENABLE_BITMASK  1
+#define JTAG_UART_INT_ENABLE_BITMASK  1       // RE
+#define JTAG_UART_WRITE_INT_BITMASK   2       // WE
 
 #define JTAG_UART_WSPACE_MASK         0xFFFF0000
+#define JTAG_UART_WSPACE_SHIFT        16
 #define JTAG_UART_RV_BIT_MASK         0x00008000
 #define JTAG_UART_DATA_MASK           0x000000FF
-
-#define BACKSPACE 0x7f
-#define RETURN 0xa
+#define JTAG_UART_RAVAIL_MASK         0xFFFF0000
+
+// order the receive ring between the ISR and the main loop; on the board
+// they keep the compiler from moving the ring's loads and stores, on a
+// host they order the threads as well
+#define UART_LOAD_ACQUIRE(index)         __atomic_load_n(&(index), \
+                                                         __ATOMIC_ACQUIRE)
+#define UART_STORE_RELEASE(index, value) __atomic_store_n(&(index), (value), \
+                                                          __ATOMIC_RELEASE)
+#define UART_FENCE()                     __atomic_thread_fence( \
+                                           __ATOMIC_SEQ_CST)
+
+// fail to compile when a line of UART_LINE_MAX does not fit the line
+// discipline, or the EventItem that uart_GetLine copies it into
+typedef char uartLineFitsDisc[(UART_LINE_MAX <= LINEDISC_MAX_LENGTH) ?
+                              1 : -1];
+typedef char uartLineFitsEvent[(UART_LINE_MAX <= EVENT_LINE_MAX) ? 1 : -1];
+
+// the cycle counter the statistics are timed with: the BSP's timestamp
+// timer when it has one, or what a host's system.h gives
+#if(UART_STATS_ENABLE) && !defined(UART_CYCLES)
+#ifdef ALT_TIMESTAMP_CLK
+#include <sys/alt_timestamp.h>        // for alt_timestamp
+#define UART_CYCLES()                    ((uint32)alt_timestamp())
+#else
+#define UART_CYCLES()                    0
+#endif
+#endif
+
+#if(UART_STATS_ENABLE)
+#define UART_STAT_ADD(field, count)      (uartStats.field += (count))
+#else
+#define UART_STAT_ADD(field, count)
+#endif
 
 
 //*****************************************************************************
 //                            Define private data
 //*****************************************************************************
 
-volatile uint32* uartDataRegPtr   = (uint32*)JTAG_UART_0_BASE;
-volatile uint32* uartCntrlRegPtr  = ((uint32*)JTAG_UART_0_BASE +
-                                             JTAG_CNTRL_REG_OFFSET);
-uint8   uartStoreValue[5];
-uint8*  uartStorePtr;
-uint32  userInputReady = FALSE;
-static uint32 store_slot = 0;
+// the receive ring; the ISR moves the tail, uart_GetLine the head
+static uint8  uartRxRing[UART_RX_RING_SIZE];
+static uint32 uartRxHead = 0;
+static uint32 uartRxTail = 0;
+static uint32 uartRxPosted = FALSE;  // an EVENT_RX is on its way
+static uint32 uartRxStalled = FALSE; // the ISR turned RE off for room
+
+// the line being edited from the ring, for the main loop only
+static LineDisc uartLineDisc;
+static uint32   uartLineReady = FALSE; // RETURN ended a line not yet cleared
+
+// the transmit ring; the ISR moves the head, uart_Write the tail
+static uint8           uartTxRing[UART_TX_RING_SIZE];
+static volatile uint32 uartTxHead = 0;
+static volatile uint32 uartTxTail = 0;
+static uint32          uartTxPolicy = UART_TX_POLICY;
+static uint32          uartTxDropped = 0;
+static uint32          uartControl = 0;  // RE and WE as last written
+
+#if(UART_STATS_ENABLE)
+// changed by the ISR or with the interrupts masked
+static UartStats uartStats;
+#endif
 
 //*****************************************************************************
 //                           Define external data
@@ -68,14 +149,222 @@ static uint32 store_slot = 0;
 //                             private functions
 //*****************************************************************************
 
+//----------------------------------------------------------------------------
+// NAME: UART Transmit Drain
+//
+// DESCRIPTION:
+//    This function moves bytes from the transmit ring into the write FIFO
+//    for as long as the FIFO has room.  The control register is read once
+//    per burst: WSPACE says how many bytes the FIFO takes, and that many
+//    are written back to back.  It is called with the interrupts masked or
+//    from the ISR.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void uart_TxDrain(void)
+{
+  uint32 head = uartTxHead;
+  uint32 space;
+
+  while (head != uartTxTail)
+  {
+    space = (IORD(JTAG_UART_0_BASE, JTAG_CNTRL_REG_OFFSET) &
+             JTAG_UART_WSPACE_MASK) >> JTAG_UART_WSPACE_SHIFT;
+    if (space == 0)
+    {
+      break;
+    }
+    if (space > uartTxTail - head)
+    {
+      space = uartTxTail - head;
+    }
+    while (space-- > 0)
+    {
+      IOWR(JTAG_UART_0_BASE, JTAG_DATA_REG_OFFSET,
+           uartTxRing[head & (UART_TX_RING_SIZE - 1)]);
+      head++;
+    }
+  }
+  UART_STAT_ADD(tx_bytes, head - uartTxHead);
+  uartTxHead = head;
+} /* uart_TxDrain */
+
+#if(UART_STATS_ENABLE)
+//----------------------------------------------------------------------------
+// NAME: UART Stat Bucket
+//
+// DESCRIPTION:
+//    This function counts a value in a log2 histogram: 0 in bucket 0, and
+//    from 2^(n-1) up to 2^n in bucket n, the last bucket taking all that
+//    are larger.
+//
+// INPUT:
+//   value - the value
+//
+// OUTPUT:
+//   histogram - the histogram
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void uart_StatBucket(uint32* histogram, uint32 value)
+{
+  uint32 bucket = 0;
+
+  while ((bucket < UART_STATS_BUCKETS - 1) && ((value >> bucket) != 0))
+  {
+    bucket++;
+  }
+  histogram[bucket]++;
+}
+
+//----------------------------------------------------------------------------
+// NAME: UART Stat Wait
+//
+// DESCRIPTION:
+//    This function counts a write that waited for room in the transmit
+//    ring.  It is called with the interrupts masked.
+//
+// INPUT:
+//   spins - the tries for room
+//   cycles - the cycles from the first try to the last
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void uart_StatWait(uint32 spins, uint32 cycles)
+{
+  uartStats.tx_waits++;
+  uartStats.tx_spins += spins;
+  uartStats.tx_stall_cycles += cycles;
+  if (spins > uartStats.tx_spin_max)
+  {
+    uartStats.tx_spin_max = spins;
+  }
+  if (cycles > uartStats.tx_stall_max)
+  {
+    uartStats.tx_stall_max = cycles;
+  }
+  uart_StatBucket(uartStats.spin_histogram, spins);
+}
+
+//----------------------------------------------------------------------------
+// NAME: UART Stat ISR
+//
+// DESCRIPTION:
+//    This function counts a call of the ISR and the cycles it took.
+//
+// INPUT:
+//   cycles - the cycles from entry to exit
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void uart_StatIsr(uint32 cycles)
+{
+  uartStats.isr_calls++;
+  uartStats.isr_cycles += cycles;
+  if (cycles > uartStats.isr_max)
+  {
+    uartStats.isr_max = cycles;
+  }
+  uart_StatBucket(uartStats.isr_histogram, cycles);
+}
+#endif
+
+//----------------------------------------------------------------------------
+// NAME: UART Echo
+//
+// DESCRIPTION:
+//    This function sends the line discipline's echo.
+//
+// INPUT:
+//   data - the echo
+//   length - its length
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void uart_Echo(const uint8* data, uint32 length)
+{
+  uart_Write(data, length);
+}
+
+//----------------------------------------------------------------------------
+// NAME: UART Receive Assemble
+//
+// DESCRIPTION:
+//    This function feeds characters from the receive ring to the line
+//    discipline.  It stops at RETURN or when the ring is empty, and turns
+//    the receive interrupt back on if the ISR turned it off for room.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if RETURN ended the line
+//----------------------------------------------------------------------------
+static int uart_RxAssemble(void)
+{
+  alt_irq_context context;
+  uint32 head = uartRxHead;
+  uint32 tail = UART_LOAD_ACQUIRE(uartRxTail);
+  int ended = FALSE;
+
+  while ((head != tail) && !ended)
+  {
+    ended = linedisc_Feed(&uartLineDisc,
+                          uartRxRing[head & (UART_RX_RING_SIZE - 1)]);
+    head++;
+  }
+  if (ended)
+  {
+    uartLineReady = TRUE;
+  }
+  UART_STORE_RELEASE(uartRxHead, head);
+
+  if (UART_LOAD_ACQUIRE(uartRxStalled))
+  {
+    context = alt_irq_disable_all();
+    uartRxStalled = FALSE;
+    uartControl |= JTAG_UART_INT_ENABLE_BITMASK;
+    IOWR(JTAG_UART_0_BASE, JTAG_CNTRL_REG_OFFSET, uartControl);
+    alt_irq_enable_all(context);
+  }
+  return ended;
+} /* uart_RxAssemble */
+
 //----------------------------------------------------------------------------
 // NAME: Check UART receive Buffer Isr
 //
 // DESCRIPTION:
 //    This function will check to see if the receive buffer has any data
 //    in it. If there is data in the UART, it is read at the same time as
-//    the RV bit. If RV is set then the data is stripped out and echoed back
-//    UART.
+//    the RV bit, and while RV is set the data is put in the receive ring
+//    for the main loop.  If the ring fills, the rest stays in the FIFO and
+//    the receive interrupt is turned off until the main loop makes room.
+//    EVENT_RX is posted unless one is already on its way.  It then moves
+//    what it can of the transmit ring into the write FIFO, and turns the
+//    write interrupt off once the ring is empty.
 //
 // INPUT:
 //    context - the Altera ISR requires this. The context is a pointer used to pass context-specific information into the ISR.
@@ -88,65 +377,60 @@ static uint32 store_slot = 0;
 //----------------------------------------------------------------------------
 void uart_RecvBufferIsr (void* context)
 {
-  uint32 valid;
+  #if(UART_STATS_ENABLE)
+    uint32 start = UART_CYCLES();
+  #endif
+  uint32 tail = uartRxTail;
   uint32 data_reg;
-  uint8 character;
-
-  data_reg = *uartDataRegPtr;
-  valid = JTAG_UART_RV_BIT_MASK & data_reg;
+  uint32 received = 0;
 
-  if (valid != 0)
+  while (uartControl & JTAG_UART_INT_ENABLE_BITMASK)
   {
-    character = (uint8)data_reg & JTAG_UART_DATA_MASK;
-    if ((character >= 'a') && (character <= 'z'))
+    if (tail - UART_LOAD_ACQUIRE(uartRxHead) == UART_RX_RING_SIZE)
     {
-       character -= 32;
-    } /* if */
-
-    switch(character)
+      UART_STORE_RELEASE(uartRxStalled, TRUE);
+      UART_STAT_ADD(rx_stalls, 1);
+      uartControl &= ~JTAG_UART_INT_ENABLE_BITMASK;
+      IOWR(JTAG_UART_0_BASE, JTAG_CNTRL_REG_OFFSET, uartControl);
+      break;
+    }
+    data_reg = IORD(JTAG_UART_0_BASE, JTAG_DATA_REG_OFFSET);
+    if ((JTAG_UART_RV_BIT_MASK & data_reg) == 0)
     {
-      case BACKSPACE:
-        character = '\b';
-        if (store_slot != 0)
-        {
-          uart_SendByte(character);
-          uart_SendByte(' ');
-          uart_SendByte(character);
-          uartStoreValue[store_slot] = (uint8)NULL;
-          store_slot--;
-        }
       break;
-
-      case RETURN:
-        uart_SendByte(character);
-        userInputReady = TRUE;
-        uartStoreValue[store_slot] = (uint8)NULL;
-        store_slot = 0;
+    }
+    uartRxRing[tail & (UART_RX_RING_SIZE - 1)] =
+      (uint8)(data_reg & JTAG_UART_DATA_MASK);
+    tail++;
+    received++;
+    if ((data_reg & JTAG_UART_RAVAIL_MASK) == 0)
+    {
       break;
+    }
+  }
 
-      default:
-        if (store_slot == 0)
-        {
-          int i = 0;
-          for (i = 0; i < 5; i++)
-          {
-            uartStoreValue[i] = 0;
-          }
-        }
-
-        if (store_slot < 4)
-        {
-          uart_SendByte(character);
-          uartStoreValue[store_slot] = character;
-          store_slot++;
-        }
-      break;
+  if (received != 0)
+  {
+    UART_STAT_ADD(rx_bytes, received);
+    UART_STORE_RELEASE(uartRxTail, tail);
+    // the tail must be seen before the flag is, see uart_GetLine
+    UART_FENCE();
+    if (!__atomic_exchange_n(&uartRxPosted, TRUE, __ATOMIC_SEQ_CST))
+    {
+      event_Post(EVENT_RX, NULL);
     }
   }
-  else
+
+  uart_TxDrain();
+  if ((uartTxHead == uartTxTail) &&
+      (uartControl & JTAG_UART_WRITE_INT_BITMASK))
   {
-    uart_SendString("The input character is invalid.");
+    uartControl &= ~JTAG_UART_WRITE_INT_BITMASK;
+    IOWR(JTAG_UART_0_BASE, JTAG_CNTRL_REG_OFFSET, uartControl);
   }
+  #if(UART_STATS_ENABLE)
+    uart_StatIsr(UART_CYCLES() - start);
+  #endif
 } /* uart_RecvBufferIsr */
 
 //*****************************************************************************
@@ -154,37 +438,154 @@ void uart_RecvBufferIsr (void* context)
 //*****************************************************************************
 
 //----------------------------------------------------------------------------
-// NAME: UART Send a String
+// NAME: UART Write Vector
 //
 // DESCRIPTION:
-//    This function will output a string (NULL terminated) to the UART.
+//    This function puts the text of a list of descriptors in the transmit
+//    ring, in order, and returns; the write interrupt sends it.  The text
+//    goes from where the descriptors point straight into the ring.  When
+//    the ring has no room for all of it the transmit policy decides: BLOCK
+//    waits for room, filling the write FIFO from the ring itself and
+//    letting the interrupts in between tries, DROP writes none of it, and
+//    PARTIAL writes as much as fits in the ring and the FIFO.  Bytes not
+//    written are counted as dropped.
 //
 // INPUT:
-//    msg  - contains the string to send to the UART
+//    descs - the descriptors
+//    count - the number of descriptors
 //
 // OUTPUT:
 //   none
 //
 // RETURN:
-//   none
+//   the number of bytes written
 //----------------------------------------------------------------------------
-void uart_SendString (char* msg)
+uint32 uart_WriteVector (const OutDesc* descs, uint32 count)
 {
-  uint8 character = (uint8)NULL;
+  alt_irq_context context;
+  uint32 written = 0;
+  uint32 length = 0;
+  uint32 room;
+  uint32 d;
+  uint32 n = 0;
+  #if(UART_STATS_ENABLE)
+    uint32 spins = 0;
+    uint32 stall_start = 0;
+  #endif
+
+  for (d = 0; d < count; d++)
+  {
+    length += descs[d].length;
+  }
+  d = 0;
 
-    // get first character of string
-    character = *msg++;
+  context = alt_irq_disable_all();
+  uart_TxDrain();
+  room = UART_TX_RING_SIZE - (uartTxTail - uartTxHead);
+  if ((room < length) && (uartTxPolicy == UART_TX_DROP))
+  {
+    uartTxDropped += length;
+    alt_irq_enable_all(context);
+    return 0;
+  }
 
-    while (character != (uint8)NULL)
+  while (written < length)
+  {
+    if ((uartTxTail - uartTxHead) == UART_TX_RING_SIZE)
+    {
+      uart_TxDrain();
+      if ((uartTxTail - uartTxHead) < UART_TX_RING_SIZE)
+      {
+        continue;
+      }
+      if (uartTxPolicy != UART_TX_BLOCK)
+      {
+        break;
+      }
+      // let the other interrupts in while waiting for room
+      #if(UART_STATS_ENABLE)
+        if (spins++ == 0)
+        {
+          stall_start = UART_CYCLES();
+        }
+      #endif
+      alt_irq_enable_all(context);
+      context = alt_irq_disable_all();
+      continue;
+    }
+    while (n == descs[d].length)
     {
+      d++;
+      n = 0;
+    }
+    uartTxRing[uartTxTail & (UART_TX_RING_SIZE - 1)] = descs[d].data[n++];
+    uartTxTail++;
+    written++;
+  }
+  uartTxDropped += length - written;
+  #if(UART_STATS_ENABLE)
+    if (spins > 0)
+    {
+      uart_StatWait(spins, UART_CYCLES() - stall_start);
+    }
+  #endif
 
-      // as long as character is not NULL then keep looping
-      // call uart_SendByte with character
-      uart_SendByte (character);
-      // Get next character
-      character = *msg++;
+  // a short write goes straight to the FIFO and needs no interrupt
+  uart_TxDrain();
+  if ((uartTxHead != uartTxTail) &&
+      !(uartControl & JTAG_UART_WRITE_INT_BITMASK))
+  {
+    uartControl |= JTAG_UART_WRITE_INT_BITMASK;
+    IOWR(JTAG_UART_0_BASE, JTAG_CNTRL_REG_OFFSET, uartControl);
+  }
+  alt_irq_enable_all(context);
+  return written;
+} /* uart_WriteVector */
 
-    } /* while */
+//----------------------------------------------------------------------------
+// NAME: UART Write
+//
+// DESCRIPTION:
+//    This function puts bytes in the transmit ring and returns, as
+//    uart_WriteVector does for one descriptor.
+//
+// INPUT:
+//    data  - the bytes to send
+//    length - the number of bytes
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes written
+//----------------------------------------------------------------------------
+uint32 uart_Write (const uint8* data, uint32 length)
+{
+  OutDesc desc;
+
+  desc.data = data;
+  desc.length = length;
+  return uart_WriteVector(&desc, 1);
+} /* uart_Write */
+
+//----------------------------------------------------------------------------
+// NAME: UART Send a String
+//
+// DESCRIPTION:
+//    This function will output a string (NULL terminated) to the UART.
+//
+// INPUT:
+//    msg  - contains the string to send to the UART
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void uart_SendString (char* msg)
+{
+  uart_Write((const uint8*)msg, (uint32)strlen(msg));
 } /* uart_SendString */
 
 
@@ -192,8 +593,8 @@ void uart_SendString (char* msg)
 // NAME: UART Send a byte
 //
 // DESCRIPTION:
-//    This function will send a single byte to the UART. Before the data is
-//    sent to the UART, this function makes sure there is room in the buffer.
+//    This function will send a single byte to the UART through the transmit
+//    ring.
 //
 // INPUT:
 //    byte  - contains the byte to send to the UART
@@ -206,30 +607,110 @@ void uart_SendString (char* msg)
 //----------------------------------------------------------------------------
 void uart_SendByte (uint8 byte)
 {
-  uint8 control_reg_value = 0;
-  do
-   {
-     // read control register and mask out all bit but WPSPACE
-    if ((JTAG_UART_WSPACE_MASK & *uartCntrlRegPtr) == 0)
-    {
-      control_reg_value = 0;
-    }
-    else
-    {
-      control_reg_value = 1;
-    }
-
-   } while (0 == control_reg_value);
-   // now buffer has room so write the data to UART buffer
-   *uartDataRegPtr = byte;
+  uart_Write(&byte, 1);
 } /* uart_SendByte */
 
+//----------------------------------------------------------------------------
+// NAME: UART Set Transmit Policy
+//
+// DESCRIPTION:
+//    This function chooses what uart_Write does when the transmit ring is
+//    full.
+//
+// INPUT:
+//    policy - UART_TX_BLOCK, UART_TX_DROP or UART_TX_PARTIAL
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void uart_SetTxPolicy(uint32 policy)
+{
+  uartTxPolicy = policy;
+}
+
+//----------------------------------------------------------------------------
+// NAME: UART Transmit Dropped
+//
+// DESCRIPTION:
+//    This function tells how many bytes uart_Write has not written because
+//    the transmit ring was full.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes dropped
+//----------------------------------------------------------------------------
+uint32 uart_TxDropped(void)
+{
+  return uartTxDropped;
+}
+
+//----------------------------------------------------------------------------
+// NAME: UART Transmit Pending
+//
+// DESCRIPTION:
+//    This function tells how many bytes wait in the transmit ring for room
+//    in the write FIFO.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes waiting
+//----------------------------------------------------------------------------
+uint32 uart_TxPending(void)
+{
+  return uartTxTail - uartTxHead;
+}
+
+//----------------------------------------------------------------------------
+// NAME: UART Get Line
+//
+// DESCRIPTION:
+//    This function assembles what has been typed into the line, echoing
+//    it, and hands the line over when RETURN ends it.  The main loop calls
+//    it before waiting and on each EVENT_RX; characters after the RETURN
+//    stay in the ring for the next call.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   line - the line, NULL terminated, when one ended
+//
+// RETURN:
+//   TRUE if a line ended
+//----------------------------------------------------------------------------
+int uart_GetLine(uint8* line)
+{
+  // clearing the flag before looking at the ring means a character the
+  // ISR puts in after the look posts a new EVENT_RX
+  __atomic_store_n(&uartRxPosted, FALSE, __ATOMIC_SEQ_CST);
+  UART_FENCE();
+  if (!uart_RxAssemble())
+  {
+    return FALSE;
+  }
+  memcpy(line, uartLineDisc.line, UART_LINE_MAX + 1);
+  return TRUE;
+}
+
 //----------------------------------------------------------------------------
 // NAME: UART Get User Input
 //
 // DESCRIPTION:
-//    This function will send the value stored inside the UART into the main
-//    function.
+//    This function will send the line typed so far, or the last one ended,
+//    into the main function, and start a new one.
 //
 // INPUT:
 //    user_inval - pointer that points to the address of the input
@@ -243,41 +724,36 @@ void uart_SendByte (uint8 byte)
 //----------------------------------------------------------------------------
 void uart_GetUserInput(uint8* user_inval, uint8 length)
 {
-  int i;
-  for (i = 0; i < length; i++)
-  {
-    user_inval[i] = uartStoreValue[i];
-  }
-  store_slot = 0;
+  linedisc_Take(&uartLineDisc, user_inval, length);
 }
 
 //----------------------------------------------------------------------------
 // NAME: UART Is User Input Ready
 //
 // DESCRIPTION:
-//    This function sends out the value of userInputReady to signify if the
-//    user is ready to send his input.
+//    This function tells whether RETURN has ended a line since the last
+//    uart_ClearUserInput.
 //
 // INPUT:
 //   none
 //
 // OUTPUT:
-//   userInputReady - the value that toggles on when the user is ready
+//   none
 //
 // RETURN:
 //   uint32
 //----------------------------------------------------------------------------
 uint32 uart_IsUserInputReady(void)
 {
-  return userInputReady;
+  return uartLineReady;
 }
 
 //----------------------------------------------------------------------------
 // NAME: UART Clear User Input
 //
 // DESCRIPTION:
-//    This function sets the value of userInputReady to "FALSE" to clear
-//    the previous input.
+//    This function sets the line ready flag to "FALSE" to clear the
+//    previous input.
 //
 // INPUT:
 //   none
@@ -290,14 +766,45 @@ uint32 uart_IsUserInputReady(void)
 //----------------------------------------------------------------------------
 void uart_ClearUserInput(void)
 {
-  userInputReady = FALSE;
+  uartLineReady = FALSE;
 }
 
+#if(UART_STATS_ENABLE)
+//----------------------------------------------------------------------------
+// NAME: UART Get Stats
+//
+// DESCRIPTION:
+//    This function copies the driver's counters since uart_ConfigInterrupt,
+//    with the interrupts masked so they agree with one another; tx_dropped
+//    is the count uart_TxDropped gives.  The cycle counts wrap at 2^32.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   stats - the counters
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void uart_GetStats(UartStats* stats)
+{
+  alt_irq_context context;
+
+  context = alt_irq_disable_all();
+  *stats = uartStats;
+  stats->tx_dropped = uartTxDropped;
+  alt_irq_enable_all(context);
+  stats->rx_ignored = uartLineDisc.ignored;
+}
+#endif
+
 //----------------------------------------------------------------------------
 // NAME: UART Configure Interrupt
 //
 // DESCRIPTION:
-//    This function sets up the UART interrupt before enabling it.
+//    This function starts the line discipline with an empty line, clears
+//    the counters and sets up the UART interrupt before enabling it.
 //
 // INPUT:
 //   none
@@ -310,6 +817,14 @@ void uart_ClearUserInput(void)
 //----------------------------------------------------------------------------
 void uart_ConfigInterrupt(void)
 {
+  linedisc_Init(&uartLineDisc, UART_LINE_MAX, LINEDISC_UPPER | LINEDISC_ECHO,
+                uart_Echo);
+  #if(UART_STATS_ENABLE)
+    memset(&uartStats, 0, sizeof(uartStats));
+    #ifdef ALT_TIMESTAMP_CLK
+      alt_timestamp_start();
+    #endif
+  #endif
   alt_ic_isr_register (JTAG_UART_0_IRQ_INTERRUPT_CONTROLLER_ID, JTAG_UART_0_IRQ, uart_RecvBufferIsr, 0, 0); // used for 2nd part when interrupts are enabled
 }
 
@@ -330,5 +845,10 @@ void uart_ConfigInterrupt(void)
 //----------------------------------------------------------------------------
 void uart_EnableInterrupt(void)
 {
-  *uartCntrlRegPtr = JTAG_UART_INT_ENABLE_BITMASK;
+  alt_irq_context context;
+
+  context = alt_irq_disable_all();
+  uartControl |= JTAG_UART_INT_ENABLE_BITMASK;
+  IOWR(JTAG_UART_0_BASE, JTAG_CNTRL_REG_OFFSET, uartControl);
+  alt_irq_enable_all(context);
 }
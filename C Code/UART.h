@@ -22,13 +22,76 @@
 #define UART_MOD_H_
 
 #include "nios_std_types.h"           // for standard embedded types
+#include "outq.h"                     // for the output descriptors
 
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+// what uart_Write does when the transmit ring is full
+#define UART_TX_BLOCK         0       // wait for room
+#define UART_TX_DROP          1       // write nothing
+#define UART_TX_PARTIAL       2       // write what fits
+
+#ifndef UART_TX_POLICY
+#define UART_TX_POLICY        UART_TX_BLOCK
+#endif
+
+#ifndef UART_TX_RING_SIZE
+#define UART_TX_RING_SIZE     1024    // power of two
+#endif
+
+#ifndef UART_RX_RING_SIZE
+#define UART_RX_RING_SIZE     256     // power of two
+#endif
+
+#ifndef UART_LINE_MAX
+#define UART_LINE_MAX         16      // characters kept of a line
+#endif
+
+// 0 compiles the counters and the timing of the ISR out of the driver
+#ifndef UART_STATS_ENABLE
+#define UART_STATS_ENABLE     1
+#endif
+
+#define UART_STATS_BUCKETS    16      // bucket n counts values under 2^n
+
+#if(UART_STATS_ENABLE)
+typedef struct
+{
+  uint32 tx_bytes;                    // bytes put in the write FIFO
+  uint32 rx_bytes;                    // bytes taken from the read FIFO
+  uint32 tx_dropped;                  // bytes the transmit policy dropped
+  uint32 rx_ignored;                  // characters the line discipline ignored
+  uint32 rx_stalls;                   // times a full ring turned RE off
+  uint32 tx_waits;                    // writes that waited for room
+  uint32 tx_spins;                    // tries for room while waiting
+  uint32 tx_spin_max;                 // the most tries of one write
+  uint32 tx_stall_cycles;             // cycles spent waiting for room
+  uint32 tx_stall_max;                // the most cycles of one write
+  uint32 isr_calls;
+  uint32 isr_cycles;                  // cycles from ISR entry to exit
+  uint32 isr_max;                     // the most cycles of one call
+  uint32 isr_histogram[UART_STATS_BUCKETS];    // ISR cycles
+  uint32 spin_histogram[UART_STATS_BUCKETS];   // tries of the writes waiting
+} UartStats;
+#endif
+
+uint32 uart_WriteVector (const OutDesc* descs, uint32 count);
+uint32 uart_Write (const uint8* data, uint32 length);
+void uart_SetTxPolicy(uint32 policy);
+uint32 uart_TxDropped(void);
+uint32 uart_TxPending(void);
 void uart_SendString (char* msg);
 void uart_SendByte (uint8 byte);
+int  uart_GetLine(uint8* line);
 void uart_GetUserInput(uint8* user_inval, uint8 length);
 void uart_EnableInterrupt(void);
 void uart_ConfigInterrupt(void);
 uint32 uart_IsUserInputReady(void);
 void uart_ClearUserInput(void);
+#if(UART_STATS_ENABLE)
+void uart_GetStats(UartStats* stats);
+void uart_ResetStats(void);
+#endif
 
 #endif /*UART_MOD_H_*/
@@ -0,0 +1,374 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: advisor Functions
+//
+//    FILENAME: advisor.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the hint advisor.  The history is applied
+//              to a candidate set to find the secrets still possible, then
+//              every guess is scored against them by the P/C/- pattern the
+//              player would be shown.  A guess that splits N candidates
+//              into groups of n1, n2, ... sizes has entropy log2(N) -
+//              sum(ni * log2(ni)) / N, so the best guess is the one with
+//              the smallest sum, which is kept in fixed point.
+//
+//              The guesses that could be the secret are tried first, so a
+//              search cut short by its time budget still has a good answer.
+//              Complete answers are cached by history.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memcmp
+#include <math.h>                     // for log2
+#include <time.h>                     // for clock
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes and feedback
+#include "solver.h"                   // for the list of guesses
+#include "engine.h"                   // for the 4x6 scorer
+#include "cands.h"                    // for the candidate sets
+#include "advisor.h"                  // for advisor definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define ADVISOR_CACHE_SIZE    64      // a power of two
+#define ADVISOR_MASK_SLOTS    4096    // one per packed 4x6 code
+#define ADVISOR_CHECK_EVERY   32      // guesses between two clock reads
+#define ADVISOR_FRACTION_BITS 16
+
+typedef struct
+{
+  int         num_moves;              // -1 if the entry is empty
+  uint16      guesses[ADVISOR_MAX_HISTORY];
+  uint8       feedbacks[ADVISOR_MAX_HISTORY];
+  AdvisorHint hint;
+} AdvisorEntry;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static CandsSpace* advisorSpace = NULL;
+static CandsSet    advisorSet;
+static uint16      advisorCandidates[SCORE_NUM_SECRETS];
+
+// n * log2(n) for every group size, with ADVISOR_FRACTION_BITS fraction bits
+static uint32      advisorNLogN[SCORE_NUM_SECRETS + 1];
+
+static AdvisorEntry advisorCache[ADVISOR_CACHE_SIZE];
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: ADVISOR Hash
+//
+// DESCRIPTION:
+//    This function picks the cache entry of a history.
+//
+// INPUT:
+//   guesses - the packed guesses played
+//   feedbacks - the feedback of each guess
+//   num_moves - the number of guesses played
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the cache entry number
+//----------------------------------------------------------------------------
+static int advisor_Hash(const uint16* guesses, const uint8* feedbacks,
+                        int num_moves)
+{
+  uint32 hash = 2166136261u;
+  int m;
+
+  for (m = 0; m < num_moves; m++)
+  {
+    hash = (hash ^ guesses[m]) * 16777619u;
+    hash = (hash ^ feedbacks[m]) * 16777619u;
+  }
+  return (int)((hash ^ (hash >> 16)) & (ADVISOR_CACHE_SIZE - 1));
+}
+
+//----------------------------------------------------------------------------
+// NAME: ADVISOR Split Cost
+//
+// DESCRIPTION:
+//    This function groups the candidates by the pattern a guess would give
+//    and returns the sum of n * log2(n) over the groups.
+//
+// INPUT:
+//   guess - the packed guess
+//   count - the number of candidates
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the sum, with ADVISOR_FRACTION_BITS fraction bits
+//----------------------------------------------------------------------------
+static uint32 advisor_SplitCost(uint16 guess, int count)
+{
+  int groups[SCORE_NUM_PATTERNS] = {0};
+  uint32 cost = 0;
+  int n;
+
+  for (n = 0; n < count; n++)
+  {
+    groups[engine_Pattern4x6(guess, advisorCandidates[n])]++;
+  }
+  for (n = 0; n < SCORE_NUM_PATTERNS; n++)
+  {
+    cost += advisorNLogN[groups[n]];
+  }
+  return cost;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ADVISOR Consider
+//
+// DESCRIPTION:
+//    This function scores one guess and keeps it if it beats the best so
+//    far.  Ties go to a guess that could be the secret, then to the first
+//    guess in code order.
+//
+// INPUT:
+//   guess - the packed guess
+//   is_candidate - TRUE if the guess could be the secret
+//   count - the number of candidates
+//   best_cost - the split cost of the best guess so far
+//
+// OUTPUT:
+//   best_cost - updated with the new best
+//   hint - guess and is_candidate updated with the new best
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void advisor_Consider(uint16 guess, int is_candidate, int count,
+                             uint32* best_cost, AdvisorHint* hint)
+{
+  uint32 cost = advisor_SplitCost(guess, count);
+
+  if ((cost < *best_cost) ||
+      ((cost == *best_cost) &&
+       ((is_candidate > hint->is_candidate) ||
+        ((is_candidate == hint->is_candidate) && (guess < hint->guess)))))
+  {
+    *best_cost = cost;
+    hint->guess = guess;
+    hint->is_candidate = is_candidate;
+  }
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: ADVISOR Init
+//
+// DESCRIPTION:
+//    This function creates the candidate space and the n * log2(n) table.
+//    It must be called after solver_Init.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE on success, FALSE if the candidate space could not be allocated
+//----------------------------------------------------------------------------
+int advisor_Init(void)
+{
+  int n;
+
+  advisorNLogN[0] = 0;
+  for (n = 1; n <= SCORE_NUM_SECRETS; n++)
+  {
+    advisorNLogN[n] = (uint32)(n * log2((double)n) *
+                               (1 << ADVISOR_FRACTION_BITS) + 0.5);
+  }
+  advisor_ClearCache();
+
+  if (advisorSpace == NULL)
+  {
+    advisorSpace = CANDS_CREATE_ENGINE_SPACE(4x6, ADVISOR_MASK_SLOTS);
+    if ((advisorSpace == NULL) ||
+        !cands_CreateSet(&advisorSet, advisorSpace))
+    {
+      cands_DestroySpace(advisorSpace);
+      advisorSpace = NULL;
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ADVISOR Suggest
+//
+// DESCRIPTION:
+//    This function suggests the next guess for a history.  Feedback must be
+//    the pattern of the hint shown for each guess, as score_PatternCodes
+//    gives it.  When the time budget runs out the best guess found so far
+//    is returned and not cached.
+//
+// INPUT:
+//   guesses - the packed guesses played
+//   feedbacks - the pattern of each guess
+//   num_moves - the number of guesses played
+//   budget_usec - the time limit, or ADVISOR_NO_BUDGET
+//
+// OUTPUT:
+//   hint - the suggestion
+//
+// RETURN:
+//   TRUE on success, FALSE if no secret fits the history or the advisor
+//   could not get memory
+//----------------------------------------------------------------------------
+int advisor_Suggest(const uint16* guesses, const uint8* feedbacks,
+                    int num_moves, uint32 budget_usec, AdvisorHint* hint)
+{
+  AdvisorEntry* entry = &advisorCache[advisor_Hash(guesses, feedbacks,
+                                                   num_moves)];
+  clock_t start = clock();
+  clock_t budget = (clock_t)(((double)budget_usec * CLOCKS_PER_SEC) /
+                             1000000.0);
+  uint32 best_cost = 0xFFFFFFFF;
+  int count = 0;
+  int g;
+  int n;
+
+  if ((entry->num_moves == num_moves) &&
+      (0 == memcmp(entry->guesses, guesses, num_moves * sizeof(uint16))) &&
+      (0 == memcmp(entry->feedbacks, feedbacks, num_moves)))
+  {
+    *hint = entry->hint;
+    hint->cached = TRUE;
+    return TRUE;
+  }
+  if (advisorSpace == NULL)
+  {
+    return FALSE;
+  }
+
+  cands_Fill(&advisorSet);
+  for (g = 0; g < num_moves; g++)
+  {
+    if (cands_Filter(&advisorSet, advisorSpace, guesses[g],
+                     feedbacks[g]) < 0)
+    {
+      return FALSE;
+    }
+  }
+  for (n = cands_Next(&advisorSet, 0); n >= 0;
+       n = cands_Next(&advisorSet, n + 1))
+  {
+    advisorCandidates[count++] = (uint16)advisorSpace->codes[n];
+  }
+  if (count == 0)
+  {
+    return FALSE;
+  }
+
+  hint->guess = advisorCandidates[0];
+  hint->candidates = count;
+  hint->is_candidate = TRUE;
+  hint->evaluated = 0;
+  hint->complete = TRUE;
+  hint->cached = FALSE;
+
+  // the candidates first, then every other guess
+  for (g = 0; (g < count + SOLVER_NUM_GUESSES) && (count > 1); g++)
+  {
+    if ((budget_usec != ADVISOR_NO_BUDGET) &&
+        ((hint->evaluated % ADVISOR_CHECK_EVERY) == 0) &&
+        (hint->evaluated > 0) && ((clock() - start) >= budget))
+    {
+      hint->complete = FALSE;
+      break;
+    }
+    if (g < count)
+    {
+      advisor_Consider(advisorCandidates[g], TRUE, count, &best_cost, hint);
+    }
+    else
+    {
+      uint16 guess = solver_GetGuess(g - count);
+      int index = score_CodeIndex(guess);
+      if ((index >= 0) && ((advisorSet.bits[index / CANDS_WORD_BITS] >>
+                            (index % CANDS_WORD_BITS)) & 1))
+      {
+        continue;
+      }
+      advisor_Consider(guess, FALSE, count, &best_cost, hint);
+    }
+    hint->evaluated++;
+  }
+
+  if (count == 1)
+  {
+    hint->entropy_milli = 0;
+  }
+  else
+  {
+    hint->entropy_milli = (uint32)((log2((double)count) -
+                                    (double)best_cost /
+                                    (1 << ADVISOR_FRACTION_BITS) / count) *
+                                   1000.0 + 0.5);
+  }
+
+  if (hint->complete && (num_moves <= ADVISOR_MAX_HISTORY))
+  {
+    entry->num_moves = num_moves;
+    memcpy(entry->guesses, guesses, num_moves * sizeof(uint16));
+    memcpy(entry->feedbacks, feedbacks, num_moves);
+    entry->hint = *hint;
+  }
+  return TRUE;
+} /* advisor_Suggest */
+
+//----------------------------------------------------------------------------
+// NAME: ADVISOR Clear Cache
+//
+// DESCRIPTION:
+//    This function forgets every cached suggestion.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void advisor_ClearCache(void)
+{
+  int e;
+  for (e = 0; e < ADVISOR_CACHE_SIZE; e++)
+  {
+    advisorCache[e].num_moves = -1;
+  }
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: advisor Definitions
+//
+//    FILENAME: advisor.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions for the hint advisor.
+//              Given the guesses played so far and their P/C/- hints, the
+//              advisor suggests the guess whose hint is expected to tell
+//              the player the most, i.e. the guess that splits the
+//              remaining secrets with the highest entropy.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef ADVISOR_MOD_H_
+#define ADVISOR_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+// histories longer than this are advised but not cached
+#define ADVISOR_MAX_HISTORY   12
+
+// no time limit
+#define ADVISOR_NO_BUDGET     0
+
+typedef struct
+{
+  uint16 guess;                       // packed guess to play
+  int    candidates;                  // secrets still possible
+  uint32 entropy_milli;               // expected information, in millibits
+  int    is_candidate;                // TRUE if the guess could be the secret
+  int    evaluated;                   // guesses looked at
+  int    complete;                    // FALSE if the time budget ran out
+  int    cached;                      // TRUE if taken from the cache
+} AdvisorHint;
+
+int  advisor_Init(void);
+int  advisor_Suggest(const uint16* guesses, const uint8* feedbacks,
+                     int num_moves, uint32 budget_usec, AdvisorHint* hint);
+void advisor_ClearCache(void);
+
+#endif /*ADVISOR_MOD_H_*/
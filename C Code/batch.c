@@ -0,0 +1,409 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: batch Functions
+//
+//    FILENAME: batch.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the batch scorer.  One guess is scored
+//              against a contiguous array of candidate secrets and the
+//              packed pattern of every candidate, as score_PatternCodes
+//              gives it, is written out.  On x86 hosts the SSE2 and AVX2
+//              kernels score 16 and 32 candidates per step; everywhere
+//              else, including the board, the scalar kernel is used.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes and feedback
+#include "batch.h"                    // for batch definitions
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BATCH_HAVE_X86 1
+#include <immintrin.h>                // for SSE2 and AVX2 intrinsics
+#else
+#define BATCH_HAVE_X86 0
+#endif
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define BATCH_PEG(code, i) \
+  (((code) >> ((i) * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK)
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static const char* batchKernelNames[BATCH_NUM_KERNELS] =
+  {"scalar", "sse2", "avx2"};
+
+// the weight of each peg's digit in a pattern
+static const uint8 batchDigitWeight[SCORE_NUM_PEGS] = {1, 3, 9, 27};
+
+static void batch_ScoreScalar(uint16 guess, const BatchCandidates* candidates,
+                              uint8* feedback);
+
+// the kernel batch_Score uses, only written by batch_Init
+static BatchKernel batchKernel = batch_ScoreScalar;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Score Range
+//
+// DESCRIPTION:
+//    This function scores a range of candidates one at a time.  It is the
+//    scalar kernel and also finishes the tail left over by the vector
+//    kernels.
+//
+// INPUT:
+//   guess - the packed guess
+//   candidates - the candidate secrets
+//   first - the first candidate to score
+//
+// OUTPUT:
+//   feedback - the packed pattern of every candidate in the range
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void batch_ScoreRange(uint16 guess, const BatchCandidates* candidates,
+                             int first, uint8* feedback)
+{
+  uint8 g[SCORE_NUM_PEGS];
+  int n;
+  int i;
+  int j;
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    g[i] = (uint8)BATCH_PEG(guess, i);
+  }
+  for (n = first; n < candidates->count; n++)
+  {
+    int pattern = 0;
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      int is_exact = (g[i] == candidates->peg[i][n]);
+      int present = 0;
+      for (j = 0; j < SCORE_NUM_PEGS; j++)
+      {
+        present |= (g[i] == candidates->peg[j][n]);
+      }
+      pattern += (present + is_exact) * batchDigitWeight[i];
+    }
+    feedback[n] = (uint8)pattern;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Score Scalar
+//
+// DESCRIPTION:
+//    This function is the portable kernel that scores every candidate.
+//
+// INPUT:
+//   guess - the packed guess
+//   candidates - the candidate secrets
+//
+// OUTPUT:
+//   feedback - the packed pattern of every candidate
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void batch_ScoreScalar(uint16 guess, const BatchCandidates* candidates,
+                              uint8* feedback)
+{
+  batch_ScoreRange(guess, candidates, 0, feedback);
+}
+
+#if BATCH_HAVE_X86
+//----------------------------------------------------------------------------
+// NAME: BATCH Score SSE2
+//
+// DESCRIPTION:
+//    This function scores 16 candidates per step.  A byte compare gives 0xFF
+//    for a match, so each peg adds its digit weight once through the mask
+//    of the colors present and once more through the mask of exact
+//    matches.
+//
+// INPUT:
+//   guess - the packed guess
+//   candidates - the candidate secrets
+//
+// OUTPUT:
+//   feedback - the packed pattern of every candidate
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static void batch_ScoreSse2(uint16 guess, const BatchCandidates* candidates,
+                            uint8* feedback)
+{
+  __m128i g[SCORE_NUM_PEGS];
+  __m128i w[SCORE_NUM_PEGS];
+  int n;
+  int i;
+  int j;
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    g[i] = _mm_set1_epi8((char)BATCH_PEG(guess, i));
+    w[i] = _mm_set1_epi8((char)batchDigitWeight[i]);
+  }
+  for (n = 0; n + 16 <= candidates->count; n += 16)
+  {
+    __m128i s[SCORE_NUM_PEGS];
+    __m128i result = _mm_setzero_si128();
+
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      s[i] = _mm_loadu_si128((const __m128i*)&candidates->peg[i][n]);
+    }
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      __m128i is_exact = _mm_cmpeq_epi8(s[i], g[i]);
+      __m128i present = _mm_setzero_si128();
+      for (j = 0; j < SCORE_NUM_PEGS; j++)
+      {
+        present = _mm_or_si128(present, _mm_cmpeq_epi8(s[j], g[i]));
+      }
+      result = _mm_add_epi8(result, _mm_and_si128(present, w[i]));
+      result = _mm_add_epi8(result, _mm_and_si128(is_exact, w[i]));
+    }
+    _mm_storeu_si128((__m128i*)&feedback[n], result);
+  }
+  batch_ScoreRange(guess, candidates, n, feedback);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Score AVX2
+//
+// DESCRIPTION:
+//    This function is the AVX2 version of batch_ScoreSse2 and scores 32
+//    candidates per step.
+//
+// INPUT:
+//   guess - the packed guess
+//   candidates - the candidate secrets
+//
+// OUTPUT:
+//   feedback - the packed pattern of every candidate
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void batch_ScoreAvx2(uint16 guess, const BatchCandidates* candidates,
+                            uint8* feedback)
+{
+  __m256i g[SCORE_NUM_PEGS];
+  __m256i w[SCORE_NUM_PEGS];
+  int n;
+  int i;
+  int j;
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    g[i] = _mm256_set1_epi8((char)BATCH_PEG(guess, i));
+    w[i] = _mm256_set1_epi8((char)batchDigitWeight[i]);
+  }
+  for (n = 0; n + 32 <= candidates->count; n += 32)
+  {
+    __m256i s[SCORE_NUM_PEGS];
+    __m256i result = _mm256_setzero_si256();
+
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      s[i] = _mm256_loadu_si256((const __m256i*)&candidates->peg[i][n]);
+    }
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      __m256i is_exact = _mm256_cmpeq_epi8(s[i], g[i]);
+      __m256i present = _mm256_setzero_si256();
+      for (j = 0; j < SCORE_NUM_PEGS; j++)
+      {
+        present = _mm256_or_si256(present, _mm256_cmpeq_epi8(s[j], g[i]));
+      }
+      result = _mm256_add_epi8(result, _mm256_and_si256(present, w[i]));
+      result = _mm256_add_epi8(result, _mm256_and_si256(is_exact, w[i]));
+    }
+    _mm256_storeu_si256((__m256i*)&feedback[n], result);
+  }
+  batch_ScoreRange(guess, candidates, n, feedback);
+}
+#endif
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Load Candidates
+//
+// DESCRIPTION:
+//    This function spreads an array of packed codes into the per-peg arrays
+//    of a candidate batch.  The caller provides the peg arrays.
+//
+// INPUT:
+//   codes - the packed candidate codes
+//   count - the number of codes
+//
+// OUTPUT:
+//   candidates - the candidate batch
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void batch_LoadCandidates(BatchCandidates* candidates, const uint16* codes,
+                          int count)
+{
+  int n;
+  int i;
+  for (n = 0; n < count; n++)
+  {
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      candidates->peg[i][n] = (uint8)BATCH_PEG(codes[n], i);
+    }
+  }
+  candidates->count = count;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Init
+//
+// DESCRIPTION:
+//    This function picks the fastest kernel the processor supports for
+//    batch_Score.  It must be called before any thread scores a batch;
+//    until then the scalar kernel is used.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void batch_Init(void)
+{
+  BatchKernel kernel = batch_GetKernel(BATCH_KERNEL_AVX2);
+
+  if (kernel == NULL)
+  {
+    kernel = batch_GetKernel(BATCH_KERNEL_SSE2);
+  }
+  if (kernel == NULL)
+  {
+    kernel = batch_GetKernel(BATCH_KERNEL_SCALAR);
+  }
+  batchKernel = kernel;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Score
+//
+// DESCRIPTION:
+//    This function scores a guess against every candidate with the kernel
+//    batch_Init picked.  It only reads shared data, so several threads may
+//    score at once.
+//
+// INPUT:
+//   guess - the packed guess
+//   candidates - the candidate secrets
+//
+// OUTPUT:
+//   feedback - the packed pattern of every candidate
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void batch_Score(uint16 guess, const BatchCandidates* candidates,
+                 uint8* feedback)
+{
+  batchKernel(guess, candidates, feedback);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Get Kernel
+//
+// DESCRIPTION:
+//    This function returns a specific kernel so it can be benchmarked or
+//    checked against the others.
+//
+// INPUT:
+//   kernel - BATCH_KERNEL_SCALAR, BATCH_KERNEL_SSE2 or BATCH_KERNEL_AVX2
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the kernel, or NULL if the processor does not support it
+//----------------------------------------------------------------------------
+BatchKernel batch_GetKernel(int kernel)
+{
+  switch (kernel)
+  {
+    case BATCH_KERNEL_SCALAR:
+      return batch_ScoreScalar;
+
+#if BATCH_HAVE_X86
+    case BATCH_KERNEL_SSE2:
+      if (__builtin_cpu_supports("sse2"))
+      {
+        return batch_ScoreSse2;
+      }
+      break;
+
+    case BATCH_KERNEL_AVX2:
+      if (__builtin_cpu_supports("avx2"))
+      {
+        return batch_ScoreAvx2;
+      }
+      break;
+#endif
+  }
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BATCH Get Kernel Name
+//
+// DESCRIPTION:
+//    This function returns the printable name of a kernel.
+//
+// INPUT:
+//   kernel - BATCH_KERNEL_SCALAR, BATCH_KERNEL_SSE2 or BATCH_KERNEL_AVX2
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the kernel name
+//----------------------------------------------------------------------------
+const char* batch_GetKernelName(int kernel)
+{
+  return batchKernelNames[kernel];
+}
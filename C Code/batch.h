@@ -0,0 +1,54 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: batch Definitions
+//
+//    FILENAME: batch.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the candidate batch and
+//              the batch scoring kernels used in batch.c.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef BATCH_MOD_H_
+#define BATCH_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for SCORE_NUM_PEGS
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define BATCH_KERNEL_SCALAR   0
+#define BATCH_KERNEL_SSE2     1
+#define BATCH_KERNEL_AVX2     2
+#define BATCH_NUM_KERNELS     3
+
+// candidate secrets stored struct-of-arrays: peg[i][n] is the color number
+// of peg i of candidate n, so each peg position fills its own vector lanes
+typedef struct
+{
+  uint8* peg[SCORE_NUM_PEGS];
+  int    count;
+} BatchCandidates;
+
+typedef void (*BatchKernel)(uint16 guess, const BatchCandidates* candidates,
+                            uint8* feedback);
+
+void        batch_Init(void);
+void        batch_LoadCandidates(BatchCandidates* candidates,
+                                 const uint16* codes, int count);
+void        batch_Score(uint16 guess, const BatchCandidates* candidates,
+                        uint8* feedback);
+BatchKernel batch_GetKernel(int kernel);
+const char* batch_GetKernelName(int kernel);
+
+#endif /*BATCH_MOD_H_*/
@@ -0,0 +1,289 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: book Functions
+//
+//    FILENAME: book.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the functions that find, check and read
+//              the sections of an opening book held in memory.  Nothing is
+//              copied out of the book, so a mapped file is used in place.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memcmp
+#include "nios_std_types.h"           // for standard embedded types
+#include "book.h"                     // for book definitions
+#include "engine.h"                   // for the packing of a configuration
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define BOOK_MAX_FEEDBACKS    256
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: BOOK Is Guess
+//
+// DESCRIPTION:
+//    This function checks that a packed guess is one the solver may play
+//    in a section's configuration: no bits above its pegs and every peg
+//    one of its colors.  A guess may repeat a color even when the secrets
+//    do not, as the solver's 4x6 opening does.
+//
+// INPUT:
+//   section - the section
+//   guess - the packed guess
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the guess may be played in the configuration, else FALSE
+//----------------------------------------------------------------------------
+static int book_IsGuess(const BookSection* section, uint32 guess)
+{
+  uint32 bits = ENGINE_BITS(section->colors);
+  int i;
+
+  if ((section->pegs > ENGINE_MAX_PEGS) ||
+      (section->colors > ENGINE_MAX_COLORS) ||
+      ((section->pegs * bits < 32) &&
+       ((guess >> (section->pegs * bits)) != 0)))
+  {
+    return FALSE;
+  }
+  for (i = 0; i < section->pegs; i++)
+  {
+    if (((guess >> (i * bits)) & ((1u << bits) - 1)) >= section->colors)
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: BOOK Checksum
+//
+// DESCRIPTION:
+//    This function computes the 32 bit FNV-1a hash of a block of bytes.
+//
+// INPUT:
+//   data - the bytes
+//   size - the number of bytes
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the hash
+//----------------------------------------------------------------------------
+uint32 book_Checksum(const uint8* data, uint32 size)
+{
+  uint32 hash = 2166136261u;
+  uint32 n;
+
+  for (n = 0; n < size; n++)
+  {
+    hash = (hash ^ data[n]) * 16777619u;
+  }
+  return hash;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BOOK Find Section
+//
+// DESCRIPTION:
+//    This function checks the header of a book and returns the section of
+//    a configuration.  The book is rejected if its magic, version, size or
+//    checksum is wrong, or if a section's entries lie outside of it or are
+//    not aligned to be read in place.
+//
+// INPUT:
+//   book - the start of the book
+//   size - the number of bytes available
+//   pegs - the number of pegs of the configuration
+//   colors - the number of colors of the configuration
+//   repeats - TRUE if codes of the configuration may repeat a color
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the section, or NULL if the book is bad or has no such section
+//----------------------------------------------------------------------------
+const BookSection* book_FindSection(const void* book, uint32 size, int pegs,
+                                    int colors, int repeats)
+{
+  const BookHeader* header = (const BookHeader*)book;
+  const BookSection* sections = (const BookSection*)(header + 1);
+  const BookSection* found = NULL;
+  uint32 s;
+
+  if ((size < sizeof(BookHeader)) ||
+      (0 != memcmp(header->magic, BOOK_MAGIC, sizeof(BOOK_MAGIC))) ||
+      (header->version != BOOK_VERSION) || (header->file_size != size) ||
+      (header->num_sections > (size - sizeof(BookHeader)) /
+                              sizeof(BookSection)) ||
+      (header->checksum !=
+       book_Checksum((const uint8*)book + sizeof(BookHeader),
+                     size - sizeof(BookHeader))))
+  {
+    return NULL;
+  }
+
+  for (s = 0; s < header->num_sections; s++)
+  {
+    const BookSection* section = &sections[s];
+    if ((section->num_feedbacks > BOOK_MAX_FEEDBACKS) ||
+        (section->depth < 1) || (section->depth > BOOK_MAX_DEPTH) ||
+        (section->entries > size) ||
+        ((section->entries % sizeof(uint32)) != 0) ||
+        (section->num_feedbacks >
+         (size - section->entries) / sizeof(BookEntry)))
+    {
+      return NULL;
+    }
+    if ((section->pegs == pegs) && (section->colors == colors) &&
+        (section->repeats == repeats))
+    {
+      found = section;
+    }
+  }
+  return found;
+} /* book_FindSection */
+
+//----------------------------------------------------------------------------
+// NAME: BOOK Check Section
+//
+// DESCRIPTION:
+//    This function checks a section against the scoring rules of the game.
+//    The secrets are grouped by the pattern of the first guess, and every
+//    entry must hold the size of its group, with a second guess exactly
+//    when the group is not empty.  Every guess must be one the solver may
+//    play in the configuration and score as a win against itself.
+//
+// INPUT:
+//   book - the start of the book
+//   section - the section, from book_FindSection
+//   codes - every secret code of the configuration
+//   score - the configuration's pattern scorer, e.g. engine_Pattern4x6
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the section matches the rules, else FALSE
+//----------------------------------------------------------------------------
+int book_CheckSection(const void* book, const BookSection* section,
+                      const uint32* codes,
+                      uint16 (*score)(uint32 guess, uint32 secret))
+{
+  const BookEntry* entries =
+    (const BookEntry*)((const uint8*)book + section->entries);
+  uint32 groups[BOOK_MAX_FEEDBACKS] = {0};
+  uint32 win = 0;
+  uint32 n;
+
+  // every peg in place: the digit 2 in every position
+  for (n = 0; n < section->pegs; n++)
+  {
+    win = win * 3 + 2;
+  }
+  if (!book_IsGuess(section, section->first_guess) ||
+      (score(section->first_guess, section->first_guess) != win))
+  {
+    return FALSE;
+  }
+  for (n = 0; n < section->num_codes; n++)
+  {
+    uint16 feedback = score(section->first_guess, codes[n]);
+    if (feedback >= section->num_feedbacks)
+    {
+      return FALSE;
+    }
+    groups[feedback]++;
+  }
+  for (n = 0; n < section->num_feedbacks; n++)
+  {
+    if (entries[n].candidates != groups[n])
+    {
+      return FALSE;
+    }
+    if (section->depth < BOOK_MAX_DEPTH)
+    {
+      continue;
+    }
+    if ((groups[n] == 0) != (entries[n].guess == BOOK_NO_GUESS))
+    {
+      return FALSE;
+    }
+    if ((groups[n] != 0) &&
+        (!book_IsGuess(section, entries[n].guess) ||
+         (score(entries[n].guess, entries[n].guess) != win)))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+} /* book_CheckSection */
+
+//----------------------------------------------------------------------------
+// NAME: BOOK Lookup
+//
+// DESCRIPTION:
+//    This function returns the book's guess for a game in progress.
+//
+// INPUT:
+//   book - the start of the book
+//   section - the section, from book_FindSection
+//   feedbacks - the pattern of each guess played so far, which must have
+//               been the book's own guesses
+//   num_moves - the number of guesses played so far
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed guess, or BOOK_NO_GUESS if the game has left the book
+//----------------------------------------------------------------------------
+uint32 book_Lookup(const void* book, const BookSection* section,
+                   const uint8* feedbacks, int num_moves)
+{
+  const BookEntry* entries =
+    (const BookEntry*)((const uint8*)book + section->entries);
+
+  if (num_moves == 0)
+  {
+    return section->first_guess;
+  }
+  if ((num_moves == 1) && (section->depth >= 2) &&
+      (feedbacks[0] < section->num_feedbacks))
+  {
+    return entries[feedbacks[0]].guess;
+  }
+  return BOOK_NO_GUESS;
+}
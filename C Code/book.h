@@ -0,0 +1,86 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: book Definitions
+//
+//    FILENAME: book.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the layout of the opening book and the
+//              functions that read it.  The book holds the solver's first
+//              guess and its second guess for every P/C/- pattern the
+//              first can get, so the two most expensive moves of a game
+//              cost a lookup.  Version 1 books, which held a guess per
+//              count feedback, are rejected.
+//
+//              The book is built offline by mkbook and is used straight
+//              from memory, e.g. a read-only mapping of the file, so all
+//              fields are fixed width and little endian like the Nios II:
+//
+//                BookHeader
+//                BookSection  x num_sections, one per configuration
+//                BookEntry    x num_feedbacks, for each section, at the
+//                             section's entries offset
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef BOOK_MOD_H_
+#define BOOK_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define BOOK_MAGIC            "CBBOOK1"
+#define BOOK_VERSION          2
+#define BOOK_NO_GUESS         0xFFFFFFFF
+#define BOOK_MAX_DEPTH        2       // guesses held per game
+
+typedef struct
+{
+  char   magic[8];                    // BOOK_MAGIC, NULL terminated
+  uint32 version;                     // BOOK_VERSION
+  uint32 file_size;                   // bytes in the whole book
+  uint32 num_sections;                // configurations in the book
+  uint32 checksum;                    // book_Checksum of every later byte
+} BookHeader;
+
+typedef struct
+{
+  uint8  pegs;                        // the configuration
+  uint8  colors;
+  uint8  repeats;
+  uint8  depth;                       // guesses held, 1 or BOOK_MAX_DEPTH
+  uint32 num_codes;                   // secrets in the configuration
+  uint32 num_feedbacks;               // entries in the section, one per
+                                      // pattern
+  uint32 first_guess;                 // packed opening guess
+  uint32 entries;                     // offset of the entries in the book
+} BookSection;
+
+typedef struct
+{
+  uint32 guess;                       // second guess, or BOOK_NO_GUESS
+  uint32 candidates;                  // secrets left after the first guess
+} BookEntry;
+
+uint32             book_Checksum(const uint8* data, uint32 size);
+const BookSection* book_FindSection(const void* book, uint32 size, int pegs,
+                                    int colors, int repeats);
+int                book_CheckSection(const void* book,
+                                     const BookSection* section,
+                                     const uint32* codes,
+                                     uint16 (*score)(uint32 guess,
+                                                     uint32 secret));
+uint32             book_Lookup(const void* book, const BookSection* section,
+                               const uint8* feedbacks, int num_moves);
+
+#endif /*BOOK_MOD_H_*/
@@ -0,0 +1,451 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: cands Functions
+//
+//    FILENAME: cands.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the candidate set functions.  The masks
+//              of every (guess, pattern) pair would not fit in memory for
+//              the larger configurations, so they are built one guess at a
+//              time, the first time the guess is used, with a single pass
+//              that scores the guess against every code.  Each guess keeps
+//              a slot of a direct mapped cache; a guess that maps to a used
+//              slot replaces the masks held there.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <stdlib.h>                   // for malloc
+#include <string.h>                   // for memset
+#include "nios_std_types.h"           // for standard embedded types
+#include "cands.h"                    // for candidate set definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define CANDS_NO_GUESS        0xFFFFFFFF
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Slot
+//
+// DESCRIPTION:
+//    This function picks the cache slot of a guess.  The packed codes of
+//    the 4x6 game are below 4096, so with 4096 slots each guess keeps its
+//    own.
+//
+// INPUT:
+//   space - the candidate space
+//   guess - the packed guess
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the slot number
+//----------------------------------------------------------------------------
+static int cands_Slot(const CandsSpace* space, uint32 guess)
+{
+  return (int)((guess ^ (guess >> 12) ^ (guess >> 24)) &
+               (uint32)(space->cache_slots - 1));
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Build Masks
+//
+// DESCRIPTION:
+//    This function builds the mask of every pattern for one guess.
+//
+// INPUT:
+//   space - the candidate space
+//   guess - the packed guess
+//
+// OUTPUT:
+//   masks - num_feedbacks masks of num_words words each
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void cands_BuildMasks(const CandsSpace* space, uint32 guess,
+                             uint32* masks)
+{
+  int n;
+
+  memset(masks, 0, sizeof(uint32) * space->num_feedbacks * space->num_words);
+  for (n = 0; n < space->num_codes; n++)
+  {
+    uint16 feedback = space->score(guess, space->codes[n]);
+    masks[feedback * space->num_words + n / CANDS_WORD_BITS] |=
+      1u << (n % CANDS_WORD_BITS);
+  }
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Create Space
+//
+// DESCRIPTION:
+//    This function creates the candidate space of a game configuration.  No
+//    masks are built until they are asked for.  The masks of a 6x10 guess
+//    take 14 MB, so the slots are halved until they all fit in
+//    CANDS_MAX_CACHE_BYTES, leaving at least one.
+//
+// INPUT:
+//   num_codes - the number of secret codes
+//   num_feedbacks - the number of patterns
+//   list - lists the secret codes, returning how many there are
+//   score - gives the pattern of a guess against a secret
+//   cache_slots - the number of guesses whose masks are kept, a power of
+//                 two
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the space, or NULL if it could not be allocated
+//----------------------------------------------------------------------------
+CandsSpace* cands_CreateSpace(int num_codes, int num_feedbacks,
+                              int (*list)(uint32* codes),
+                              uint16 (*score)(uint32 guess, uint32 secret),
+                              int cache_slots)
+{
+  CandsSpace* space = malloc(sizeof(CandsSpace));
+  uint32 slot_bytes = sizeof(uint32) * num_feedbacks *
+                      CANDS_NUM_WORDS(num_codes);
+  int slot;
+
+  if (space == NULL)
+  {
+    return NULL;
+  }
+  while ((cache_slots > 1) &&
+         ((uint32)cache_slots > CANDS_MAX_CACHE_BYTES / slot_bytes))
+  {
+    cache_slots /= 2;
+  }
+  space->num_codes = num_codes;
+  space->num_feedbacks = num_feedbacks;
+  space->num_words = CANDS_NUM_WORDS(num_codes);
+  space->score = score;
+  space->cache_slots = cache_slots;
+  space->hits = 0;
+  space->misses = 0;
+  space->codes = malloc(sizeof(uint32) * num_codes);
+  space->cache_guess = malloc(sizeof(uint32) * cache_slots);
+  space->cache_masks = calloc(cache_slots, sizeof(uint32*));
+
+  if ((space->codes == NULL) || (space->cache_guess == NULL) ||
+      (space->cache_masks == NULL) || (list(space->codes) != num_codes))
+  {
+    cands_DestroySpace(space);
+    return NULL;
+  }
+  for (slot = 0; slot < cache_slots; slot++)
+  {
+    space->cache_guess[slot] = CANDS_NO_GUESS;
+  }
+  return space;
+} /* cands_CreateSpace */
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Destroy Space
+//
+// DESCRIPTION:
+//    This function frees a candidate space and all of its cached masks.
+//
+// INPUT:
+//   space - the candidate space, may be NULL
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void cands_DestroySpace(CandsSpace* space)
+{
+  int slot;
+
+  if (space == NULL)
+  {
+    return;
+  }
+  if (space->cache_masks != NULL)
+  {
+    for (slot = 0; slot < space->cache_slots; slot++)
+    {
+      free(space->cache_masks[slot]);
+    }
+  }
+  free(space->cache_masks);
+  free(space->cache_guess);
+  free(space->codes);
+  free(space);
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Get Mask
+//
+// DESCRIPTION:
+//    This function returns the secrets that give a pattern for a guess,
+//    building the guess's masks if they are not in the cache.
+//
+// INPUT:
+//   space - the candidate space
+//   guess - the packed guess
+//   feedback - the packed pattern, below num_feedbacks
+//
+// OUTPUT:
+//   space - the cache and its counters are updated
+//
+// RETURN:
+//   the mask, or NULL if its memory could not be allocated
+//----------------------------------------------------------------------------
+const uint32* cands_GetMask(CandsSpace* space, uint32 guess, uint16 feedback)
+{
+  int slot = cands_Slot(space, guess);
+  uint32* masks = space->cache_masks[slot];
+
+  if (space->cache_guess[slot] == guess)
+  {
+    space->hits++;
+  }
+  else
+  {
+    space->misses++;
+    if (masks == NULL)
+    {
+      masks = malloc(sizeof(uint32) * space->num_feedbacks *
+                     space->num_words);
+      if (masks == NULL)
+      {
+        return NULL;
+      }
+      space->cache_masks[slot] = masks;
+    }
+    cands_BuildMasks(space, guess, masks);
+    space->cache_guess[slot] = guess;
+  }
+  return masks + feedback * space->num_words;
+} /* cands_GetMask */
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Create Set
+//
+// DESCRIPTION:
+//    This function allocates an empty candidate set over a space.
+//
+// INPUT:
+//   space - the candidate space
+//
+// OUTPUT:
+//   set - the new set
+//
+// RETURN:
+//   TRUE on success, FALSE if it could not be allocated
+//----------------------------------------------------------------------------
+int cands_CreateSet(CandsSet* set, const CandsSpace* space)
+{
+  set->space = space;
+  set->bits = calloc(space->num_words, sizeof(uint32));
+  return (set->bits != NULL);
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Destroy Set
+//
+// DESCRIPTION:
+//    This function frees the bits of a candidate set.
+//
+// INPUT:
+//   set - the candidate set
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void cands_DestroySet(CandsSet* set)
+{
+  free(set->bits);
+  set->bits = NULL;
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Fill
+//
+// DESCRIPTION:
+//    This function makes every code of the space a candidate.  The unused
+//    bits of the last word stay clear so counts are exact.
+//
+// INPUT:
+//   set - the candidate set
+//
+// OUTPUT:
+//   set - every code is set
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void cands_Fill(CandsSet* set)
+{
+  int tail = set->space->num_codes % CANDS_WORD_BITS;
+  int w;
+
+  for (w = 0; w < set->space->num_words; w++)
+  {
+    set->bits[w] = 0xFFFFFFFF;
+  }
+  if (tail != 0)
+  {
+    set->bits[set->space->num_words - 1] = (1u << tail) - 1;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Copy
+//
+// DESCRIPTION:
+//    This function copies one candidate set into another over the same
+//    space.
+//
+// INPUT:
+//   source - the set to copy
+//
+// OUTPUT:
+//   dest - the copy
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void cands_Copy(CandsSet* dest, const CandsSet* source)
+{
+  memcpy(dest->bits, source->bits, sizeof(uint32) * source->space->num_words);
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Filter
+//
+// DESCRIPTION:
+//    This function applies a hint: it keeps only the candidates that would
+//    have given the P/C/- pattern for the guess, and counts them in the
+//    same pass.
+//
+// INPUT:
+//   set - the candidate set
+//   space - the space of the set, whose mask cache is used
+//   guess - the packed guess that was played
+//   feedback - the packed pattern it received
+//
+// OUTPUT:
+//   set - the candidates that are still possible
+//
+// RETURN:
+//   the number of candidates left, or -1 if the mask could not be built
+//----------------------------------------------------------------------------
+int cands_Filter(CandsSet* set, CandsSpace* space, uint32 guess,
+                 uint16 feedback)
+{
+  const uint32* mask = cands_GetMask(space, guess, feedback);
+  int count = 0;
+  int w;
+
+  if (mask == NULL)
+  {
+    return -1;
+  }
+  for (w = 0; w < space->num_words; w++)
+  {
+    set->bits[w] &= mask[w];
+    count += __builtin_popcount(set->bits[w]);
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Count
+//
+// DESCRIPTION:
+//    This function counts the candidates in a set.
+//
+// INPUT:
+//   set - the candidate set
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of candidates
+//----------------------------------------------------------------------------
+int cands_Count(const CandsSet* set)
+{
+  int count = 0;
+  int w;
+
+  for (w = 0; w < set->space->num_words; w++)
+  {
+    count += __builtin_popcount(set->bits[w]);
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+// NAME: CANDS Next
+//
+// DESCRIPTION:
+//    This function finds the next candidate at or after a code index, so
+//    a caller can walk the set with
+//    for (n = cands_Next(set, 0); n >= 0; n = cands_Next(set, n + 1)).
+//
+// INPUT:
+//   set - the candidate set
+//   index - the first code index to look at
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the code index of the candidate, or -1 if there is none
+//----------------------------------------------------------------------------
+int cands_Next(const CandsSet* set, int index)
+{
+  int w = index / CANDS_WORD_BITS;
+  uint32 word;
+
+  if (index >= set->space->num_codes)
+  {
+    return -1;
+  }
+  word = set->bits[w] & (0xFFFFFFFF << (index % CANDS_WORD_BITS));
+  while (word == 0)
+  {
+    if (++w == set->space->num_words)
+    {
+      return -1;
+    }
+    word = set->bits[w];
+  }
+  return w * CANDS_WORD_BITS + __builtin_ctz(word);
+}
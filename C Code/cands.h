@@ -0,0 +1,86 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: cands Definitions
+//
+//    FILENAME: cands.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions for the candidate sets.
+//              A candidate set is a bitset over every secret code of a game
+//              configuration, one bit per code in packed order.  A space
+//              holds the codes of one configuration and a cache of masks:
+//              for a guess, the mask of a P/C/- pattern has a bit set for
+//              every secret that gives that pattern.  Applying a hint is
+//              then one AND of the set with a mask.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef CANDS_MOD_H_
+#define CANDS_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "engine.h"                   // for the game configurations
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define CANDS_WORD_BITS       32
+#define CANDS_NUM_WORDS(codes)  (((codes) + CANDS_WORD_BITS - 1) / \
+                                 CANDS_WORD_BITS)
+
+// the most memory the masks of a space may take, slots are dropped to fit
+#ifndef CANDS_MAX_CACHE_BYTES
+#define CANDS_MAX_CACHE_BYTES (64 * 1024 * 1024)
+#endif
+
+// creates the space of an ENGINE_CONFIGS entry, e.g.
+// CANDS_CREATE_ENGINE_SPACE(4x6, 2048)
+#define CANDS_CREATE_ENGINE_SPACE(name, cache_slots)                  \
+  cands_CreateSpace(ENGINE_NUM_CODES_##name, ENGINE_NUM_PATTERNS_##name, \
+                    engine_ListCodes##name, engine_Pattern##name, cache_slots)
+
+typedef struct
+{
+  int     num_codes;                  // secret codes in the configuration
+  int     num_feedbacks;              // patterns a guess can get
+  int     num_words;                  // words in one set or mask
+  uint32* codes;                      // the packed codes, in bit order
+  uint16  (*score)(uint32 guess, uint32 secret);
+
+  int      cache_slots;               // a power of two
+  uint32*  cache_guess;               // the guess held by each slot
+  uint32** cache_masks;               // num_feedbacks masks per used slot
+  uint32   hits;                      // mask lookups found in the cache
+  uint32   misses;                    // mask lookups that built the masks
+} CandsSpace;
+
+typedef struct
+{
+  const CandsSpace* space;
+  uint32* bits;
+} CandsSet;
+
+CandsSpace*   cands_CreateSpace(int num_codes, int num_feedbacks,
+                                int (*list)(uint32* codes),
+                                uint16 (*score)(uint32 guess, uint32 secret),
+                                int cache_slots);
+void          cands_DestroySpace(CandsSpace* space);
+const uint32* cands_GetMask(CandsSpace* space, uint32 guess, uint16 feedback);
+int           cands_CreateSet(CandsSet* set, const CandsSpace* space);
+void          cands_DestroySet(CandsSet* set);
+void          cands_Fill(CandsSet* set);
+void          cands_Copy(CandsSet* dest, const CandsSet* source);
+int           cands_Filter(CandsSet* set, CandsSpace* space, uint32 guess,
+                           uint16 feedback);
+int           cands_Count(const CandsSet* set);
+int           cands_Next(const CandsSet* set, int index);
+
+#endif /*CANDS_MOD_H_*/
@@ -0,0 +1,74 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: coro Definitions
+//
+//    FILENAME: coro.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the macros for stackless coroutines.  A
+//              coroutine is a function that returns where it waits and is
+//              called again to go on from there.  CORO_AWAIT records its
+//              line in a resume point and returns; the next call jumps back
+//              to that line through the switch in CORO_BEGIN and goes on if
+//              its condition holds, so each call's input meets one await.
+//              Only the resume point has to be kept, so a suspended
+//              coroutine costs a few bytes.
+//
+//              Local variables do not live across CORO_AWAIT; anything the
+//              coroutine needs later belongs in its own structure.  Nothing
+//              between CORO_BEGIN and CORO_END may use a switch of its own,
+//              and each CORO_AWAIT must be on a line of its own.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef CORO_MOD_H_
+#define CORO_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define CORO_START            0       // resume point of a new coroutine
+#define CORO_DONE             0xFFFF  // resume point of a finished one
+
+typedef uint16 CoroPoint;
+
+// the body of the coroutine goes between CORO_BEGIN and CORO_END
+#define CORO_BEGIN(point)                                               \
+  switch (point)                                                        \
+  {                                                                     \
+  case CORO_START:
+
+// returns TRUE, then goes on at the first later call on which cond holds
+#define CORO_AWAIT(point, cond)                                         \
+  do                                                                    \
+  {                                                                     \
+    (point) = __LINE__;                                                 \
+    return TRUE;                                                        \
+  case __LINE__:                                                        \
+    if (!(cond))                                                        \
+    {                                                                   \
+      return TRUE;                                                      \
+    }                                                                   \
+  } while (0)
+
+// returns FALSE now and on every call after
+#define CORO_END(point)                                                 \
+  default:                                                              \
+    break;                                                              \
+  }                                                                     \
+  (point) = CORO_DONE;                                                  \
+  return FALSE
+
+#define coro_IsDone(point)    ((point) == CORO_DONE)
+
+#endif /*CORO_MOD_H_*/
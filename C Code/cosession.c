@@ -0,0 +1,314 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: cosession Functions
+//
+//    FILENAME: cosession.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the CodeBreaker game as a coroutine and a
+//              scheduler for many of them.  cosession_Resume reads from top
+//              to bottom like a game is played: the menu, the guesses, the
+//              result, KEY1.  It shows the same output as game_Step would
+//              from the same events, one resume doing the work of the steps
+//              from one wait to the next, and it keeps game.state up to date
+//              so the frontend and display_DisplayOutput see the same state.
+//
+//              The frames are the caller's, so a server may take them from a
+//              pool; nothing here allocates.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memcpy
+#include "nios_std_types.h"           // for standard embedded types
+#include "rng.h"                      // for the random number generator
+#include "game.h"                     // for the game library
+#include "cosession.h"                // for cosession definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+
+// waits until the event is one of those in mask
+#define COSESSION_AWAIT(session, event, mask)                           \
+  (session)->awaiting = (mask);                                         \
+  CORO_AWAIT((session)->point, (event)->type < 8 &&                     \
+             (((1 << (event)->type) & (mask)) != 0))
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: COSESSION Init
+//
+// DESCRIPTION:
+//    This function starts a session and runs it to the main menu.
+//
+// INPUT:
+//   seed - the seed of the session's secret codes
+//
+// OUTPUT:
+//   session - the session
+//   output - the welcome message
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void cosession_Init(CoSession* session, uint32 seed, GameOutput* output)
+{
+  GameEvent event;
+
+  memset(session, 0, sizeof(CoSession));
+  rng_Seed(&session->game.rng, seed);
+  event.type = GAME_EVENT_NONE;
+  cosession_Resume(session, &event, output);
+}
+
+//----------------------------------------------------------------------------
+// NAME: COSESSION Resume
+//
+// DESCRIPTION:
+//    This function runs the game from where it waits to where it waits
+//    next.  An event the game is not waiting for changes nothing.
+//
+// INPUT:
+//   event - what happened
+//
+// OUTPUT:
+//   session - the session
+//   output - what the frontend must show or do, in order
+//
+// RETURN:
+//   FALSE once the player has left the game, else TRUE
+//----------------------------------------------------------------------------
+int cosession_Resume(CoSession* session, const GameEvent* event,
+                     GameOutput* output)
+{
+  GameSession* game = &session->game;
+  uint8 next;
+
+  output->count = 0;
+  CORO_BEGIN(session->point);
+  for (;;)
+  {
+    game_Enter(game, eGAME_IDLE, output);
+    COSESSION_AWAIT(session, event, COSESSION_LINE);
+    next = game_MenuCommand(event->line);
+    if (next == eEND_GAME)
+    {
+      break;
+    }
+    else if ((next == eSHOW_STATS) || (next == eSEED_GAME))
+    {
+      game_MenuRun(game, next, event->line, output);
+      continue;
+    }
+    else if (next == eGAME_IDLE)
+    {
+      game_Emit(output, GAME_OUT_INCORRECT, 0, NULL);
+      continue;
+    }
+    else if (next == eWAIT_4_KEY1)
+    {
+      game_Emit(output, GAME_OUT_HELP, 0, NULL);
+    }
+    else if (next == eSOLVE_GAME)
+    {
+      game->state = eSOLVE_GAME;
+      game_GenerateSecret(game, game->secret);
+      game_Emit(output, GAME_OUT_SOLVE, 0, game->secret);
+    }
+    else
+    {
+      game->state = eINIT_GAME;
+      game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+      game_Emit(output, GAME_OUT_CLEAR_KEY, KEY2, NULL);
+      game_Emit(output, GAME_OUT_TIMER_LIMIT, TIME_OUT_PERIOD, NULL);
+      game_GenerateSecret(game, game->secret);
+      game->history_moves = 0;
+      game_Emit(output, GAME_OUT_NEW_SECRET, 0, game->secret);
+
+      // one guess a pass until it wins, times out or KEY1 gives up
+      do
+      {
+        game->state = eREQUEST_GUESS;
+        game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+        game_Emit(output, GAME_OUT_CLEAR_KEY, KEY2, NULL);
+        game_Emit(output, GAME_OUT_TIMER_START, SECOND, NULL);
+        game_Emit(output, GAME_OUT_ENTER_GUESS, 0, NULL);
+        game->state = eWAITING_4_USER;
+        COSESSION_AWAIT(session, event, COSESSION_LINE | COSESSION_KEY1 |
+                                        COSESSION_TIMEOUT);
+        if (event->type == GAME_EVENT_KEY1)
+        {
+          game->state = eGAME_IDLE;
+        }
+        else if (event->type == GAME_EVENT_LINE)
+        {
+          game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+          game_TakeGuess(game, event->line, output);
+        }
+        else
+        {
+          game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+          game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+          game->state = eLOSE_GAME;
+        }
+      } while (game->state == eREQUEST_GUESS);
+
+      if (game->state == eGAME_IDLE)
+      {
+        continue;
+      }
+      else if (game->state == eWIN_GAME)
+      {
+        game_Emit(output, GAME_OUT_TIMER_START, QUARTER, NULL);
+        game_Emit(output, GAME_OUT_WINNER, 0, NULL);
+      }
+      else
+      {
+        game_Emit(output, GAME_OUT_LOSER, 0, NULL);
+        game_Emit(output, GAME_OUT_TIMER_START, HALFSEC, NULL);
+        game_Emit(output, GAME_OUT_SECRET_WAS, 0, game->secret);
+      }
+    }
+
+    game_Enter(game, eWAIT_4_KEY1, output);
+    COSESSION_AWAIT(session, event, COSESSION_KEY1);
+  }
+
+  game->state = eEND_GAME;
+  session->awaiting = 0;
+  game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+  game_Emit(output, GAME_OUT_END, 0, NULL);
+  CORO_END(session->point);
+} /* cosession_Resume */
+
+//----------------------------------------------------------------------------
+// NAME: COSESSION Init Scheduler
+//
+// DESCRIPTION:
+//    This function starts a scheduler with nothing to run.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   scheduler - the scheduler
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void cosession_InitScheduler(CoScheduler* scheduler)
+{
+  memset(scheduler, 0, sizeof(CoScheduler));
+}
+
+//----------------------------------------------------------------------------
+// NAME: COSESSION Post
+//
+// DESCRIPTION:
+//    This function gives a session an event and queues it to run.  An event
+//    the session is not waiting for, or one that comes while another is
+//    still queued, is ignored and counted.
+//
+// INPUT:
+//   session - the session
+//   type - the GAME_EVENT_ type
+//   line - the line for GAME_EVENT_LINE, or NULL
+//
+// OUTPUT:
+//   scheduler - the scheduler
+//
+// RETURN:
+//   TRUE if the session was queued
+//----------------------------------------------------------------------------
+int cosession_Post(CoScheduler* scheduler, CoSession* session, uint8 type,
+                   const uint8* line)
+{
+  int i;
+
+  if ((session->pending != GAME_EVENT_NONE) || (type >= 8) ||
+      (((1 << type) & session->awaiting) == 0))
+  {
+    scheduler->ignored++;
+    return FALSE;
+  }
+  session->pending = type;
+  for (i = 0; (line != NULL) && (i < GAME_LINE_MAX) && (line[i] != '\0'); i++)
+  {
+    session->pending_line[i] = line[i];
+  }
+  session->pending_line[i] = '\0';
+
+  session->next = NULL;
+  if (scheduler->tail == NULL)
+  {
+    scheduler->head = session;
+  }
+  else
+  {
+    scheduler->tail->next = session;
+  }
+  scheduler->tail = session;
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: COSESSION Run Ready
+//
+// DESCRIPTION:
+//    This function resumes every queued session with its event and passes
+//    the output on.  Sessions queued by the callback run on the next call.
+//
+// INPUT:
+//   shown - called with each session's output
+//   context - passed to shown
+//
+// OUTPUT:
+//   scheduler - the scheduler
+//
+// RETURN:
+//   the number of sessions resumed
+//----------------------------------------------------------------------------
+long cosession_RunReady(CoScheduler* scheduler, CoShown shown, void* context)
+{
+  CoSession* session = scheduler->head;
+  CoSession* next;
+  GameEvent event;
+  GameOutput output;
+  long resumed = 0;
+  int running;
+
+  scheduler->head = NULL;
+  scheduler->tail = NULL;
+  for (; session != NULL; session = next)
+  {
+    next = session->next;
+    event.type = session->pending;
+    memcpy(event.line, session->pending_line, GAME_LINE_MAX + 1);
+    session->pending = GAME_EVENT_NONE;
+    running = cosession_Resume(session, &event, &output);
+    resumed++;
+    if (shown != NULL)
+    {
+      shown(session, &output, running, context);
+    }
+  }
+  scheduler->resumes += resumed;
+  return resumed;
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: cosession Definitions
+//
+//    FILENAME: cosession.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the coroutine game
+//              sessions and their scheduler.  A session is the game written
+//              as one coroutine that waits for the next line, a key press or
+//              the timeout, so its frame is its GameSession and a resume
+//              point.  The scheduler keeps a queue of the sessions with an
+//              event to run; any number of suspended sessions cost nothing
+//              but their frames.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef COSESSION_MOD_H_
+#define COSESSION_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "coro.h"                     // for the coroutine macros
+#include "game.h"                     // for the game library
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+
+// the events a session may wait for, as a mask of GAME_EVENT_ types
+#define COSESSION_LINE        (1 << GAME_EVENT_LINE)
+#define COSESSION_KEY1        (1 << GAME_EVENT_KEY1)
+#define COSESSION_TIMEOUT     (1 << GAME_EVENT_TIMEOUT)
+
+typedef struct CoSession
+{
+  GameSession       game;             // the state reported to the frontend
+  struct CoSession* next;             // in the scheduler's queue
+  CoroPoint         point;            // where the coroutine goes on
+  uint8             awaiting;         // COSESSION_ mask, 0 once finished
+  uint8             pending;          // GAME_EVENT_ posted, or NONE
+  uint8             pending_line[GAME_LINE_MAX + 1];
+} CoSession;
+
+typedef struct
+{
+  CoSession* head;                    // sessions with an event to run
+  CoSession* tail;
+  long       resumes;
+  long       ignored;                 // events nobody was waiting for
+} CoScheduler;
+
+// called with each session's output; running is FALSE once it finished
+typedef void (*CoShown)(CoSession* session, const GameOutput* output,
+                        int running, void* context);
+
+void cosession_Init(CoSession* session, uint32 seed, GameOutput* output);
+int  cosession_Resume(CoSession* session, const GameEvent* event,
+                      GameOutput* output);
+void cosession_InitScheduler(CoScheduler* scheduler);
+int  cosession_Post(CoScheduler* scheduler, CoSession* session, uint8 type,
+                    const uint8* line);
+long cosession_RunReady(CoScheduler* scheduler, CoShown shown,
+                        void* context);
+
+#endif /*COSESSION_MOD_H_*/
@@ -15,6 +15,16 @@
 // DESCRIPTION: This file contains the functions that displays messages when the
 //              proper function is called.
 //
+//              A message goes to the UART straight from where it is kept,
+//              or, inside display_QueueOutput, onto the caller's output
+//              queue, so a frontend can send the messages of a whole step
+//              at once.  Lines made with sprintf are made in the queue's
+//              scratch space, or in displayLine when there is no queue.
+//
+//              The fixed messages are kept compressed in the message
+//              catalog and expanded a piece at a time in the same places,
+//              so none is ever held whole.
+//
 //*****************************************************************************
 //*****************************************************************************
 
@@ -22,23 +32,36 @@
 //                         Include Files
 //*****************************************************************************
 #include <stdio.h>                    // for NULL
+#include <string.h>                   // for strlen
 #include <sys/alt_irq.h>              // for irq support function
 #include "system.h"                   // for QSYS defines
 #include "nios_std_types.h"           // for standard embedded types
 #include "UART.h"
+#include "score.h"                    // for packed codes and hints
+#include "solver.h"                   // for the auto-solver
+#include "advisor.h"                  // for the hint advisor
+#include "game.h"                     // for the game output items
+#include "outq.h"                     // for the output queue
+#include "msgcat.h"                   // for the fixed messages
+#include "display.h"                  // for display definitions
 
 
 //*****************************************************************************
 //                        Define symbolic constants
 //*****************************************************************************
+#define DISPLAY_LINE_MAX      128     // the longest line made with sprintf,
+                                      // and the piece a message expands in
 
-
+// sends a string literal without counting it
+#define display_PutText(text)  display_Put((text), sizeof(text) - 1)
 
 
 //*****************************************************************************
 //                            Define private data
 //*****************************************************************************
-
+static OutQueue* displayQueue = NULL;  // where messages go, NULL for the UART
+static char      displayLine[DISPLAY_LINE_MAX];
+static uint32    displayHintBudget = GAME_HINT_BUDGET_USEC;
 
 
 //*****************************************************************************
@@ -50,6 +73,231 @@
 //                             private functions
 //*****************************************************************************
 
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Put
+//
+// DESCRIPTION:
+//    This function sends text, or queues it where it is inside
+//    display_QueueOutput.
+//
+// INPUT:
+//   text - the text, which must not change until the queue drains
+//   length - its length
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void display_Put(const char* text, uint32 length)
+{
+  if (displayQueue != NULL)
+  {
+    outq_Add(displayQueue, text, length);
+  }
+  else
+  {
+    uart_Write((const uint8*)text, length);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Line
+//
+// DESCRIPTION:
+//    This function gives the space for a line made with sprintf, which
+//    display_PutLine then sends.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   space for DISPLAY_LINE_MAX bytes
+//----------------------------------------------------------------------------
+static char* display_Line(void)
+{
+  if (displayQueue != NULL)
+  {
+    return outq_Reserve(displayQueue, DISPLAY_LINE_MAX);
+  }
+  return displayLine;
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Put Line
+//
+// DESCRIPTION:
+//    This function sends a line made in the space display_Line gave.
+//
+// INPUT:
+//   line - the line, NULL terminated
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void display_PutLine(const char* line)
+{
+  if (displayQueue != NULL)
+  {
+    outq_Commit(displayQueue, (uint32)strlen(line));
+  }
+  else
+  {
+    uart_Write((const uint8*)line, (uint32)strlen(line));
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Put Message
+//
+// DESCRIPTION:
+//    This function expands a message of the catalog a piece at a time,
+//    into the queue's scratch space inside display_QueueOutput and into
+//    displayLine otherwise, and sends each piece as it is made.  Pieces
+//    made in the scratch space one after another go out as one.
+//
+// INPUT:
+//   id - the message, MSGCAT_...
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void display_PutMessage(uint32 id)
+{
+  MsgCursor cursor;
+  uint32 length;
+  uint8* piece;
+
+  msgcat_Open(&cursor, id);
+  if (displayQueue != NULL)
+  {
+    while (cursor.left > 0)
+    {
+      length = (cursor.left < DISPLAY_LINE_MAX) ? cursor.left :
+                                                  DISPLAY_LINE_MAX;
+      piece = (uint8*)outq_Reserve(displayQueue, length);
+      outq_Commit(displayQueue, msgcat_Read(&cursor, piece, length));
+    }
+  }
+  else
+  {
+    while ((length = msgcat_Read(&cursor, (uint8*)displayLine,
+                                 DISPLAY_LINE_MAX)) > 0)
+    {
+      uart_Write((const uint8*)displayLine, length);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Solve Game
+//
+// DESCRIPTION:
+//    This function lets the auto-solver play against the secret code and
+//    displays every guess with its hint, the number of candidates left
+//    before it and the time taken to choose it.
+//
+// INPUT:
+//   code - the secret code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void display_SolveGame(const uint8* code)
+{
+  SolverResult result;
+  uint16 secret = score_PackCode(code);
+  uint8  guess[NUM_OF_COLORS_INCODE + 1];
+  uint8  hint[NUM_OF_COLORS_INCODE + 1];
+  char*  line;
+  int    solved;
+  int    i;
+
+  solved = solver_Solve(secret, &result);
+  display_PutMessage(MSGCAT_SOLVER_PLAYS);
+  display_DisplayMsg((char*)code);
+  display_PutText("\n");
+
+  for (i = 0; i < result.num_moves; i++)
+  {
+    score_UnpackCode(result.moves[i].guess, guess);
+    score_RenderHint(result.moves[i].guess, secret, hint);
+    line = display_Line();
+    sprintf(line, "Guess %d: %s  hint: %s  candidates: %d  time: %lu us\n",
+            i + 1, (char*)guess, (char*)hint, result.moves[i].candidates,
+            (unsigned long)result.moves[i].usec);
+    display_PutLine(line);
+  }
+
+  line = display_Line();
+  if (solved)
+  {
+    sprintf(line, "Solved in %d guesses, %lu us total\n", solved,
+            (unsigned long)result.total_usec);
+  }
+  else
+  {
+    sprintf(line, "Not solved in %d guesses\n", result.num_moves);
+  }
+  display_PutLine(line);
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Show Hint
+//
+// DESCRIPTION:
+//    This function asks the advisor for the best next guess and displays
+//    it with the information it is expected to give and the number of
+//    secret codes the player's guesses still allow.
+//
+// INPUT:
+//   guesses - the packed guesses played so far
+//   feedbacks - the feedback each guess received
+//   num_moves - the number of guesses played so far
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void display_ShowHint(const uint16* guesses, const uint8* feedbacks,
+                             int num_moves)
+{
+  AdvisorHint hint;
+  uint8 letters[NUM_OF_COLORS_INCODE + 1];
+  char* line;
+
+  if (!advisor_Suggest(guesses, feedbacks, num_moves, displayHintBudget,
+                       &hint))
+  {
+    display_PutMessage(MSGCAT_NO_HINT);
+    return;
+  }
+  score_UnpackCode(hint.guess, letters);
+  line = display_Line();
+  sprintf(line, "\n\nHint: try %s (%lu.%03lu bits).  %d codes are still "
+          "possible.%s", (char*)letters,
+          (unsigned long)(hint.entropy_milli / 1000),
+          (unsigned long)(hint.entropy_milli % 1000), hint.candidates,
+          hint.complete ? "" : "  (partial search)");
+  display_PutLine(line);
+}
+
+
 
 
 
@@ -57,6 +305,28 @@
 //                             public functions
 //*****************************************************************************
 
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Set Hint Budget
+//
+// DESCRIPTION:
+//    This function sets the time the advisor may take for a HINT.  A
+//    frontend that serves many sessions from one thread sets a small
+//    budget, so one HINT does not hold up every other session.
+//
+// INPUT:
+//   budget_usec - the time limit, or ADVISOR_NO_BUDGET
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void display_SetHintBudget(uint32 budget_usec)
+{
+  displayHintBudget = budget_usec;
+}
+
 //----------------------------------------------------------------------------
 // NAME: DISPLAY Display Welcome Message
 //
@@ -74,9 +344,7 @@
 //----------------------------------------------------------------------------
 void display_DisplayWelcomeMsg(void)
 {
-  uart_SendString("\nWelcome to CodeBreaker.  Please type in the option you\n"
-                  "would like to execute.\n\n");
-  uart_SendString("1. PLAY\n2. HELP\n3. EXIT\n\n");
+  display_PutMessage(MSGCAT_WELCOME);
 }/*display_DisplayWelcomeMsg*/
 
 
@@ -97,20 +365,7 @@ void display_DisplayWelcomeMsg(void)
 //----------------------------------------------------------------------------
 void display_DisplayHelpMsg(void)
 {
-  uart_SendString("\nIn CodeBreaker, the goal of the game is to determine a\n"
-                  "4-color code randomly generated by the computer.  There\n"
-                  "are six colors to choose from: Red, Blue, Orange, Yellow,\n"
-                  "Green, and White.  Type in the first initial of each color\n"
-                  "that you think is in the code.  The computer will generate\n"
-                  "a response based on your guess.  If a color is not in the\n"
-                  "code, there will be a '-' in place of the color.  If a\n"
-                  "color is in the code, but out of position, a 'C' will\n"
-                  "replace the color in that position.  If a color that is\n"
-                  "in the code is in the correct position, a 'P' will replace\n"
-                  "the color in that position.  Remember, you have 60 seconds\n"
-                  "to make each guess, otherwise you lose the game.  Press\n"
-                  "Key 1 on the DE2 Board at any time to return to the main\n"
-                  "menu.\n\n");
+  display_PutMessage(MSGCAT_HELP);
 }
 
 //----------------------------------------------------------------------------
@@ -130,7 +385,7 @@ void display_DisplayHelpMsg(void)
 //----------------------------------------------------------------------------
 void display_DisplayWinnerMsg(void)
 {
-  uart_SendString("\nCongratulations. You guessed the correct code.\n");
+  display_PutMessage(MSGCAT_WINNER);
 }
 
 //----------------------------------------------------------------------------
@@ -150,7 +405,7 @@ void display_DisplayWinnerMsg(void)
 //----------------------------------------------------------------------------
 void display_DisplayLoserMsg(void)
 {
-  uart_SendString("You have ran out of time.  Sorry, you lose.\n");
+  display_PutMessage(MSGCAT_LOSER);
 }
 
 //----------------------------------------------------------------------------
@@ -170,7 +425,7 @@ void display_DisplayLoserMsg(void)
 //----------------------------------------------------------------------------
 void display_DisplayMsg(char* message)
 {
-  uart_SendString(message);
+  display_Put(message, (uint32)strlen(message));
 }
 
 //----------------------------------------------------------------------------
@@ -190,5 +445,114 @@ void display_DisplayMsg(char* message)
 //----------------------------------------------------------------------------
 void display_DisplayEndMsg(void)
 {
-  uart_SendString("Thank you for playing.  Goodbye.\n\n");
+  display_PutMessage(MSGCAT_END);
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Display Output
+//
+// DESCRIPTION:
+//    This function will output the message of an item produced by a step
+//    of the game, to the UART or, inside display_QueueOutput, to its
+//    queue.  Items that are not messages, such as the timer and key
+//    actions, are left to the caller.
+//
+// INPUT:
+//   session - the session that was stepped
+//   item - the item
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void display_DisplayOutput(const GameSession* session,
+                           const GameOutputItem* item)
+{
+  switch (item->type)
+  {
+  case GAME_OUT_WELCOME:
+    display_DisplayWelcomeMsg();
+    break;
+  case GAME_OUT_HELP:
+    display_DisplayHelpMsg();
+    break;
+  case GAME_OUT_INCORRECT:
+    display_PutMessage(MSGCAT_INCORRECT);
+    break;
+  case GAME_OUT_NEW_SECRET:
+    #if(DEBUG_ENABLE)
+      display_PutText("Secret Code = ");
+      display_DisplayMsg((char*)item->text);
+      display_PutText("\n");
+    #endif
+    break;
+  case GAME_OUT_ENTER_GUESS:
+    display_PutMessage(MSGCAT_ENTER_GUESS);
+    break;
+  case GAME_OUT_WRONG_GUESS:
+    display_PutMessage(MSGCAT_WRONG_GUESS);
+    display_DisplayMsg((char*)item->text);
+    display_PutMessage(MSGCAT_HINT_WAS);
+    display_DisplayMsg((char*)item->hint);
+    break;
+  case GAME_OUT_HINT:
+    display_ShowHint(session->history_guesses, session->history_feedbacks,
+                     session->history_moves);
+    break;
+  case GAME_OUT_NO_HISTORY:
+    display_PutMessage(MSGCAT_NO_HISTORY);
+    break;
+  case GAME_OUT_WINNER:
+    display_DisplayWinnerMsg();
+    break;
+  case GAME_OUT_LOSER:
+    display_DisplayLoserMsg();
+    break;
+  case GAME_OUT_SECRET_WAS:
+    display_PutMessage(MSGCAT_SECRET_WAS);
+    display_DisplayMsg((char*)item->text);
+    break;
+  case GAME_OUT_PRESS_KEY1:
+    display_PutMessage(MSGCAT_PRESS_KEY1);
+    break;
+  case GAME_OUT_SOLVE:
+    display_SolveGame(item->text);
+    break;
+  case GAME_OUT_SEED:
+    display_PutMessage(MSGCAT_SEEDED);
+    break;
+  case GAME_OUT_END:
+    display_DisplayEndMsg();
+    break;
+  } /* switch */
+}
+
+//----------------------------------------------------------------------------
+// NAME: DISPLAY Queue Output
+//
+// DESCRIPTION:
+//    This function puts the message of an item on an output queue instead
+//    of sending it.  The item and the session must not change until the
+//    queue drains, since the message may point into them.
+//
+// INPUT:
+//   session - the session that was stepped
+//   item - the item
+//
+// OUTPUT:
+//   queue - the output queue
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void display_QueueOutput(OutQueue* queue, const GameSession* session,
+                         const GameOutputItem* item)
+{
+  OutQueue* outer = displayQueue;
+
+  displayQueue = queue;
+  display_DisplayOutput(session, item);
+  displayQueue = outer;
 }
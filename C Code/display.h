@@ -21,13 +21,20 @@
 #define DISPLAY_MOD_H_
 
 #include "nios_std_types.h"           // for standard embedded types
+#include "game.h"                     // for the game output items
+#include "outq.h"                     // for the output queue
 
+void display_SetHintBudget(uint32 budget_usec);
 void display_DisplayWelcomeMsg(void);
 void display_DisplayHelpMsg(void);
 void display_DisplayWinnerMsg(void);
 void display_DisplayLoserMsg(void);
 void display_DisplayMsg(char* message);
 void display_DisplayEndMsg(void);
+void display_DisplayOutput(const GameSession* session,
+                           const GameOutputItem* item);
+void display_QueueOutput(OutQueue* queue, const GameSession* session,
+                         const GameOutputItem* item);
 
 #endif /*DISPLAY_MOD_H_*/
 
@@ -0,0 +1,76 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: engine Functions
+//
+//    FILENAME: engine.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file builds the specialized engine for every game
+//              configuration listed in ENGINE_CONFIGS.  Each block below
+//              sets the configuration and includes engine_tmpl.h, which
+//              expands to that configuration's scoring, generation and
+//              letter conversion functions.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "nios_std_types.h"           // for standard embedded types
+#include "rng.h"                      // for the random number generator
+#include "engine.h"                   // for engine definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define ENGINE_UNROLL_1(M)    M(0)
+#define ENGINE_UNROLL_2(M)    ENGINE_UNROLL_1(M) M(1)
+#define ENGINE_UNROLL_3(M)    ENGINE_UNROLL_2(M) M(2)
+#define ENGINE_UNROLL_4(M)    ENGINE_UNROLL_3(M) M(3)
+#define ENGINE_UNROLL_5(M)    ENGINE_UNROLL_4(M) M(4)
+#define ENGINE_UNROLL_6(M)    ENGINE_UNROLL_5(M) M(5)
+#define ENGINE_UNROLL_7(M)    ENGINE_UNROLL_6(M) M(6)
+#define ENGINE_UNROLL_8(M)    ENGINE_UNROLL_7(M) M(7)
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+
+// the first six match GenerateSecretCode; P and C are left out because
+// they are hint letters
+static const uint8 engineColorLetters[ENGINE_MAX_COLORS] =
+  {'G', 'B', 'R', 'O', 'Y', 'W', 'K', 'V', 'M', 'T'};
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+#define ENGINE_NAME     4x6
+#define ENGINE_PEGS     4
+#define ENGINE_COLORS   6
+#define ENGINE_REPEATS  0
+#include "engine_tmpl.h"
+
+#define ENGINE_NAME     5x8
+#define ENGINE_PEGS     5
+#define ENGINE_COLORS   8
+#define ENGINE_REPEATS  1
+#include "engine_tmpl.h"
+
+#define ENGINE_NAME     6x10
+#define ENGINE_PEGS     6
+#define ENGINE_COLORS   10
+#define ENGINE_REPEATS  0
+#include "engine_tmpl.h"
@@ -0,0 +1,93 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: engine Definitions
+//
+//    FILENAME: engine.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the list of game configurations and the
+//              definitions of the specialized engine built for each one in
+//              engine.c.  A configuration is a number of pegs, a number of
+//              colors and whether a code may repeat a color.  Every
+//              configuration gets its own constants and its own unrolled
+//              functions, named after it, e.g. engine_Score5x8.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef ENGINE_MOD_H_
+#define ENGINE_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "rng.h"                      // for the random number generator
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+
+//                  name   pegs colors repeats
+#define ENGINE_CONFIGS(X)      \
+                  X(4x6,    4,    6,    0)  \
+                  X(5x8,    5,    8,    1)  \
+                  X(6x10,   6,   10,    0)
+
+#define ENGINE_MAX_PEGS       8
+#define ENGINE_MAX_COLORS     10
+#define ENGINE_INVALID_CODE   0xFFFFFFFF
+
+#define ENGINE_CAT_(a, b)     a##b
+#define ENGINE_CAT(a, b)      ENGINE_CAT_(a, b)
+
+// bits needed to hold one color number
+#define ENGINE_BITS(colors)   (((colors) <= 8) ? 3 : 4)
+
+// colors ^ pegs and colors! / (colors - pegs)!, for up to ENGINE_MAX_PEGS
+#define ENGINE_FACTOR_(pegs, n, value)  (((pegs) > (n)) ? (value) : 1)
+#define ENGINE_POW(pegs, c)                                           \
+  (ENGINE_FACTOR_(pegs, 0, c) * ENGINE_FACTOR_(pegs, 1, c) *          \
+   ENGINE_FACTOR_(pegs, 2, c) * ENGINE_FACTOR_(pegs, 3, c) *          \
+   ENGINE_FACTOR_(pegs, 4, c) * ENGINE_FACTOR_(pegs, 5, c) *          \
+   ENGINE_FACTOR_(pegs, 6, c) * ENGINE_FACTOR_(pegs, 7, c))
+#define ENGINE_PERM(pegs, c)                                          \
+  (ENGINE_FACTOR_(pegs, 0, (c)) * ENGINE_FACTOR_(pegs, 1, (c) - 1) *  \
+   ENGINE_FACTOR_(pegs, 2, (c) - 2) * ENGINE_FACTOR_(pegs, 3, (c) - 3) * \
+   ENGINE_FACTOR_(pegs, 4, (c) - 4) * ENGINE_FACTOR_(pegs, 5, (c) - 5) * \
+   ENGINE_FACTOR_(pegs, 6, (c) - 6) * ENGINE_FACTOR_(pegs, 7, (c) - 7))
+#define ENGINE_NUM_CODES(pegs, colors, repeats)                       \
+  ((repeats) ? ENGINE_POW(pegs, colors) : ENGINE_PERM(pegs, colors))
+
+// feedback is (exact, color-only) packed as exact * (pegs + 1) + color
+#define ENGINE_NUM_FEEDBACKS(pegs)  (((pegs) + 1) * ((pegs) + 1))
+
+// a pattern is the P/C/- hint, one base 3 digit per peg as in score.h
+#define ENGINE_NUM_PATTERNS(pegs)   ENGINE_POW(pegs, 3)
+
+#define ENGINE_DECLARE(name, pegs, colors, repeats)                   \
+  enum                                                                \
+  {                                                                   \
+    ENGINE_PEGS_##name          = (pegs),                             \
+    ENGINE_COLORS_##name        = (colors),                           \
+    ENGINE_REPEATS_##name       = (repeats),                          \
+    ENGINE_NUM_CODES_##name     = ENGINE_NUM_CODES(pegs, colors, repeats), \
+    ENGINE_NUM_FEEDBACKS_##name = ENGINE_NUM_FEEDBACKS(pegs),         \
+    ENGINE_NUM_PATTERNS_##name  = ENGINE_NUM_PATTERNS(pegs)           \
+  };                                                                  \
+  uint8  engine_Score##name(uint32 guess, uint32 secret);             \
+  uint16 engine_Pattern##name(uint32 guess, uint32 secret);           \
+  uint32 engine_Generate##name(RngState* rng);                        \
+  void   engine_GenerateBulk##name(RngState* rng, uint32* codes,      \
+                                   int count);                        \
+  uint32 engine_Pack##name(const uint8* letters);                     \
+  void   engine_Unpack##name(uint32 code, uint8* letters);            \
+  int    engine_ListCodes##name(uint32* codes);
+
+ENGINE_CONFIGS(ENGINE_DECLARE)
+
+#endif /*ENGINE_MOD_H_*/
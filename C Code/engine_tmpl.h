@@ -0,0 +1,326 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: engine Template
+//
+//    FILENAME: engine_tmpl.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the body of the specialized engine.  It
+//              has no include guard: engine.c includes it once per game
+//              configuration with ENGINE_NAME, ENGINE_PEGS, ENGINE_COLORS
+//              and ENGINE_REPEATS defined, and every loop over the pegs is
+//              unrolled by the preprocessor for that configuration.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#define ENGINE_FN(fn)         ENGINE_CAT(engine_##fn, ENGINE_NAME)
+#define ENGINE_PEG_BITS       ENGINE_BITS(ENGINE_COLORS)
+#define ENGINE_PEG_MASK       ((1u << ENGINE_PEG_BITS) - 1)
+#define ENGINE_PEG(code, i)   (((code) >> ((i) * ENGINE_PEG_BITS)) & \
+                               ENGINE_PEG_MASK)
+#define ENGINE_UNROLL(M)      ENGINE_CAT(ENGINE_UNROLL_, ENGINE_PEGS)(M)
+
+// the instance must match its entry in ENGINE_CONFIGS
+typedef char ENGINE_CAT(engineCheck, ENGINE_NAME)
+  [((ENGINE_CAT(ENGINE_PEGS_, ENGINE_NAME) == ENGINE_PEGS) &&
+    (ENGINE_CAT(ENGINE_COLORS_, ENGINE_NAME) == ENGINE_COLORS) &&
+    (ENGINE_CAT(ENGINE_REPEATS_, ENGINE_NAME) == ENGINE_REPEATS) &&
+    (ENGINE_PEGS <= ENGINE_MAX_PEGS) &&
+    (ENGINE_COLORS <= ENGINE_MAX_COLORS)) ? 1 : -1];
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE Score
+//
+// DESCRIPTION:
+//    This function computes the feedback of a guess against a secret with
+//    the compareCode rules.  A mask of the colors in the secret is built
+//    first, so each guess peg is scored with one compare and one bit test.
+//
+// INPUT:
+//   guess - the packed guess
+//   secret - the packed secret code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed feedback
+//----------------------------------------------------------------------------
+#define ENGINE_MARK_PEG(i)    present |= 1u << ENGINE_PEG(secret, i);
+#define ENGINE_SCORE_PEG(i)                                             \
+  {                                                                     \
+    uint32 peg = ENGINE_PEG(guess, i);                                  \
+    uint32 hit = (peg == ENGINE_PEG(secret, i));                        \
+    exact += hit;                                                       \
+    color += ((present >> peg) & 1) & (hit ^ 1);                        \
+  }
+
+uint8 ENGINE_FN(Score)(uint32 guess, uint32 secret)
+{
+  uint32 present = 0;
+  uint32 exact = 0;
+  uint32 color = 0;
+
+  ENGINE_UNROLL(ENGINE_MARK_PEG)
+  ENGINE_UNROLL(ENGINE_SCORE_PEG)
+  return (uint8)(exact * (ENGINE_PEGS + 1) + color);
+}
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE Pattern
+//
+// DESCRIPTION:
+//    This function computes the P/C/- hint of a guess against a secret as
+//    a packed pattern, with the same mask of secret colors as
+//    ENGINE_FN(Score).  A peg adds its digit weight once if its color is
+//    in the secret and once more if it is in place.
+//
+// INPUT:
+//   guess - the packed guess
+//   secret - the packed secret code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed pattern
+//----------------------------------------------------------------------------
+#define ENGINE_PATTERN_PEG(i)                                           \
+  {                                                                     \
+    uint32 peg = ENGINE_PEG(guess, i);                                  \
+    pattern += (((present >> peg) & 1) +                                \
+                (peg == ENGINE_PEG(secret, i))) * weight;               \
+    weight *= 3;                                                        \
+  }
+
+uint16 ENGINE_FN(Pattern)(uint32 guess, uint32 secret)
+{
+  uint32 present = 0;
+  uint32 pattern = 0;
+  uint32 weight = 1;
+
+  ENGINE_UNROLL(ENGINE_MARK_PEG)
+  ENGINE_UNROLL(ENGINE_PATTERN_PEG)
+  return (uint16)pattern;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE Generate
+//
+// DESCRIPTION:
+//    This function creates a random secret code.  When colors may not
+//    repeat, a partial shuffle of the colors picks one unused color per peg,
+//    so there are always exactly ENGINE_PEGS draws.
+//
+// INPUT:
+//   rng - the random number generator
+//
+// OUTPUT:
+//   rng - the advanced generator state
+//
+// RETURN:
+//   the packed secret code
+//----------------------------------------------------------------------------
+#define ENGINE_DRAW_PEG(i)                                              \
+  code |= rng_Bounded(rng, ENGINE_COLORS) << ((i) * ENGINE_PEG_BITS);
+#define ENGINE_PICK_PEG(i)                                              \
+  {                                                                     \
+    int pick = (i) + (int)rng_Bounded(rng, ENGINE_COLORS - (i));        \
+    uint8 color = colors[pick];                                         \
+    colors[pick] = colors[i];                                           \
+    colors[i] = color;                                                  \
+    code |= (uint32)color << ((i) * ENGINE_PEG_BITS);                   \
+  }
+
+uint32 ENGINE_FN(Generate)(RngState* rng)
+{
+  uint32 code = 0;
+#if ENGINE_REPEATS
+  ENGINE_UNROLL(ENGINE_DRAW_PEG)
+#else
+  uint8 colors[ENGINE_COLORS];
+  int c;
+  for (c = 0; c < ENGINE_COLORS; c++)
+  {
+    colors[c] = (uint8)c;
+  }
+  ENGINE_UNROLL(ENGINE_PICK_PEG)
+#endif
+  return code;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE Generate Bulk
+//
+// DESCRIPTION:
+//    This function fills an array with random secret codes.
+//
+// INPUT:
+//   rng - the random number generator
+//   count - the number of codes to create
+//
+// OUTPUT:
+//   rng - the advanced generator state
+//   codes - the packed secret codes
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void ENGINE_FN(GenerateBulk)(RngState* rng, uint32* codes, int count)
+{
+  int n;
+  for (n = 0; n < count; n++)
+  {
+    codes[n] = ENGINE_FN(Generate)(rng);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE Pack
+//
+// DESCRIPTION:
+//    This function converts a string of color letters into a packed code.
+//
+// INPUT:
+//   letters - the color letters, one per peg
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed code, or ENGINE_INVALID_CODE if a letter is not a color
+//----------------------------------------------------------------------------
+uint32 ENGINE_FN(Pack)(const uint8* letters)
+{
+  uint32 code = 0;
+  int i;
+  int c;
+
+  for (i = 0; i < ENGINE_PEGS; i++)
+  {
+    for (c = 0; c < ENGINE_COLORS; c++)
+    {
+      if (engineColorLetters[c] == letters[i])
+      {
+        break;
+      }
+    }
+    if (c == ENGINE_COLORS)
+    {
+      return ENGINE_INVALID_CODE;
+    }
+    code |= (uint32)c << (i * ENGINE_PEG_BITS);
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE Unpack
+//
+// DESCRIPTION:
+//    This function converts a packed code into a NULL terminated string of
+//    color letters.
+//
+// INPUT:
+//   code - the packed code
+//
+// OUTPUT:
+//   letters - the color letters, must hold ENGINE_PEGS + 1 bytes
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+#define ENGINE_UNPACK_PEG(i)  letters[i] =                            \
+                                engineColorLetters[ENGINE_PEG(code, i)];
+
+void ENGINE_FN(Unpack)(uint32 code, uint8* letters)
+{
+  ENGINE_UNROLL(ENGINE_UNPACK_PEG)
+  letters[ENGINE_PEGS] = '\0';
+}
+
+//----------------------------------------------------------------------------
+// NAME: ENGINE List Codes
+//
+// DESCRIPTION:
+//    This function lists every secret code of the configuration in
+//    increasing packed order, skipping codes that repeat a color when
+//    repeats are not allowed.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   codes - the packed codes, must hold the configuration's number of codes
+//
+// RETURN:
+//   the number of codes listed
+//----------------------------------------------------------------------------
+int ENGINE_FN(ListCodes)(uint32* codes)
+{
+  uint8 digits[ENGINE_PEGS];
+  int count = 0;
+  int i;
+
+  for (i = 0; i < ENGINE_PEGS; i++)
+  {
+    digits[i] = 0;
+  }
+  for (;;)
+  {
+    uint32 code = 0;
+    uint32 used = 0;
+    int valid = TRUE;
+    for (i = 0; i < ENGINE_PEGS; i++)
+    {
+      if (!ENGINE_REPEATS && ((used >> digits[i]) & 1))
+      {
+        valid = FALSE;
+      }
+      used |= 1u << digits[i];
+      code |= (uint32)digits[i] << (i * ENGINE_PEG_BITS);
+    }
+    if (valid)
+    {
+      codes[count++] = code;
+    }
+
+    // count up with peg 0 as the lowest digit, which keeps packed order
+    for (i = 0; i < ENGINE_PEGS; i++)
+    {
+      if (++digits[i] < ENGINE_COLORS)
+      {
+        break;
+      }
+      digits[i] = 0;
+    }
+    if (i == ENGINE_PEGS)
+    {
+      return count;
+    }
+  }
+}
+
+#undef ENGINE_FN
+#undef ENGINE_PEG_BITS
+#undef ENGINE_PEG_MASK
+#undef ENGINE_PEG
+#undef ENGINE_UNROLL
+#undef ENGINE_MARK_PEG
+#undef ENGINE_SCORE_PEG
+#undef ENGINE_PATTERN_PEG
+#undef ENGINE_DRAW_PEG
+#undef ENGINE_PICK_PEG
+#undef ENGINE_UNPACK_PEG
+#undef ENGINE_NAME
+#undef ENGINE_PEGS
+#undef ENGINE_COLORS
+#undef ENGINE_REPEATS
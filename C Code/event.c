@@ -0,0 +1,188 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: event Functions
+//
+//    FILENAME: event.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the event queue.  It is a ring that the
+//              ISRs add to and the main loop takes from.  The ISRs do not
+//              interrupt each other, so there is one writer at a time and
+//              neither side needs a lock: the writer only moves the tail and
+//              the reader only moves the head.
+//
+//              When the queue is empty event_Wait calls EVENT_IDLE, and
+//              event_Post calls EVENT_WAKE after adding an event.  On the
+//              board both do nothing and the wait spins, as the Nios II has
+//              no instruction that waits for an interrupt; a BSP with a
+//              low power mode can define EVENT_IDLE to enter it, and a host
+//              build sleeps and wakes a thread in them.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "system.h"                   // for QSYS defines
+#include "nios_std_types.h"           // for standard embedded types
+#include "event.h"                    // for event definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#ifndef EVENT_IDLE
+#define EVENT_IDLE()
+#endif
+
+#ifndef EVENT_WAKE
+#define EVENT_WAKE()
+#endif
+
+// order the ring between the ISRs and the main loop: the tail is published
+// after the entry is written and read before the entry is copied, and the
+// head after the entry is copied; on a host they order the threads as well
+#define EVENT_LOAD_ACQUIRE(index)         __atomic_load_n(&(index), \
+                                                          __ATOMIC_ACQUIRE)
+#define EVENT_STORE_RELEASE(index, value) __atomic_store_n(&(index), \
+                                                           (value), \
+                                                           __ATOMIC_RELEASE)
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static EventItem       eventQueue[EVENT_QUEUE_SIZE];
+static volatile uint32 eventHead = 0;  // next event to take
+static volatile uint32 eventTail = 0;  // next free entry
+static volatile uint32 eventDropped = 0;
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: EVENT Post
+//
+// DESCRIPTION:
+//    This function adds an event to the queue.  It is called from the ISRs.
+//    When the queue is full the event is dropped and counted.
+//
+// INPUT:
+//   type - the EVENT_ type
+//   line - the line for EVENT_LINE, or NULL
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void event_Post(uint8 type, const uint8* line)
+{
+  uint32 tail = eventTail;
+  EventItem* item;
+  int i;
+
+  if (tail - EVENT_LOAD_ACQUIRE(eventHead) >= EVENT_QUEUE_SIZE)
+  {
+    eventDropped++;
+    return;
+  }
+  item = &eventQueue[tail & (EVENT_QUEUE_SIZE - 1)];
+  item->type = type;
+  for (i = 0; i < EVENT_LINE_MAX; i++)
+  {
+    item->line[i] = (line != NULL) ? line[i] : 0;
+  }
+  item->line[EVENT_LINE_MAX] = 0;
+  EVENT_STORE_RELEASE(eventTail, tail + 1);
+  EVENT_WAKE();
+}
+
+//----------------------------------------------------------------------------
+// NAME: EVENT Get
+//
+// DESCRIPTION:
+//    This function takes the oldest event from the queue, if there is one.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   item - the event
+//
+// RETURN:
+//   TRUE if an event was taken, FALSE if the queue was empty
+//----------------------------------------------------------------------------
+int event_Get(EventItem* item)
+{
+  uint32 head = eventHead;
+
+  if (head == EVENT_LOAD_ACQUIRE(eventTail))
+  {
+    return FALSE;
+  }
+  *item = eventQueue[head & (EVENT_QUEUE_SIZE - 1)];
+  EVENT_STORE_RELEASE(eventHead, head + 1);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: EVENT Wait
+//
+// DESCRIPTION:
+//    This function takes the oldest event from the queue, idling until
+//    there is one.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   item - the event
+//
+// RETURN:
+//   the number of times the queue was found empty, which varies with the
+//   time the event took to come
+//----------------------------------------------------------------------------
+uint32 event_Wait(EventItem* item)
+{
+  uint32 idle = 0;
+
+  while (!event_Get(item))
+  {
+    idle++;
+    EVENT_IDLE();
+  }
+  return idle;
+}
+
+//----------------------------------------------------------------------------
+// NAME: EVENT Dropped
+//
+// DESCRIPTION:
+//    This function returns the number of events lost to a full queue.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of events dropped
+//----------------------------------------------------------------------------
+uint32 event_Dropped(void)
+{
+  return eventDropped;
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: event Definitions
+//
+//    FILENAME: event.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the event queue that
+//              connects the interrupt service routines to the main loop.
+//              The key, UART and timer ISRs post what happened and the main
+//              loop takes the events one at a time, so it never waits on one
+//              device while another has something to say.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef EVENT_MOD_H_
+#define EVENT_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define EVENT_NONE            0
+#define EVENT_KEY1            1       // KEY1 was pressed
+#define EVENT_KEY2            2       // KEY2 was pressed
+#define EVENT_LINE            3       // RETURN ended a line, which is in line
+#define EVENT_TICK            4       // the guess timer counted a second
+#define EVENT_TIMEOUT         5       // the guess timer reached zero
+#define EVENT_RX              6       // the UART received characters
+
+#define EVENT_QUEUE_SIZE      16      // power of two
+#define EVENT_LINE_MAX        16      // characters the UART keeps of a line
+
+typedef struct
+{
+  uint8 type;                         // EVENT_...
+  uint8 line[EVENT_LINE_MAX + 1];     // for EVENT_LINE, NULL terminated
+} EventItem;
+
+void   event_Post(uint8 type, const uint8* line);
+int    event_Get(EventItem* item);
+uint32 event_Wait(EventItem* item);
+uint32 event_Dropped(void);
+
+#endif /*EVENT_MOD_H_*/
@@ -0,0 +1,145 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: fmat Functions
+//
+//    FILENAME: fmat.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the functions that check a feedback
+//              matrix held in memory and set up a view of it for
+//              FMAT_LOOKUP.  Opening only reads the header, so the cost of
+//              a mapped matrix is the pages that are later looked up.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memcmp
+#include "nios_std_types.h"           // for standard embedded types
+#include "fmat.h"                     // for feedback matrix definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: FMAT Open
+//
+// DESCRIPTION:
+//    This function checks the header of a feedback matrix and sets up a
+//    view of it.  The matrix is rejected if its magic, version or tiling
+//    is wrong, if it is for another configuration, or if its code list
+//    and tiles do not fit in the bytes given.
+//
+// INPUT:
+//   file - the start of the matrix
+//   size - the number of bytes available
+//   pegs - the number of pegs of the configuration
+//   colors - the number of colors of the configuration
+//   repeats - TRUE if codes of the configuration may repeat a color
+//
+// OUTPUT:
+//   view - the view used by FMAT_LOOKUP
+//
+// RETURN:
+//   TRUE on success, FALSE if the matrix is bad or for another game
+//----------------------------------------------------------------------------
+int fmat_Open(FmatView* view, const void* file, unsigned long long size,
+              int pegs, int colors, int repeats)
+{
+  const FmatHeader* header = (const FmatHeader*)file;
+  unsigned long long tiles_per_row;
+
+  if ((size < sizeof(FmatHeader)) ||
+      (0 != memcmp(header->magic, FMAT_MAGIC, sizeof(FMAT_MAGIC))) ||
+      (header->version != FMAT_VERSION) ||
+      (header->tile_bits != FMAT_TILE_BITS) || (header->pegs != pegs) ||
+      (header->colors != colors) || (header->repeats != repeats))
+  {
+    return FALSE;
+  }
+
+  tiles_per_row = (header->num_codes + FMAT_TILE - 1) / FMAT_TILE;
+  if ((header->tiles_per_row != tiles_per_row) ||
+      (header->data_tiles != tiles_per_row * tiles_per_row) ||
+      ((header->data_offset % FMAT_PAGE) != 0) ||
+      (header->codes_offset < sizeof(FmatHeader)) ||
+      (header->codes_offset + 4ULL * header->num_codes >
+       header->data_offset) ||
+      (header->data_offset + (unsigned long long)header->data_tiles *
+       FMAT_TILE_BYTES != size))
+  {
+    return FALSE;
+  }
+
+  view->header = header;
+  view->codes = (const uint32*)((const uint8*)file + header->codes_offset);
+  view->data = (const uint8*)file + header->data_offset;
+  view->tiles_per_row = header->tiles_per_row;
+  return TRUE;
+} /* fmat_Open */
+
+//----------------------------------------------------------------------------
+// NAME: FMAT Check
+//
+// DESCRIPTION:
+//    This function checks a matrix against the scoring rules of the game.
+//    The code list must match the configuration's own, and a spread of
+//    pairs, plus every pair of the first guess, must hold the feedback the
+//    configuration's scorer gives.  The rest of the matrix is not read, so
+//    its pages are not faulted in.
+//
+// INPUT:
+//   view - the view, from fmat_Open
+//   codes - every code of the configuration
+//   score - the configuration's scorer, with the compareCode rules
+//   samples - the number of spread pairs to check
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the matrix matches the rules, else FALSE
+//----------------------------------------------------------------------------
+int fmat_Check(const FmatView* view, const uint32* codes,
+               uint8 (*score)(uint32 guess, uint32 secret), int samples)
+{
+  uint32 num_codes = view->header->num_codes;
+  uint32 n;
+
+  if (0 != memcmp(view->codes, codes, sizeof(uint32) * num_codes))
+  {
+    return FALSE;
+  }
+  for (n = 0; n < num_codes; n++)
+  {
+    if (FMAT_LOOKUP(view, 0, n) != score(codes[0], codes[n]))
+    {
+      return FALSE;
+    }
+  }
+  for (n = 0; n < (uint32)samples; n++)
+  {
+    // two large primes walk the matrix without a pattern
+    uint32 guess = (uint32)(((unsigned long long)n * 7919) % num_codes);
+    uint32 secret = (uint32)(((unsigned long long)n * 104729 + 1) %
+                             num_codes);
+    if (FMAT_LOOKUP(view, guess, secret) !=
+        score(codes[guess], codes[secret]))
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+} /* fmat_Check */
@@ -0,0 +1,94 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: fmat Definitions
+//
+//    FILENAME: fmat.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the layout of the feedback matrix file
+//              and the functions that read it.  The matrix holds the packed
+//              compareCode feedback of every (guess, secret) pair of codes
+//              of one configuration, one byte per pair.  It is built
+//              offline by mkfmat and used straight from a read-only mapping,
+//              so processes share its pages and nothing is computed at
+//              start up.
+//
+//              The pairs are stored in square tiles of FMAT_TILE x FMAT_TILE
+//              bytes, one page each, in row major order of tiles.  A run of
+//              guesses or of secrets that are close in code order then
+//              stays within a few pages, whichever way it is read:
+//
+//                FmatHeader
+//                uint32 codes[num_codes]   at codes_offset, in index order
+//                tiles                     at data_offset, page aligned,
+//                                          tiles_per_row ^ 2 of them
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef FMAT_MOD_H_
+#define FMAT_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define FMAT_MAGIC            "CBFMAT1"
+#define FMAT_VERSION          1
+#define FMAT_TILE_BITS        6
+#define FMAT_TILE             (1 << FMAT_TILE_BITS)
+#define FMAT_TILE_BYTES       (FMAT_TILE * FMAT_TILE)
+#define FMAT_PAGE             4096
+#define FMAT_PAD              0xFF    // feedback of the padding pairs
+
+typedef struct
+{
+  char   magic[8];                    // FMAT_MAGIC, NULL terminated
+  uint32 version;                     // FMAT_VERSION
+  uint8  pegs;                        // the configuration
+  uint8  colors;
+  uint8  repeats;
+  uint8  tile_bits;                   // FMAT_TILE_BITS
+  uint32 num_codes;                   // guesses and secrets
+  uint32 num_feedbacks;               // feedback values
+  uint32 tiles_per_row;               // num_codes / FMAT_TILE, rounded up
+  uint32 codes_offset;                // offset of the code list
+  uint32 data_offset;                 // offset of the first tile
+  uint32 data_tiles;                  // tiles_per_row ^ 2
+} FmatHeader;
+
+typedef struct
+{
+  const FmatHeader* header;
+  const uint32*     codes;
+  const uint8*      data;
+  uint32            tiles_per_row;
+} FmatView;
+
+// the byte offset of a pair within the tiles, which passes 4 GB for 6x10
+#define FMAT_OFFSET(tiles_per_row, guess, secret)                       \
+  ((unsigned long long)(((uint32)(guess) >> FMAT_TILE_BITS) *           \
+                        (tiles_per_row) +                               \
+                        ((uint32)(secret) >> FMAT_TILE_BITS)) *         \
+   FMAT_TILE_BYTES +                                                    \
+   (((uint32)(guess) & (FMAT_TILE - 1)) << FMAT_TILE_BITS) +            \
+   ((uint32)(secret) & (FMAT_TILE - 1)))
+
+// the feedback of a guess index against a secret index
+#define FMAT_LOOKUP(view, guess, secret)                                \
+  ((view)->data[FMAT_OFFSET((view)->tiles_per_row, guess, secret)])
+
+int fmat_Open(FmatView* view, const void* file, unsigned long long size,
+              int pegs, int colors, int repeats);
+int fmat_Check(const FmatView* view, const uint32* codes,
+               uint8 (*score)(uint32 guess, uint32 secret), int samples);
+
+#endif /*FMAT_MOD_H_*/
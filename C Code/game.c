@@ -0,0 +1,533 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: game Functions
+//
+//    FILENAME: game.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the CodeBreaker state machine as a
+//              library.  It has no data of its own: every function works on
+//              the session it is given, so sessions may be stepped from any
+//              number of threads as long as each session has one owner.
+//              score_Init must have run before the first session is used.
+//
+//              game_Step runs one pass of the state machine, like one pass
+//              of the loop in Main.c.  The states that wait for the player
+//              (eGAME_IDLE, eWAITING_4_USER and eWAIT_4_KEY1) only move on
+//              an event and show their prompt when they are entered; the
+//              other states run on any event.  The coroutine sessions in
+//              cosession.c build the same output with game_Emit,
+//              game_Enter, game_MenuRun and game_TakeGuess.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for strcmp
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes and feedback
+#include "engine.h"                   // for the specialized engine
+#include "rng.h"                      // for the random number generator
+#include "game.h"                     // for game definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define GAME_SEED_COMMAND  "SEED "
+#define GAME_SEED_DIGITS   10         // enough for any uint32
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: GAME Parse Seed
+//
+// DESCRIPTION:
+//    This function reads the number of a SEED command: SEED, one space and
+//    up to GAME_SEED_DIGITS digits that fit in a uint32.
+//
+// INPUT:
+//   command - the line typed by the user
+//
+// OUTPUT:
+//   seed - the number
+//
+// RETURN:
+//   TRUE if the line is a SEED command
+//----------------------------------------------------------------------------
+static int game_ParseSeed(const uint8* command, uint32* seed)
+{
+  unsigned long long number = 0;
+  int digits;
+
+  if (0 != strncmp((char*)command, GAME_SEED_COMMAND,
+                   sizeof(GAME_SEED_COMMAND) - 1))
+  {
+    return FALSE;
+  }
+  command += sizeof(GAME_SEED_COMMAND) - 1;
+  for (digits = 0; (command[digits] >= '0') && (command[digits] <= '9');
+       digits++)
+  {
+    if (digits == GAME_SEED_DIGITS)
+    {
+      return FALSE;
+    }
+    number = number * 10 + (command[digits] - '0');
+  }
+  if ((digits == 0) || (command[digits] != '\0') || (number > 0xFFFFFFFFULL))
+  {
+    return FALSE;
+  }
+  *seed = (uint32)number;
+  return TRUE;
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: GAME Emit
+//
+// DESCRIPTION:
+//    This function adds an item to the output of a step.  Items past
+//    GAME_MAX_OUTPUTS are dropped; no step makes that many.
+//
+// INPUT:
+//   type - the GAME_OUT_ item
+//   value - the item's value
+//   text - the item's code, or NULL
+//
+// OUTPUT:
+//   output - the output of the step
+//
+// RETURN:
+//   the item, or NULL if it was dropped
+//----------------------------------------------------------------------------
+GameOutputItem* game_Emit(GameOutput* output, uint8 type, uint8 value,
+                          const uint8* text)
+{
+  GameOutputItem* item;
+
+  if (output->count >= GAME_MAX_OUTPUTS)
+  {
+    return NULL;
+  }
+  item = &output->items[output->count++];
+  item->type = type;
+  item->value = value;
+  item->text[0] = '\0';
+  item->hint[0] = '\0';
+  if (text != NULL)
+  {
+    memcpy(item->text, text, NUM_OF_COLORS_INCODE + 1);
+  }
+  return item;
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Take Guess
+//
+// DESCRIPTION:
+//    This function handles a line entered during a game: a request for a
+//    hint, the winning guess, or a wrong guess, which is recorded for the
+//    advisor and answered with its hint.  The session moves on to
+//    eWIN_GAME or eREQUEST_GUESS.
+//
+// INPUT:
+//   line - the line entered
+//
+// OUTPUT:
+//   session - the session
+//   output - the output of the step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void game_TakeGuess(GameSession* session, const uint8* line,
+                    GameOutput* output)
+{
+  uint8 guess_code[NUM_OF_COLORS_INCODE + 1];
+  GameHint hint;
+  GameOutputItem* item;
+  uint16 guess;
+
+  // a guess is the first letters of the line
+  memcpy(guess_code, line, NUM_OF_COLORS_INCODE);
+  guess_code[NUM_OF_COLORS_INCODE] = '\0';
+
+  if (0 == strcmp((char*)guess_code, "HINT"))
+  {
+    game_Emit(output, GAME_OUT_HINT, 0, NULL);
+    session->state = eREQUEST_GUESS;
+    return;
+  }
+
+  hint = game_ScoreGuess(guess_code, session->secret);
+  if (NUM_OF_COLORS_INCODE == hint.exact)
+  {
+    session->state = eWIN_GAME;
+    return;
+  }
+
+  guess = score_PackCode(guess_code);
+  if ((guess != SCORE_INVALID_CODE) &&
+      (session->history_moves < GAME_MAX_HISTORY))
+  {
+    session->history_guesses[session->history_moves] = guess;
+    session->history_feedbacks[session->history_moves++] =
+      score_PatternCodes(guess, score_PackCode(session->secret));
+  }
+
+  item = game_Emit(output, GAME_OUT_WRONG_GUESS, 0, guess_code);
+  if (item != NULL)
+  {
+    memcpy(item->hint, hint.text, NUM_OF_COLORS_INCODE + 1);
+  }
+  game_Emit(output, GAME_OUT_TIMER_LIMIT, TIME_OUT_PERIOD, NULL);
+  session->state = eREQUEST_GUESS;
+}
+
+
+//----------------------------------------------------------------------------
+// NAME: GAME Enter
+//
+// DESCRIPTION:
+//    This function moves a session to a new state and shows the prompt of
+//    the states that wait for the player.
+//
+// INPUT:
+//   state - the new state
+//
+// OUTPUT:
+//   session - the session
+//   output - the output of the step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void game_Enter(GameSession* session, uint8 state, GameOutput* output)
+{
+  session->state = state;
+  if (state == eGAME_IDLE)
+  {
+    game_Emit(output, GAME_OUT_WELCOME, 0, NULL);
+    game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+  }
+  else if (state == eWAIT_4_KEY1)
+  {
+    game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+    game_Emit(output, GAME_OUT_PRESS_KEY1, 0, NULL);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Score Guess
+//
+// DESCRIPTION:
+//    This function compares a guess with the secret code.  Each letter of
+//    the hint is P for the right color in the right place, C for a color
+//    of the secret in the wrong place, or - for neither.
+//
+// INPUT:
+//   guess - the user's guess
+//   secret - the secret code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the hint and the number of exact matches
+//----------------------------------------------------------------------------
+GameHint game_ScoreGuess(const uint8* guess, const uint8* secret)
+{
+  GameHint hint;
+  int i;
+  int j;
+
+  hint.exact = 0;
+  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  {
+    hint.text[i] = '-';
+    for (j = 0; j < NUM_OF_COLORS_INCODE; j++)
+    {
+      if (guess[i] == secret[j])
+      {
+        if (i == j)
+        {
+          hint.text[i] = 'P';
+          hint.exact++;
+        }
+        else if (hint.text[i] != 'P')
+        {
+          hint.text[i] = 'C';
+        }
+      }
+    }
+  }
+  hint.text[NUM_OF_COLORS_INCODE] = '\0';
+  return hint;
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Menu Command
+//
+// DESCRIPTION:
+//    This function matches a line typed at the main menu against the menu
+//    options.  STATS and SEED with a number run at the menu.
+//
+// INPUT:
+//   command - the line typed by the user
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the state that runs the option, or eGAME_IDLE if nothing matched
+//----------------------------------------------------------------------------
+uint8 game_MenuCommand(const uint8* command)
+{
+  uint32 seed;
+
+  if (0 == strcmp((char*)command, "HELP"))
+  {
+    return eWAIT_4_KEY1;
+  }
+  else if (0 == strcmp((char*)command, "PLAY"))
+  {
+    return eINIT_GAME;
+  }
+  else if (0 == strcmp((char*)command, "EXIT"))
+  {
+    return eEND_GAME;
+  }
+  else if (0 == strcmp((char*)command, "SOLVE"))
+  {
+    return eSOLVE_GAME;
+  }
+  else if (0 == strcmp((char*)command, "STATS"))
+  {
+    return eSHOW_STATS;
+  }
+  else if (game_ParseSeed(command, &seed))
+  {
+    return eSEED_GAME;
+  }
+  return eGAME_IDLE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Menu Run
+//
+// DESCRIPTION:
+//    This function runs a menu option that stays at the menu: STATS asks
+//    the frontend for its statistics, and SEED seeds the session's
+//    generator with its number, so the secret codes that follow can be
+//    played again.  The caller enters eGAME_IDLE afterwards.
+//
+// INPUT:
+//   option - eSHOW_STATS or eSEED_GAME, from game_MenuCommand
+//   command - the line typed by the user
+//
+// OUTPUT:
+//   session - the session
+//   output - the output of the step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void game_MenuRun(GameSession* session, uint8 option, const uint8* command,
+                  GameOutput* output)
+{
+  uint32 seed;
+
+  if (option == eSHOW_STATS)
+  {
+    game_Emit(output, GAME_OUT_STATS, 0, NULL);
+  }
+  else if ((option == eSEED_GAME) && game_ParseSeed(command, &seed))
+  {
+    rng_Seed(&session->rng, seed);
+    game_Emit(output, GAME_OUT_SEED, 0, NULL);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Generate Secret
+//
+// DESCRIPTION:
+//    This function creates a random secret code from the session's
+//    generator with the engine built for this game's configuration.  The
+//    engine draws one unused color per peg, so no color is repeated.
+//
+// INPUT:
+//   session - the session
+//
+// OUTPUT:
+//   code - the secret code, NULL terminated
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void game_GenerateSecret(GameSession* session, uint8* code)
+{
+  engine_Unpack4x6(engine_Generate4x6(&session->rng), code);
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Init
+//
+// DESCRIPTION:
+//    This function starts a session at the main menu.
+//
+// INPUT:
+//   seed - the seed of the session's secret codes
+//
+// OUTPUT:
+//   session - the session
+//   output - the welcome message
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void game_Init(GameSession* session, uint32 seed, GameOutput* output)
+{
+  memset(session, 0, sizeof(GameSession));
+  rng_Seed(&session->rng, seed);
+  output->count = 0;
+  game_Enter(session, eGAME_IDLE, output);
+}
+
+//----------------------------------------------------------------------------
+// NAME: GAME Step
+//
+// DESCRIPTION:
+//    This function runs one pass of the state machine.  A state that waits
+//    for the player ignores the events it does not expect, so the frontend
+//    may step with GAME_EVENT_NONE whenever it likes.
+//
+// INPUT:
+//   event - what happened since the last step
+//
+// OUTPUT:
+//   session - the session
+//   output - what the frontend must show or do, in order
+//
+// RETURN:
+//   FALSE once the player has left the game, else TRUE
+//----------------------------------------------------------------------------
+int game_Step(GameSession* session, const GameEvent* event,
+              GameOutput* output)
+{
+  uint8 next;
+
+  output->count = 0;
+  switch (session->state)
+  {
+  case eGAME_IDLE:
+    if (event->type == GAME_EVENT_LINE)
+    {
+      next = game_MenuCommand(event->line);
+      if ((next == eSHOW_STATS) || (next == eSEED_GAME))
+      {
+        game_MenuRun(session, next, event->line, output);
+        next = eGAME_IDLE;
+      }
+      else if (next == eWAIT_4_KEY1)
+      {
+        game_Emit(output, GAME_OUT_HELP, 0, NULL);
+      }
+      else if (next == eGAME_IDLE)
+      {
+        game_Emit(output, GAME_OUT_INCORRECT, 0, NULL);
+      }
+      game_Enter(session, next, output);
+    }
+    break;
+
+  case eINIT_GAME:
+    game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+    game_Emit(output, GAME_OUT_CLEAR_KEY, KEY2, NULL);
+    game_Emit(output, GAME_OUT_TIMER_LIMIT, TIME_OUT_PERIOD, NULL);
+    game_GenerateSecret(session, session->secret);
+    session->history_moves = 0;
+    game_Emit(output, GAME_OUT_NEW_SECRET, 0, session->secret);
+    session->state = eREQUEST_GUESS;
+    break;
+
+  case eREQUEST_GUESS:
+    game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+    game_Emit(output, GAME_OUT_CLEAR_KEY, KEY2, NULL);
+    game_Emit(output, GAME_OUT_TIMER_START, SECOND, NULL);
+    game_Emit(output, GAME_OUT_ENTER_GUESS, 0, NULL);
+    session->state = eWAITING_4_USER;
+    break;
+
+  case eWAITING_4_USER:
+    if (event->type == GAME_EVENT_KEY1)
+    {
+      // KEY1 restarts the game
+      game_Enter(session, eGAME_IDLE, output);
+    }
+    else if (event->type == GAME_EVENT_LINE)
+    {
+      game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+      game_TakeGuess(session, event->line, output);
+    }
+    else if (event->type == GAME_EVENT_TIMEOUT)
+    {
+      game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+      game_Emit(output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+      session->state = eLOSE_GAME;
+    }
+    break;
+
+  case eWIN_GAME:
+    game_Emit(output, GAME_OUT_TIMER_START, QUARTER, NULL);
+    game_Emit(output, GAME_OUT_WINNER, 0, NULL);
+    game_Enter(session, eWAIT_4_KEY1, output);
+    break;
+
+  case eLOSE_GAME:
+    game_Emit(output, GAME_OUT_LOSER, 0, NULL);
+    game_Emit(output, GAME_OUT_TIMER_START, HALFSEC, NULL);
+    game_Emit(output, GAME_OUT_SECRET_WAS, 0, session->secret);
+    game_Enter(session, eWAIT_4_KEY1, output);
+    break;
+
+  case eWAIT_4_KEY1:
+    if (event->type == GAME_EVENT_KEY1)
+    {
+      game_Enter(session, eGAME_IDLE, output);
+    }
+    break;
+
+  case eSOLVE_GAME:
+    game_GenerateSecret(session, session->secret);
+    game_Emit(output, GAME_OUT_SOLVE, 0, session->secret);
+    game_Enter(session, eWAIT_4_KEY1, output);
+    break;
+
+  case eEND_GAME:
+    game_Emit(output, GAME_OUT_TIMER_STOP, 0, NULL);
+    game_Emit(output, GAME_OUT_END, 0, NULL);
+    return FALSE;
+  } /* switch */
+
+  return TRUE;
+} /* game_Step */
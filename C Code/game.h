@@ -0,0 +1,157 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: game Definitions
+//
+//    FILENAME: game.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the CodeBreaker game
+//              library.  Everything a game needs is in its GameSession, so
+//              any number of games can run side by side, and game_Step
+//              neither allocates nor touches the hardware: it takes one
+//              event and returns what the frontend must show or do as a
+//              list of GameOutput items.  Main.c renders them on the board;
+//              a server can render them to a socket.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef GAME_MOD_H_
+#define GAME_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "engine.h"                   // for the game configuration
+#include "rng.h"                      // for the session's generator
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define NUM_OF_COLORS_INCODE  ENGINE_PEGS_4x6
+
+#define eGAME_IDLE      0
+#define eINIT_GAME      1
+#define eREQUEST_GUESS  2
+#define eWAITING_4_USER 3
+#define eWIN_GAME       4
+#define eLOSE_GAME      5
+#define eWAIT_4_KEY1    6
+#define eEND_GAME       7
+#define eSOLVE_GAME     8
+
+// menu options that run at the menu; the session stays in eGAME_IDLE
+#define eSHOW_STATS     9
+#define eSEED_GAME      10
+
+#define KEY1 1
+#define KEY2 2
+
+#define SECOND  1
+#define HALFSEC 2
+#define QUARTER 3
+
+#define TIME_OUT_PERIOD 60
+
+// guesses remembered for the hint advisor; later guesses are not used
+#define GAME_MAX_HISTORY   32
+
+// time the advisor may take before it answers with its best so far
+#define GAME_HINT_BUDGET_USEC 250000
+
+// longest line an event can carry
+#define GAME_LINE_MAX      16
+
+// most items one step can produce
+#define GAME_MAX_OUTPUTS   8
+
+// events
+#define GAME_EVENT_NONE    0          // nothing happened, e.g. a poll
+#define GAME_EVENT_LINE    1          // a line was entered (KEY2 in a game)
+#define GAME_EVENT_KEY1    2          // KEY1 was pressed
+#define GAME_EVENT_TIMEOUT 3          // the guess timer expired
+#define GAME_EVENT_TICK    4          // a second of the guess timer passed
+
+// output items; text and value are used where noted
+#define GAME_OUT_WELCOME        0
+#define GAME_OUT_HELP           1
+#define GAME_OUT_INCORRECT      2     // the menu line was not an option
+#define GAME_OUT_NEW_SECRET     3     // text is the secret, for debugging
+#define GAME_OUT_ENTER_GUESS    4
+#define GAME_OUT_WRONG_GUESS    5     // text is the guess, hint its hint
+#define GAME_OUT_HINT           6     // the player asked the advisor
+#define GAME_OUT_WINNER         7
+#define GAME_OUT_LOSER          8
+#define GAME_OUT_SECRET_WAS     9     // text is the secret
+#define GAME_OUT_PRESS_KEY1     10
+#define GAME_OUT_SOLVE          11    // text is the secret to solve
+#define GAME_OUT_END            12
+#define GAME_OUT_TIMER_STOP     13
+#define GAME_OUT_TIMER_START    14    // value is SECOND, HALFSEC or QUARTER
+#define GAME_OUT_TIMER_LIMIT    15    // value is the limit in seconds
+#define GAME_OUT_CLEAR_KEY      16    // value is KEY1 or KEY2
+#define GAME_OUT_STATS          17    // the frontend shows its statistics
+#define GAME_OUT_SEED           18    // the secret codes were seeded again
+#define GAME_OUT_NO_HISTORY     19    // a HINT with no guesses to advise from
+
+typedef struct
+{
+  uint8 text[NUM_OF_COLORS_INCODE + 1];
+  uint8 exact;
+} GameHint;
+
+typedef struct
+{
+  uint8 type;                         // GAME_EVENT_...
+  uint8 line[GAME_LINE_MAX + 1];      // for GAME_EVENT_LINE, NULL terminated
+} GameEvent;
+
+typedef struct
+{
+  uint8 type;                         // GAME_OUT_...
+  uint8 value;
+  uint8 text[NUM_OF_COLORS_INCODE + 1];
+  uint8 hint[NUM_OF_COLORS_INCODE + 1];
+} GameOutputItem;
+
+typedef struct
+{
+  int            count;
+  GameOutputItem items[GAME_MAX_OUTPUTS];
+} GameOutput;
+
+typedef struct
+{
+  uint8    state;                     // eGAME_IDLE ... eSOLVE_GAME
+  uint8    history_moves;
+  uint8    secret[NUM_OF_COLORS_INCODE + 1];
+  uint16   history_guesses[GAME_MAX_HISTORY];
+  uint8    history_feedbacks[GAME_MAX_HISTORY];  // P/C/- patterns
+  RngState rng;
+} GameSession;
+
+// TRUE for the states that only move on an event from the player
+#define game_IsWaiting(state)                                           \
+  (((state) == eGAME_IDLE) || ((state) == eWAITING_4_USER) ||           \
+   ((state) == eWAIT_4_KEY1))
+
+GameHint game_ScoreGuess(const uint8* guess, const uint8* secret);
+uint8    game_MenuCommand(const uint8* command);
+void     game_MenuRun(GameSession* session, uint8 option, const uint8* command,
+                      GameOutput* output);
+void     game_GenerateSecret(GameSession* session, uint8* code);
+void     game_Init(GameSession* session, uint32 seed, GameOutput* output);
+void     game_Enter(GameSession* session, uint8 state, GameOutput* output);
+void     game_TakeGuess(GameSession* session, const uint8* line,
+                        GameOutput* output);
+GameOutputItem* game_Emit(GameOutput* output, uint8 type, uint8 value,
+                          const uint8* text);
+int      game_Step(GameSession* session, const GameEvent* event,
+                   GameOutput* output);
+
+#endif /*GAME_MOD_H_*/
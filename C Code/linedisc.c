@@ -0,0 +1,623 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: linedisc Functions
+//
+//    FILENAME: linedisc.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the line discipline.  Characters are fed
+//              in one at a time and edit the line at its cursor: printable
+//              ones are put in, BACKSPACE and DEL take out the one before
+//              the cursor, Ctrl-U kills the line, and Ctrl-A and Ctrl-E go
+//              to its start and end.  ESC [ and ESC O start a sequence: the
+//              up and down arrows go back and forth through the history,
+//              left and right move the cursor, HOME and END go to the
+//              ends and DELETE takes out the character at the cursor.
+//              Sequences it does not know are read to their end and
+//              ignored.  RETURN ends the line, and CR LF counts as one.
+//              Other control characters and those past the longest line
+//              are ignored and counted in ld->ignored.
+//
+//              The echo of a character is built up and sent in one call,
+//              made of the characters, spaces and backspaces that leave the
+//              terminal showing the line with its cursor where it is.
+//
+//              A line stays in the LineDisc after RETURN until the next
+//              character starts a new one.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memmove, strcmp
+#include "nios_std_types.h"           // for standard embedded types
+#include "linedisc.h"                 // for linedisc definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define LINEDISC_CTRL_A       0x01
+#define LINEDISC_CTRL_E       0x05
+#define LINEDISC_BS           0x08
+#define LINEDISC_CTRL_U       0x15
+#define LINEDISC_ESC          0x1b
+#define LINEDISC_DEL          0x7f
+
+// how far into an escape sequence
+#define LINEDISC_SEQ_NONE     0
+#define LINEDISC_SEQ_ESC      1       // ESC came
+#define LINEDISC_SEQ_CSI      2       // ESC [ came, then the parameter
+#define LINEDISC_SEQ_SS3      3       // ESC O came
+
+// the longest echo: back to the start, a line, and spaces over the old one
+#define LINEDISC_ECHO_MAX     (4 * LINEDISC_MAX_LENGTH + 2)
+
+typedef struct
+{
+  uint8  data[LINEDISC_ECHO_MAX];
+  uint32 length;
+} LineDiscOut;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Put
+//
+// DESCRIPTION:
+//    This function adds a character to the echo, a number of times.
+//
+// INPUT:
+//   character - the character
+//   count - how many times
+//
+// OUTPUT:
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Put(LineDiscOut* out, uint8 character, uint32 count)
+{
+  while ((count > 0) && (out->length < LINEDISC_ECHO_MAX))
+  {
+    out->data[out->length++] = character;
+    count--;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Put Text
+//
+// DESCRIPTION:
+//    This function adds part of the line to the echo.
+//
+// INPUT:
+//   text - the characters
+//   count - how many
+//
+// OUTPUT:
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_PutText(LineDiscOut* out, const uint8* text, uint32 count)
+{
+  while ((count > 0) && (out->length < LINEDISC_ECHO_MAX))
+  {
+    out->data[out->length++] = *text++;
+    count--;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Move
+//
+// DESCRIPTION:
+//    This function moves the cursor, backing up over the line or writing
+//    it out again to get there.
+//
+// INPUT:
+//   to - the new cursor, at most the length
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Move(LineDisc* ld, LineDiscOut* out, uint32 to)
+{
+  if (to < ld->cursor)
+  {
+    linedisc_Put(out, '\b', ld->cursor - to);
+  }
+  else
+  {
+    linedisc_PutText(out, &ld->line[ld->cursor], to - ld->cursor);
+  }
+  ld->cursor = (uint8)to;
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Insert
+//
+// DESCRIPTION:
+//    This function puts a character in at the cursor and writes out the
+//    rest of the line after it.  A character past the longest line is
+//    ignored and counted.
+//
+// INPUT:
+//   character - the character
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Insert(LineDisc* ld, LineDiscOut* out, uint8 character)
+{
+  if (ld->length >= ld->max_length)
+  {
+    ld->ignored++;
+    return;
+  }
+  if ((ld->flags & LINEDISC_UPPER) && (character >= 'a') &&
+      (character <= 'z'))
+  {
+    character -= 'a' - 'A';
+  }
+  memmove(&ld->line[ld->cursor + 1], &ld->line[ld->cursor],
+          ld->length - ld->cursor);
+  ld->line[ld->cursor] = character;
+  ld->length++;
+  ld->line[ld->length] = '\0';
+
+  linedisc_PutText(out, &ld->line[ld->cursor], ld->length - ld->cursor);
+  linedisc_Put(out, '\b', ld->length - ld->cursor - 1);
+  ld->cursor++;
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Erase
+//
+// DESCRIPTION:
+//    This function takes a character out of the line, leaving the cursor
+//    where it was, and writes out the rest of the line over it.
+//
+// INPUT:
+//   at - where the character is, less than the length
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Erase(LineDisc* ld, LineDiscOut* out, uint32 at)
+{
+  linedisc_Move(ld, out, at);
+  memmove(&ld->line[at], &ld->line[at + 1], ld->length - at);
+  ld->length--;
+
+  linedisc_PutText(out, &ld->line[at], ld->length - at);
+  linedisc_Put(out, ' ', 1);
+  linedisc_Put(out, '\b', ld->length - at + 1);
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Replace
+//
+// DESCRIPTION:
+//    This function puts a new line in place of the one being edited, with
+//    the cursor at its end, and blanks what is left of the old one.
+//
+// INPUT:
+//   text - the new line, NULL terminated
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Replace(LineDisc* ld, LineDiscOut* out, const uint8* text)
+{
+  uint32 old_length = ld->length;
+  uint32 length = 0;
+
+  linedisc_Move(ld, out, 0);
+  while ((text[length] != '\0') && (length < ld->max_length))
+  {
+    ld->line[length] = text[length];
+    length++;
+  }
+  ld->line[length] = '\0';
+  ld->length = (uint8)length;
+  ld->cursor = (uint8)length;
+
+  linedisc_PutText(out, ld->line, length);
+  if (old_length > length)
+  {
+    linedisc_Put(out, ' ', old_length - length);
+    linedisc_Put(out, '\b', old_length - length);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Browse
+//
+// DESCRIPTION:
+//    This function goes one line back or forward through the history.
+//    Going forward past the newest line gives an empty line.
+//
+// INPUT:
+//   back - TRUE for the up arrow, FALSE for the down arrow
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Browse(LineDisc* ld, LineDiscOut* out, int back)
+{
+  if (back && (ld->browse < ld->history_count))
+  {
+    ld->browse++;
+  }
+  else if (!back && (ld->browse > 0))
+  {
+    ld->browse--;
+  }
+  else
+  {
+    return;
+  }
+
+  if (ld->browse == 0)
+  {
+    linedisc_Replace(ld, out, (const uint8*)"");
+  }
+  else
+  {
+    linedisc_Replace(ld, out, ld->history[(ld->history_next +
+                                           LINEDISC_HISTORY - ld->browse) %
+                                          LINEDISC_HISTORY]);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC End
+//
+// DESCRIPTION:
+//    This function ends the line and keeps it in the history, unless it is
+//    empty or the same as the newest line there.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_End(LineDisc* ld, LineDiscOut* out)
+{
+  uint8* newest;
+
+  linedisc_Put(out, '\n', 1);
+  ld->ended = TRUE;
+  ld->browse = 0;
+  if (ld->length == 0)
+  {
+    return;
+  }
+
+  newest = ld->history[(ld->history_next + LINEDISC_HISTORY - 1) %
+                       LINEDISC_HISTORY];
+  if ((ld->history_count == 0) ||
+      (0 != strcmp((char*)newest, (char*)ld->line)))
+  {
+    memcpy(ld->history[ld->history_next], ld->line, ld->length + 1);
+    ld->history_next = (ld->history_next + 1) % LINEDISC_HISTORY;
+    if (ld->history_count < LINEDISC_HISTORY)
+    {
+      ld->history_count++;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Sequence
+//
+// DESCRIPTION:
+//    This function carries out the escape sequence its last character
+//    ended.  A VT100 sends ESC [ A to D, or ESC O A to D in application
+//    mode, for the arrows; HOME and END come as ESC [ H and F, ESC O H and
+//    F, or ESC [ 1 ~ and 4 ~ (7 ~ and 8 ~ on some terminals), and DELETE as
+//    ESC [ 3 ~.
+//
+// INPUT:
+//   final - the last character of the sequence
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Sequence(LineDisc* ld, LineDiscOut* out, uint8 final)
+{
+  switch (final)
+  {
+  case 'A':
+    linedisc_Browse(ld, out, TRUE);
+    break;
+  case 'B':
+    linedisc_Browse(ld, out, FALSE);
+    break;
+  case 'C':
+    if (ld->cursor < ld->length)
+    {
+      linedisc_Move(ld, out, ld->cursor + 1);
+    }
+    break;
+  case 'D':
+    if (ld->cursor > 0)
+    {
+      linedisc_Move(ld, out, ld->cursor - 1);
+    }
+    break;
+  case 'H':
+    linedisc_Move(ld, out, 0);
+    break;
+  case 'F':
+    linedisc_Move(ld, out, ld->length);
+    break;
+  case '~':
+    if ((ld->parameter == 1) || (ld->parameter == 7))
+    {
+      linedisc_Move(ld, out, 0);
+    }
+    else if ((ld->parameter == 4) || (ld->parameter == 8))
+    {
+      linedisc_Move(ld, out, ld->length);
+    }
+    else if ((ld->parameter == 3) && (ld->cursor < ld->length))
+    {
+      linedisc_Erase(ld, out, ld->cursor);
+    }
+    break;
+  } /* switch */
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Escape
+//
+// DESCRIPTION:
+//    This function takes a character of an escape sequence.  A CSI
+//    sequence has a number and ends with a character from '@' to '~'; an
+//    SS3 sequence is one character long.
+//
+// INPUT:
+//   character - the character
+//
+// OUTPUT:
+//   ld - the line discipline
+//   out - the echo
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void linedisc_Escape(LineDisc* ld, LineDiscOut* out, uint8 character)
+{
+  if (ld->escape == LINEDISC_SEQ_ESC)
+  {
+    ld->parameter = 0;
+    ld->escape = (character == '[') ? LINEDISC_SEQ_CSI :
+                 (character == 'O') ? LINEDISC_SEQ_SS3 : LINEDISC_SEQ_NONE;
+  }
+  else if (ld->escape == LINEDISC_SEQ_SS3)
+  {
+    ld->escape = LINEDISC_SEQ_NONE;
+    linedisc_Sequence(ld, out, character);
+  }
+  else if ((character >= '0') && (character <= '9'))
+  {
+    if (ld->parameter < 100)
+    {
+      ld->parameter = (uint8)(ld->parameter * 10 + (character - '0'));
+    }
+  }
+  else if ((character >= '@') && (character <= '~'))
+  {
+    ld->escape = LINEDISC_SEQ_NONE;
+    linedisc_Sequence(ld, out, character);
+  }
+  else if (character < ' ')
+  {
+    // a control character breaks off the sequence
+    ld->escape = LINEDISC_SEQ_NONE;
+  }
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Init
+//
+// DESCRIPTION:
+//    This function starts a line discipline with an empty line and no
+//    history.
+//
+// INPUT:
+//   max_length - the longest line kept, at most LINEDISC_MAX_LENGTH
+//   flags - LINEDISC_UPPER and LINEDISC_ECHO
+//   echo - sends the echo, or NULL
+//
+// OUTPUT:
+//   ld - the line discipline
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void linedisc_Init(LineDisc* ld, uint32 max_length, uint32 flags,
+                   LineDiscEcho echo)
+{
+  memset(ld, 0, sizeof(LineDisc));
+  ld->max_length = (max_length < LINEDISC_MAX_LENGTH) ? (uint8)max_length :
+                                                        LINEDISC_MAX_LENGTH;
+  ld->flags = (uint8)flags;
+  ld->echo = echo;
+}
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Feed
+//
+// DESCRIPTION:
+//    This function takes a character from the terminal, edits the line
+//    with it and echoes the change.  When it returns TRUE the line is in
+//    ld->line until the next character.
+//
+// INPUT:
+//   character - the character
+//
+// OUTPUT:
+//   ld - the line discipline
+//
+// RETURN:
+//   TRUE if RETURN ended the line
+//----------------------------------------------------------------------------
+int linedisc_Feed(LineDisc* ld, uint8 character)
+{
+  LineDiscOut out;
+  uint8 last = ld->last;
+  int ended = FALSE;
+
+  ld->last = character;
+  if ((character == '\n') && (last == '\r'))
+  {
+    // the second half of CR LF
+    return FALSE;
+  }
+  if (ld->ended)
+  {
+    ld->line[0] = '\0';
+    ld->length = 0;
+    ld->cursor = 0;
+    ld->ended = FALSE;
+  }
+
+  out.length = 0;
+  if (ld->escape != LINEDISC_SEQ_NONE)
+  {
+    linedisc_Escape(ld, &out, character);
+  }
+  else
+  {
+    switch (character)
+    {
+    case '\r':
+    case '\n':
+      linedisc_End(ld, &out);
+      ended = TRUE;
+      break;
+    case LINEDISC_BS:
+    case LINEDISC_DEL:
+      if (ld->cursor > 0)
+      {
+        linedisc_Erase(ld, &out, ld->cursor - 1);
+      }
+      break;
+    case LINEDISC_CTRL_U:
+      linedisc_Replace(ld, &out, (const uint8*)"");
+      break;
+    case LINEDISC_CTRL_A:
+      linedisc_Move(ld, &out, 0);
+      break;
+    case LINEDISC_CTRL_E:
+      linedisc_Move(ld, &out, ld->length);
+      break;
+    case LINEDISC_ESC:
+      ld->escape = LINEDISC_SEQ_ESC;
+      break;
+    default:
+      if ((character >= ' ') && (character < LINEDISC_DEL))
+      {
+        linedisc_Insert(ld, &out, character);
+      }
+      else
+      {
+        ld->ignored++;
+      }
+      break;
+    } /* switch */
+  }
+
+  if ((out.length > 0) && (ld->flags & LINEDISC_ECHO) && (ld->echo != NULL))
+  {
+    ld->echo(out.data, out.length);
+  }
+  return ended;
+} /* linedisc_Feed */
+
+//----------------------------------------------------------------------------
+// NAME: LINEDISC Take
+//
+// DESCRIPTION:
+//    This function hands over the line as it is, typed so far or ended,
+//    and starts a new one.  The history is not changed.
+//
+// INPUT:
+//   size - the size of line, at least 1
+//
+// OUTPUT:
+//   ld - the line discipline
+//   line - the line, NULL terminated and padded with NULLs
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void linedisc_Take(LineDisc* ld, uint8* line, uint32 size)
+{
+  uint32 i;
+
+  for (i = 0; i < size - 1; i++)
+  {
+    line[i] = (i < ld->length) ? ld->line[i] : '\0';
+  }
+  line[size - 1] = '\0';
+
+  ld->line[0] = '\0';
+  ld->length = 0;
+  ld->cursor = 0;
+  ld->ended = FALSE;
+  ld->browse = 0;
+}
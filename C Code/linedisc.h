@@ -0,0 +1,74 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: linedisc Definitions
+//
+//    FILENAME: linedisc.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the line discipline,
+//              which makes lines out of the characters a terminal sends.
+//              It edits the line at a cursor, understands the arrow keys
+//              and the other escape sequences of a VT100, kills the line on
+//              Ctrl-U and keeps a history of the lines entered.  Each
+//              LineDisc is separate, so a frontend may have one per
+//              terminal.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef LINEDISC_MOD_H_
+#define LINEDISC_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#ifndef LINEDISC_MAX_LENGTH
+#define LINEDISC_MAX_LENGTH   32      // the longest line any LineDisc keeps
+#endif
+
+#ifndef LINEDISC_HISTORY
+#define LINEDISC_HISTORY      8       // lines kept for the up arrow
+#endif
+
+// flags
+#define LINEDISC_UPPER        0x01    // letters are made upper case
+#define LINEDISC_ECHO         0x02    // the editing is echoed
+
+// sends the echo to the terminal
+typedef void (*LineDiscEcho)(const uint8* data, uint32 length);
+
+typedef struct
+{
+  uint8        line[LINEDISC_MAX_LENGTH + 1];  // NULL terminated
+  uint8        max_length;            // the longest line kept
+  uint8        length;
+  uint8        cursor;                // where the next character goes
+  uint8        ended;                 // RETURN ended the line
+  uint8        flags;                 // LINEDISC_...
+  uint8        escape;                // how far into an escape sequence
+  uint8        parameter;             // the number of a CSI sequence
+  uint8        last;                  // the last character, for CR LF
+  uint8        history[LINEDISC_HISTORY][LINEDISC_MAX_LENGTH + 1];
+  uint8        history_count;         // lines kept, newest at history_next-1
+  uint8        history_next;
+  uint8        browse;                // lines back the arrows went, 0 = none
+  uint32       ignored;               // characters past the longest line or
+                                      // with no meaning, since Init
+  LineDiscEcho echo;
+} LineDisc;
+
+void linedisc_Init(LineDisc* ld, uint32 max_length, uint32 flags,
+                   LineDiscEcho echo);
+int  linedisc_Feed(LineDisc* ld, uint8 character);
+void linedisc_Take(LineDisc* ld, uint8* line, uint32 size);
+
+#endif /*LINEDISC_MOD_H_*/
@@ -0,0 +1,195 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: msgcat Functions
+//
+//    FILENAME: msgcat.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the decoder of the message catalog.  The
+//              codes are canonical, so a code is found from the number of
+//              codes of each length alone, one bit at a time, with no tree
+//              and no lookup table to store.  A message is read in pieces
+//              of any size straight into the caller's buffer.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "nios_std_types.h"           // for standard embedded types
+#include "msgcat.h"                   // for msgcat definitions
+#include "msgcat_tab.h"               // for the coded messages
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+
+// fails to compile when msgtext.h changed without running mkmsgcat
+typedef char msgcatTabIsCurrent[(MSGCAT_TAB_NUM_MESSAGES ==
+                                 MSGCAT_NUM_MESSAGES) ? 1 : -1];
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: MSGCAT Decode
+//
+// DESCRIPTION:
+//    This function reads one code.  Among the codes of a length, the
+//    canonical codes are consecutive and start at first, so the code read
+//    so far is one of them when it is less than count past first;
+//    otherwise another bit is read and first moves past them.
+//
+// INPUT:
+//   bit - the first bit of the code
+//
+// OUTPUT:
+//   bit - the first bit of the next code
+//
+// RETURN:
+//   the character
+//----------------------------------------------------------------------------
+static uint8 msgcat_Decode(uint32* bit)
+{
+  uint32 position = *bit;
+  uint32 code = 0;
+  uint32 first = 0;
+  uint32 index = 0;
+  uint32 count;
+  int    length;
+
+  for (length = 1; length <= MSGCAT_MAX_BITS; length++)
+  {
+    code |= (msgcatCoded[position >> 3] >> (7 - (position & 7))) & 1;
+    position++;
+    count = msgcatPerLength[length];
+    if (code - first < count)
+    {
+      *bit = position;
+      return msgcatSymbols[index + code - first];
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  *bit = position;
+  return '?';
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: MSGCAT Length
+//
+// DESCRIPTION:
+//    This function gives the number of characters of a message.
+//
+// INPUT:
+//   id - the message, MSGCAT_...
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of characters
+//----------------------------------------------------------------------------
+uint32 msgcat_Length(uint32 id)
+{
+  return msgcatLengths[id];
+}
+
+//----------------------------------------------------------------------------
+// NAME: MSGCAT Open
+//
+// DESCRIPTION:
+//    This function starts reading a message.
+//
+// INPUT:
+//   id - the message, MSGCAT_...
+//
+// OUTPUT:
+//   cursor - where the message is being read
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void msgcat_Open(MsgCursor* cursor, uint32 id)
+{
+  cursor->bit = msgcatStarts[id];
+  cursor->left = msgcatLengths[id];
+}
+
+//----------------------------------------------------------------------------
+// NAME: MSGCAT Read
+//
+// DESCRIPTION:
+//    This function expands the next characters of a message into a buffer.
+//    The buffer is not NULL terminated.
+//
+// INPUT:
+//   cursor - where the message is being read
+//   size - the size of the buffer
+//
+// OUTPUT:
+//   cursor - moved past the characters read
+//   buffer - the characters
+//
+// RETURN:
+//   the number of characters read, 0 at the end of the message
+//----------------------------------------------------------------------------
+uint32 msgcat_Read(MsgCursor* cursor, uint8* buffer, uint32 size)
+{
+  uint32 bit = cursor->bit;
+  uint32 count = (size < cursor->left) ? size : cursor->left;
+  uint32 n;
+
+  for (n = 0; n < count; n++)
+  {
+    buffer[n] = msgcat_Decode(&bit);
+  }
+  cursor->bit = bit;
+  cursor->left -= count;
+  return count;
+}
+
+//----------------------------------------------------------------------------
+// NAME: MSGCAT Plain Bytes
+//
+// DESCRIPTION:
+//    These functions give the bytes the messages would take as string
+//    literals and the bytes the catalog's tables take instead, as counted
+//    by mkmsgcat.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes
+//----------------------------------------------------------------------------
+uint32 msgcat_PlainBytes(void)
+{
+  return MSGCAT_TAB_PLAIN_BYTES;
+}
+
+uint32 msgcat_PackedBytes(void)
+{
+  return MSGCAT_TAB_PACKED_BYTES;
+}
@@ -0,0 +1,56 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: msgcat Definitions
+//
+//    FILENAME: msgcat.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the message catalog,
+//              which keeps the fixed messages of the display Huffman coded
+//              and expands them a piece at a time, so a message never needs
+//              a buffer of its full length.  The messages are in msgtext.h
+//              and their coded form in msgcat_tab.h, which mkmsgcat writes.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef MSGCAT_MOD_H_
+#define MSGCAT_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define MSGCAT_MAX_BITS       15      // the longest code mkmsgcat may give
+
+// the message ids, in the order of msgtext.h
+enum
+{
+#define MSGCAT_TEXT(id, text)  id,
+#include "msgtext.h"
+#undef MSGCAT_TEXT
+  MSGCAT_NUM_MESSAGES
+};
+
+// where a message is being read
+typedef struct
+{
+  uint32 bit;                         // the next bit of the coded text
+  uint32 left;                        // the characters not yet read
+} MsgCursor;
+
+uint32 msgcat_Length(uint32 id);
+void   msgcat_Open(MsgCursor* cursor, uint32 id);
+uint32 msgcat_Read(MsgCursor* cursor, uint8* buffer, uint32 size);
+uint32 msgcat_PlainBytes(void);
+uint32 msgcat_PackedBytes(void);
+
+#endif /*MSGCAT_MOD_H_*/
@@ -0,0 +1,137 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: msgcat Tables
+//
+//    FILENAME: msgcat_tab.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the messages of msgtext.h Huffman coded
+//              for msgcat.c.  It is written by mkmsgcat; do not edit it.
+//              15 messages, 1546 bytes as string literals, 1009 bytes coded.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#define MSGCAT_TAB_NUM_MESSAGES  15
+#define MSGCAT_TAB_NUM_SYMBOLS   56
+#define MSGCAT_TAB_CODED_BYTES   877
+#define MSGCAT_TAB_PLAIN_BYTES   1546
+#define MSGCAT_TAB_PACKED_BYTES  1009
+
+// the number of codes of each length
+static const uint8  msgcatPerLength[MSGCAT_MAX_BITS + 1] =
+{
+  0, 0, 0, 2, 5, 7, 7, 5, 8, 18, 4, 0,
+  0, 0, 0, 0
+};
+
+// the characters in the order of their codes
+static const uint8  msgcatSymbols[MSGCAT_TAB_NUM_SYMBOLS] =
+{
+  32, 101, 97, 105, 111, 115, 116, 10, 99, 104, 108, 110,
+  114, 117, 44, 46, 100, 103, 109, 112, 121, 69, 84, 98,
+  102, 119, 39, 58, 73, 80, 83, 89, 107, 118, 45, 49,
+  50, 51, 52, 65, 66, 67, 68, 71, 72, 75, 76, 78,
+  79, 82, 87, 120, 48, 54, 86, 88
+};
+
+// the first bit of each message
+static const uint16 msgcatStarts[MSGCAT_TAB_NUM_MESSAGES] =
+{
+  0, 605, 4972, 5190, 5391, 5563, 5663, 5755, 5955, 6114, 6222, 6443,
+  6527, 6719, 6877
+};
+
+// the characters of each message
+static const uint16 msgcatLengths[MSGCAT_TAB_NUM_MESSAGES] =
+{
+  114, 968, 48, 44, 34, 21, 19, 45, 36, 23, 50, 20,
+  41, 37, 31
+};
+
+// the coded messages, most significant bit first
+static const uint8  msgcatCoded[MSGCAT_TAB_CODED_BYTES] =
+{
+  151, 240, 214, 109, 177, 16, 195, 230, 218, 31, 149, 202,
+  122, 27, 230, 7, 141, 74, 57, 17, 198, 228, 45, 132,
+  80, 134, 222, 21, 172, 56, 108, 75, 179, 98, 186, 10,
+  175, 161, 16, 192, 255, 76, 241, 7, 57, 75, 219, 152,
+  241, 252, 124, 124, 229, 238, 204, 125, 185, 126, 60, 101,
+  239, 204, 114, 255, 252, 57, 203, 225, 152, 242, 253, 126,
+  63, 238, 82, 148, 188, 44, 62, 109, 161, 249, 92, 167,
+  161, 190, 66, 40, 70, 172, 149, 13, 212, 69, 8, 213,
+  54, 33, 92, 67, 13, 12, 27, 236, 182, 33, 37, 240,
+  246, 77, 170, 215, 19, 109, 8, 186, 91, 70, 218, 188,
+  13, 77, 141, 210, 14, 131, 167, 2, 40, 68, 219, 109,
+  241, 6, 249, 129, 206, 134, 230, 73, 114, 29, 127, 162,
+  109, 86, 187, 136, 97, 58, 51, 57, 29, 110, 219, 119,
+  143, 217, 211, 33, 242, 174, 14, 67, 245, 116, 182, 167,
+  33, 230, 107, 86, 237, 148, 190, 183, 38, 217, 4, 182,
+  131, 249, 69, 131, 152, 28, 248, 220, 133, 176, 138, 17,
+  213, 110, 240, 22, 203, 10, 149, 13, 212, 20, 157, 4,
+  218, 173, 121, 69, 18, 7, 13, 129, 20, 91, 122, 5,
+  112, 182, 17, 66, 38, 218, 28, 192, 231, 66, 38, 219,
+  111, 136, 55, 29, 150, 181, 26, 155, 27, 164, 25, 32,
+  185, 125, 218, 206, 71, 68, 115, 160, 107, 14, 27, 23,
+  26, 224, 187, 230, 7, 135, 80, 130, 109, 86, 184, 87,
+  22, 104, 11, 97, 20, 50, 155, 104, 114, 17, 67, 114,
+  59, 45, 106, 58, 16, 131, 187, 217, 220, 22, 195, 122,
+  164, 200, 110, 162, 40, 68, 218, 173, 124, 192, 240, 234,
+  18, 83, 106, 181, 194, 184, 91, 8, 161, 19, 109, 14,
+  67, 166, 32, 54, 32, 55, 81, 187, 58, 194, 181, 178,
+  8, 59, 190, 125, 195, 178, 214, 178, 185, 222, 169, 50,
+  34, 132, 77, 170, 215, 11, 97, 20, 72, 27, 179, 172,
+  43, 91, 48, 60, 58, 132, 19, 106, 181, 196, 81, 32,
+  43, 201, 108, 34, 132, 77, 180, 33, 92, 45, 132, 80,
+  137, 181, 238, 103, 3, 118, 117, 133, 107, 100, 16, 119,
+  120, 247, 14, 203, 90, 139, 157, 234, 147, 50, 138, 17,
+  54, 171, 92, 45, 132, 81, 32, 110, 206, 176, 173, 108,
+  192, 253, 157, 142, 221, 13, 242, 28, 54, 5, 19, 212,
+  143, 247, 252, 14, 102, 214, 209, 229, 12, 54, 79, 66,
+  10, 78, 131, 92, 23, 124, 131, 69, 13, 251, 43, 145,
+  195, 96, 85, 156, 136, 161, 26, 166, 199, 48, 57, 241,
+  185, 151, 219, 195, 243, 204, 45, 158, 10, 104, 27, 168,
+  65, 174, 11, 184, 134, 29, 8, 122, 55, 107, 8, 161,
+  26, 224, 187, 136, 162, 64, 131, 90, 188, 184, 108, 8,
+  161, 27, 51, 198, 96, 120, 220, 187, 143, 185, 224, 123,
+  67, 88, 69, 8, 250, 114, 247, 15, 147, 37, 244, 9,
+  1, 45, 192, 133, 216, 202, 24, 92, 198, 47, 97, 12,
+  34, 132, 108, 139, 97, 177, 182, 51, 3, 227, 2, 40,
+  70, 200, 182, 27, 27, 99, 33, 229, 207, 227, 207, 202,
+  79, 70, 236, 226, 40, 67, 194, 66, 188, 44, 223, 32,
+  150, 208, 121, 114, 229, 244, 9, 109, 2, 11, 99, 110,
+  134, 249, 4, 112, 182, 151, 151, 46, 95, 65, 237, 247,
+  123, 254, 25, 13, 147, 208, 184, 138, 16, 230, 119, 48,
+  38, 218, 23, 17, 68, 129, 213, 171, 86, 236, 34, 132,
+  58, 108, 100, 82, 116, 16, 187, 28, 229, 41, 124, 218,
+  218, 221, 35, 21, 72, 86, 179, 230, 60, 219, 3, 92,
+  23, 115, 160, 138, 17, 54, 189, 204, 224, 77, 180, 57,
+  203, 205, 176, 40, 158, 164, 93, 44, 27, 16, 27, 168,
+  133, 216, 230, 7, 147, 94, 252, 100, 56, 108, 10, 179,
+  156, 229, 206, 137, 111, 65, 195, 96, 117, 107, 141, 234,
+  156, 45, 181, 204, 15, 171, 54, 157, 56, 57, 202, 82,
+  240, 180, 218, 247, 51, 129, 251, 47, 187, 89, 204, 165,
+  41, 114, 180, 27, 143, 54, 197, 198, 184, 46, 253, 242,
+  151, 58, 36, 13, 112, 93, 194, 184, 91, 77, 175, 115,
+  56, 204, 15, 54, 197, 198, 184, 46, 227, 178, 63, 120,
+  18, 231, 69, 112, 174, 34, 132, 81, 109, 3, 173, 219,
+  97, 195, 98, 227, 92, 23, 126, 240, 37, 47, 203, 10,
+  45, 160, 43, 132, 245, 69, 170, 116, 169, 206, 82, 252,
+  176, 162, 218, 59, 196, 80, 220, 133, 113, 102, 20, 87,
+  134, 191, 1, 108, 55, 73, 250, 29, 3, 151, 117, 107,
+  62, 124, 232, 67, 153, 220, 192, 155, 104, 71, 100, 113,
+  41, 120, 220, 187, 143, 191, 47, 63, 104, 134, 23, 49,
+  139, 216, 67, 8, 161, 27, 34, 216, 108, 109, 140, 229,
+  46, 116, 33, 204, 238, 96, 77, 180, 46, 59, 27, 144,
+  228, 232, 116, 9, 170, 45, 179, 148, 185, 208, 135, 106,
+  250, 155, 133, 113, 189, 83, 133, 182, 161, 53, 69, 179,
+  192
+};
+
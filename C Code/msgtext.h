@@ -0,0 +1,75 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: msgtext Definitions
+//
+//    FILENAME: msgtext.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the text of the fixed messages of the
+//              display, one MSGCAT_TEXT(id, text) each.  It is included
+//              with MSGCAT_TEXT defined by the includer: msgcat.h keeps
+//              only the ids, so none of the text is linked into the
+//              program, and mkmsgcat keeps the text to compress it into
+//              msgcat_tab.h.  After changing a message run mkmsgcat again.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+// no include guard; each includer defines MSGCAT_TEXT first
+
+MSGCAT_TEXT(MSGCAT_WELCOME,
+            "\nWelcome to CodeBreaker.  Please type in the option you\n"
+            "would like to execute.\n\n"
+            "1. PLAY\n2. HELP\n3. EXIT\n4. SOLVE\n\n")
+MSGCAT_TEXT(MSGCAT_HELP,
+            "\nIn CodeBreaker, the goal of the game is to determine a\n"
+            "4-color code randomly generated by the computer.  There\n"
+            "are six colors to choose from: Red, Blue, Orange, Yellow,\n"
+            "Green, and White.  Type in the first initial of each color\n"
+            "that you think is in the code.  The computer will generate\n"
+            "a response based on your guess.  If a color is not in the\n"
+            "code, there will be a '-' in place of the color.  If a\n"
+            "color is in the code, but out of position, a 'C' will\n"
+            "replace the color in that position.  If a color that is\n"
+            "in the code is in the correct position, a 'P' will replace\n"
+            "the color in that position.  Remember, you have 60 seconds\n"
+            "to make each guess, otherwise you lose the game.  Type\n"
+            "HINT instead of a guess to be shown the guess that tells\n"
+            "you the most.  Press Key 1 on the DE2 Board at any time\n"
+            "to return to the main menu.  At the main menu, STATS\n"
+            "shows the statistics, and SEED and a number, as in\n"
+            "SEED 1234, makes the secret codes that follow the same\n"
+            "each time.\n\n")
+MSGCAT_TEXT(MSGCAT_WINNER,
+            "\nCongratulations. You guessed the correct code.\n")
+MSGCAT_TEXT(MSGCAT_LOSER,
+            "You have ran out of time.  Sorry, you lose.\n")
+MSGCAT_TEXT(MSGCAT_END,
+            "Thank you for playing.  Goodbye.\n\n")
+MSGCAT_TEXT(MSGCAT_INCORRECT,
+            "\nIncorrect Response\n\n")
+MSGCAT_TEXT(MSGCAT_ENTER_GUESS,
+            "\n\nEnter Your guess:")
+MSGCAT_TEXT(MSGCAT_WRONG_GUESS,
+            "\n\nThat guess is incorrect.  Your guess was:  ")
+MSGCAT_TEXT(MSGCAT_HINT_WAS,
+            "\nThis is the hint from your guess:  ")
+MSGCAT_TEXT(MSGCAT_NO_HINT,
+            "\n\nNo hint is available.")
+MSGCAT_TEXT(MSGCAT_NO_HISTORY,
+            "\n\nNo hint: there is no history in packed sessions.")
+MSGCAT_TEXT(MSGCAT_SECRET_WAS,
+            "The secret code was ")
+MSGCAT_TEXT(MSGCAT_PRESS_KEY1,
+            "\n\nPress KEY1 to return to the main menu.\n")
+MSGCAT_TEXT(MSGCAT_SEEDED,
+            "\nThe secret codes were seeded again.\n")
+MSGCAT_TEXT(MSGCAT_SOLVER_PLAYS,
+            "\nThe solver is playing against ")
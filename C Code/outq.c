@@ -0,0 +1,204 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: outq Functions
+//
+//    FILENAME: outq.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the output queue.  outq_Add only records
+//              where the text is, so the text must stay put until the queue
+//              is drained; text that does not, such as a line made with
+//              sprintf on the stack, is made in the scratch space with
+//              outq_Reserve and outq_Commit instead.  A descriptor that
+//              starts where the last one ends is merged into it, so a run
+//              of scratch lines goes out as one.
+//
+//              The queue drains itself when it runs out of descriptors or
+//              scratch, so a caller may queue any amount of text; only the
+//              number of sink calls grows.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for strlen
+#include "nios_std_types.h"           // for standard embedded types
+#include "outq.h"                     // for outq definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: OUTQ Init
+//
+// DESCRIPTION:
+//    This function starts an empty queue.
+//
+// INPUT:
+//   sink - sends the descriptors when the queue drains
+//   context - passed to sink
+//
+// OUTPUT:
+//   queue - the queue
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void outq_Init(OutQueue* queue, OutSink sink, void* context)
+{
+  queue->count = 0;
+  queue->bytes = 0;
+  queue->used = 0;
+  queue->sink = sink;
+  queue->context = context;
+}
+
+//----------------------------------------------------------------------------
+// NAME: OUTQ Add
+//
+// DESCRIPTION:
+//    This function queues text where it is.  The text must not change
+//    until the queue drains.
+//
+// INPUT:
+//   data - the text
+//   length - its length
+//
+// OUTPUT:
+//   queue - the queue
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void outq_Add(OutQueue* queue, const void* data, uint32 length)
+{
+  OutDesc* last = (queue->count > 0) ? &queue->descs[queue->count - 1] :
+                                        NULL;
+
+  if (length == 0)
+  {
+    return;
+  }
+  if ((last != NULL) && (last->data + last->length == data))
+  {
+    last->length += length;
+  }
+  else
+  {
+    if (queue->count == OUTQ_MAX_DESCS)
+    {
+      outq_Drain(queue);
+    }
+    queue->descs[queue->count].data = (const uint8*)data;
+    queue->descs[queue->count].length = length;
+    queue->count++;
+  }
+  queue->bytes += length;
+}
+
+//----------------------------------------------------------------------------
+// NAME: OUTQ Add String
+//
+// DESCRIPTION:
+//    This function queues a NULL terminated string where it is.
+//
+// INPUT:
+//   text - the string
+//
+// OUTPUT:
+//   queue - the queue
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void outq_AddString(OutQueue* queue, const char* text)
+{
+  outq_Add(queue, text, (uint32)strlen(text));
+}
+
+//----------------------------------------------------------------------------
+// NAME: OUTQ Reserve
+//
+// DESCRIPTION:
+//    This function gives the space where the next text made on the fly is
+//    to be written, draining the queue first if it has too little scratch
+//    or no descriptor free.  outq_Commit queues what was written.
+//
+// INPUT:
+//   max - the most bytes that will be written, at most OUTQ_SCRATCH
+//
+// OUTPUT:
+//   queue - the queue
+//
+// RETURN:
+//   the space
+//----------------------------------------------------------------------------
+char* outq_Reserve(OutQueue* queue, uint32 max)
+{
+  if ((queue->used + max > OUTQ_SCRATCH) ||
+      (queue->count == OUTQ_MAX_DESCS))
+  {
+    outq_Drain(queue);
+  }
+  return (char*)&queue->scratch[queue->used];
+}
+
+//----------------------------------------------------------------------------
+// NAME: OUTQ Commit
+//
+// DESCRIPTION:
+//    This function queues the text written in the space outq_Reserve gave.
+//
+// INPUT:
+//   length - the bytes written
+//
+// OUTPUT:
+//   queue - the queue
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void outq_Commit(OutQueue* queue, uint32 length)
+{
+  outq_Add(queue, &queue->scratch[queue->used], length);
+  queue->used += length;
+}
+
+//----------------------------------------------------------------------------
+// NAME: OUTQ Drain
+//
+// DESCRIPTION:
+//    This function passes the queued descriptors to the sink in one call
+//    and empties the queue.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   queue - the queue
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void outq_Drain(OutQueue* queue)
+{
+  if ((queue->count > 0) && (queue->sink != NULL))
+  {
+    queue->sink(queue->descs, queue->count, queue->context);
+  }
+  queue->count = 0;
+  queue->bytes = 0;
+  queue->used = 0;
+}
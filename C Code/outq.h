@@ -0,0 +1,69 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: outq Definitions
+//
+//    FILENAME: outq.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the output queue.  A
+//              queue is a list of descriptors, each the address and length
+//              of some text, that a sink sends in order, the way writev
+//              sends an array of iovecs.  Fixed messages are queued where
+//              they are, and text made on the fly is written into the
+//              queue's own scratch space, so nothing is copied before the
+//              sink.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef OUTQ_MOD_H_
+#define OUTQ_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#ifndef OUTQ_MAX_DESCS
+#define OUTQ_MAX_DESCS        32      // descriptors before the queue drains
+#endif
+
+#ifndef OUTQ_SCRATCH
+#define OUTQ_SCRATCH          1024    // bytes for text made on the fly
+#endif
+
+typedef struct
+{
+  const uint8* data;
+  uint32       length;
+} OutDesc;
+
+// sends descriptors in order; the text they point at may be reused after
+typedef void (*OutSink)(const OutDesc* descs, uint32 count, void* context);
+
+typedef struct
+{
+  OutDesc descs[OUTQ_MAX_DESCS];
+  uint32  count;
+  uint32  bytes;                      // the length of the text queued
+  uint32  used;                       // bytes of scratch in use
+  uint8   scratch[OUTQ_SCRATCH];
+  OutSink sink;
+  void*   context;
+} OutQueue;
+
+void   outq_Init(OutQueue* queue, OutSink sink, void* context);
+void   outq_Add(OutQueue* queue, const void* data, uint32 length);
+void   outq_AddString(OutQueue* queue, const char* text);
+char*  outq_Reserve(OutQueue* queue, uint32 max);
+void   outq_Commit(OutQueue* queue, uint32 length);
+void   outq_Drain(OutQueue* queue);
+
+#endif /*OUTQ_MOD_H_*/
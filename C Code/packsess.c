@@ -0,0 +1,354 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: packsess Functions
+//
+//    FILENAME: packsess.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the packed game sessions.  A step loads
+//              the packed session into a GameSession on the stack, runs
+//              game_Step and packs the result again, carrying out the
+//              timer and key outputs on the packed session itself.  The
+//              guess timer is a deadline in msec that only moves when the
+//              timer starts or stops, so nothing has to count it down.
+//
+//              A packed session keeps no guesses, so it has no history for
+//              the advisor: a step turns HINT into GAME_OUT_NO_HISTORY.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memset
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes
+#include "rng.h"                      // for the random number generator
+#include "game.h"                     // for the game library
+#include "packsess.h"                 // for packsess definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define PACKSESS_BACKSPACE    0x7f
+#define PACKSESS_MSEC         1000    // per second of TIMER_LIMIT
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Do Output
+//
+// DESCRIPTION:
+//    This function carries out the timer and key outputs of a step on the
+//    packed session.  A running timer keeps its deadline; a stopped one
+//    keeps the time it has left.
+//
+// INPUT:
+//   item - the output item
+//   now - the time in msec
+//
+// OUTPUT:
+//   session - the session
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void packsess_DoOutput(PackedSession* session,
+                              const GameOutputItem* item, uint32 now)
+{
+  long left;
+
+  if (item->type == GAME_OUT_TIMER_LIMIT)
+  {
+    session->deadline = (uint32)item->value * PACKSESS_MSEC;
+    if (session->state & PACKSESS_RUNNING)
+    {
+      session->deadline += now;
+    }
+  }
+  else if ((item->type == GAME_OUT_TIMER_START) && (item->value == SECOND) &&
+           !(session->state & PACKSESS_RUNNING))
+  {
+    session->deadline += now;
+    session->state |= PACKSESS_RUNNING;
+  }
+  else if ((item->type == GAME_OUT_TIMER_STOP) &&
+           (session->state & PACKSESS_RUNNING))
+  {
+    left = packsess_Left(session, now);
+    session->deadline = (left > 0) ? (uint32)left : 0;
+    session->state &= ~PACKSESS_RUNNING;
+  }
+  else if (item->type == GAME_OUT_CLEAR_KEY)
+  {
+    session->state &= (item->value == KEY1) ? ~PACKSESS_KEY1 : ~PACKSESS_KEY2;
+  }
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Init
+//
+// DESCRIPTION:
+//    This function starts a packed session at the main menu.
+//
+// INPUT:
+//   seed - the seed of the session's secret codes
+//
+// OUTPUT:
+//   session - the session
+//   output - the welcome message
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void packsess_Init(PackedSession* session, uint32 seed, GameOutput* output)
+{
+  GameSession game;
+  int i;
+
+  memset(session, 0, sizeof(PackedSession));
+  game_Init(&game, seed, output);
+  packsess_Store(&game, session);
+  for (i = 0; i < output->count; i++)
+  {
+    packsess_DoOutput(session, &output->items[i], 0);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Load
+//
+// DESCRIPTION:
+//    This function unpacks a session for game_Step or for the display.
+//
+// INPUT:
+//   packed - the packed session
+//
+// OUTPUT:
+//   session - the session, with no guesses
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void packsess_Load(const PackedSession* packed, GameSession* session)
+{
+  session->state = packsess_State(packed);
+  session->history_moves = 0;
+  memset(session->secret, 0, sizeof(session->secret));
+  if (packed->secret != SCORE_INVALID_CODE)
+  {
+    score_UnpackCode(packed->secret, session->secret);
+  }
+  rng_Seed(&session->rng, packed->seed);
+}
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Store
+//
+// DESCRIPTION:
+//    This function packs a session again after a step.  The next step
+//    seeds its generator from this one, so the secrets of a session follow
+//    from its first seed.
+//
+// INPUT:
+//   session - the session
+//
+// OUTPUT:
+//   packed - the packed session; its flags, timer and input are kept
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void packsess_Store(const GameSession* session, PackedSession* packed)
+{
+  RngState rng = session->rng;
+
+  packed->state = (packed->state & ~PACKSESS_STATE_MASK) | session->state;
+  packed->secret = (session->secret[0] != '\0') ?
+                   score_PackCode(session->secret) : SCORE_INVALID_CODE;
+  packed->seed = rng_Next(&rng);
+}
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Step
+//
+// DESCRIPTION:
+//    This function runs one pass of the state machine on a packed session,
+//    as game_Step does on a GameSession.  A HINT is refused, since the
+//    session has no guesses to advise from.
+//
+// INPUT:
+//   event - what happened since the last step
+//   now - the time in msec
+//
+// OUTPUT:
+//   session - the session
+//   output - what the frontend must show or do, in order
+//
+// RETURN:
+//   FALSE once the player has left the game, else TRUE
+//----------------------------------------------------------------------------
+int packsess_Step(PackedSession* session, const GameEvent* event, uint32 now,
+                  GameOutput* output)
+{
+  GameSession game;
+  int running;
+  int i;
+
+  packsess_Load(session, &game);
+  running = game_Step(&game, event, output);
+  packsess_Store(&game, session);
+  for (i = 0; i < output->count; i++)
+  {
+    if (output->items[i].type == GAME_OUT_HINT)
+    {
+      output->items[i].type = GAME_OUT_NO_HISTORY;
+    }
+    packsess_DoOutput(session, &output->items[i], now);
+  }
+  return running;
+}
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Type
+//
+// DESCRIPTION:
+//    This function adds a character typed by the player to the session's
+//    input: letters are made upper case, only the first four of a line are
+//    kept, BACKSPACE removes one, and RETURN ends the line.  Four letters
+//    are all a packed session has room for, so the longer menu options
+//    come in as lines through packsess_Step.
+//
+// INPUT:
+//   character - the character typed
+//
+// OUTPUT:
+//   session - the session
+//   event - the line, when RETURN ended one
+//
+// RETURN:
+//   TRUE if a line was ended
+//----------------------------------------------------------------------------
+int packsess_Type(PackedSession* session, uint8 character, GameEvent* event)
+{
+  if ((character >= 'a') && (character <= 'z'))
+  {
+    character -= 'a' - 'A';
+  }
+  if ((character == '\n') || (character == '\r'))
+  {
+    event->type = GAME_EVENT_LINE;
+    memcpy(event->line, session->input, NUM_OF_COLORS_INCODE);
+    event->line[session->typed] = '\0';
+    session->typed = 0;
+    return TRUE;
+  }
+  if ((character == PACKSESS_BACKSPACE) || (character == '\b'))
+  {
+    if (session->typed > 0)
+    {
+      session->typed--;
+    }
+  }
+  else if (session->typed < NUM_OF_COLORS_INCODE)
+  {
+    session->input[session->typed++] = character;
+  }
+  return FALSE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Press
+//
+// DESCRIPTION:
+//    This function presses a key on a session.  KEY1 is passed on as is;
+//    KEY2 enters the letters typed so far as a guess, as on the board.
+//
+// INPUT:
+//   key - KEY1 or KEY2
+//
+// OUTPUT:
+//   session - the session
+//   event - the event for packsess_Step
+//
+// RETURN:
+//   TRUE if the key makes an event
+//----------------------------------------------------------------------------
+int packsess_Press(PackedSession* session, int key, GameEvent* event)
+{
+  if (key == KEY1)
+  {
+    session->state |= PACKSESS_KEY1;
+    event->type = GAME_EVENT_KEY1;
+    return TRUE;
+  }
+  session->state |= PACKSESS_KEY2;
+  if (packsess_State(session) != eWAITING_4_USER)
+  {
+    return FALSE;
+  }
+  event->type = GAME_EVENT_LINE;
+  memcpy(event->line, session->input, NUM_OF_COLORS_INCODE);
+  event->line[session->typed] = '\0';
+  session->typed = 0;
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: PACKSESS Sweep
+//
+// DESCRIPTION:
+//    This function goes through an array of sessions in order and calls
+//    back for each one whose guess timer ran out.  The callback should step
+//    the session with GAME_EVENT_TIMEOUT, which stops its timer; a timer
+//    left running is found again by the next sweep.
+//
+// INPUT:
+//   sessions - the sessions
+//   count - the number of sessions
+//   now - the time in msec
+//   expired - called for each session that timed out
+//   context - passed to expired
+//
+// OUTPUT:
+//   sessions - the sessions, as the callback left them
+//
+// RETURN:
+//   the number of sessions that timed out
+//----------------------------------------------------------------------------
+long packsess_Sweep(PackedSession* sessions, long count, uint32 now,
+                    void (*expired)(PackedSession* session, void* context),
+                    void* context)
+{
+  long found = 0;
+  long n;
+
+  for (n = 0; n < count; n++)
+  {
+    if ((sessions[n].state & PACKSESS_RUNNING) &&
+        (packsess_Left(&sessions[n], now) <= 0))
+    {
+      found++;
+      expired(&sessions[n], context);
+    }
+  }
+  return found;
+}
@@ -0,0 +1,69 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: packsess Definitions
+//
+//    FILENAME: packsess.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the packed game
+//              sessions.  A packed session keeps what a game needs between
+//              events in 16 bytes: the secret as a packed code, the letters
+//              typed so far, the state with the key and timer flags, the
+//              seed of its next secret and the guess timer as a deadline.
+//              A million sessions fit in 16 MB of one array, and a timeout
+//              sweep reads it from start to end.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef PACKSESS_MOD_H_
+#define PACKSESS_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "game.h"                     // for the game library
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define PACKSESS_STATE_MASK   0x0F
+#define PACKSESS_KEY1         0x10    // KEY1 was pressed
+#define PACKSESS_KEY2         0x20    // KEY2 was pressed
+#define PACKSESS_RUNNING      0x40    // the guess timer is running
+
+typedef struct
+{
+  uint32 deadline;                    // msec when running, else msec left
+  uint32 seed;                        // seeds the generator for the next step
+  uint8  input[NUM_OF_COLORS_INCODE]; // the letters typed so far
+  uint16 secret;                      // packed code
+  uint8  state;                       // eGAME_IDLE ... and PACKSESS_ flags
+  uint8  typed;                       // the number of letters in input
+} PackedSession;
+
+// a packed session must stay 16 bytes
+typedef char PackedSessionSize[(sizeof(PackedSession) == 16) ? 1 : -1];
+
+#define packsess_State(session)  ((session)->state & PACKSESS_STATE_MASK)
+
+// the time from now to the deadline, negative once it passed
+#define packsess_Left(session, now)  ((long)(int)((session)->deadline - (now)))
+
+void packsess_Init(PackedSession* session, uint32 seed, GameOutput* output);
+void packsess_Load(const PackedSession* packed, GameSession* session);
+void packsess_Store(const GameSession* session, PackedSession* packed);
+int  packsess_Step(PackedSession* session, const GameEvent* event, uint32 now,
+                   GameOutput* output);
+int  packsess_Type(PackedSession* session, uint8 character, GameEvent* event);
+int  packsess_Press(PackedSession* session, int key, GameEvent* event);
+long packsess_Sweep(PackedSession* sessions, long count, uint32 now,
+                    void (*expired)(PackedSession* session, void* context),
+                    void* context);
+
+#endif /*PACKSESS_MOD_H_*/
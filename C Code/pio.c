@@ -26,6 +26,7 @@
 #include "system.h"                   // for QSYS defines
 #include "nios_std_types.h"           // for standard embedded types
 #include "UART.h"
+#include "event.h"                    // for the event queue
 
 
 //*****************************************************************************
@@ -65,7 +66,7 @@ volatile uint32* pioPtr  = ((uint32*)KEY1_KEY2_BASE);
 // DESCRIPTION:
 //    This function will trigger every time either Key 1 or Key 2 on the
 //    DE2 board is pressed.  Based on which one is pressed, one of the two
-//    flags will be raised.
+//    flags will be raised and an event posted for the main loop.
 //
 // INPUT:
 //    context - the Altera ISR requires this. The context is a pointer used to pass context-specific information into the ISR.
@@ -88,10 +89,12 @@ void pio_PushBIsr (void* context)
   if (KEY1 == (pio_reg & KEY1))
   {
     pioKey1Pressed = TRUE;
+    event_Post(EVENT_KEY1, NULL);
   }
   if (KEY2 == (pio_reg & KEY2))
   {
     pioKey2Pressed = TRUE;
+    event_Post(EVENT_KEY2, NULL);
   }
   *(pioPtr + PIO_EDG_CAP_OFFSET) = pio_reg;
 }
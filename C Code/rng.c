@@ -0,0 +1,127 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: rng Functions
+//
+//    FILENAME: rng.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains a small, seedable random number generator
+//              (xoshiro128**).  It only needs 32 bit operations, so it runs
+//              the same on the board and on a host, and a given seed always
+//              gives the same sequence.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "nios_std_types.h"           // for standard embedded types
+#include "rng.h"                      // for rng definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define RNG_ROTL(x, k)  (((x) << (k)) | ((x) >> (32 - (k))))
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: RNG Seed
+//
+// DESCRIPTION:
+//    This function fills the generator state from a 32 bit seed.  The seed
+//    is spread over the four state words with splitmix32, so nearby seeds
+//    give unrelated sequences and the state is never all zero.
+//
+// INPUT:
+//   seed - any value
+//
+// OUTPUT:
+//   rng - the generator state
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void rng_Seed(RngState* rng, uint32 seed)
+{
+  int i;
+  for (i = 0; i < 4; i++)
+  {
+    uint32 z = (seed += 0x9E3779B9);
+    z = (z ^ (z >> 16)) * 0x85EBCA6B;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35;
+    rng->s[i] = z ^ (z >> 16);
+  }
+  if ((rng->s[0] | rng->s[1] | rng->s[2] | rng->s[3]) == 0)
+  {
+    rng->s[0] = 1;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: RNG Next
+//
+// DESCRIPTION:
+//    This function returns the next 32 random bits.
+//
+// INPUT:
+//   rng - the generator state
+//
+// OUTPUT:
+//   rng - the advanced generator state
+//
+// RETURN:
+//   32 random bits
+//----------------------------------------------------------------------------
+uint32 rng_Next(RngState* rng)
+{
+  uint32* s = rng->s;
+  uint32 result = RNG_ROTL(s[1] * 5, 7) * 9;
+  uint32 t = s[1] << 9;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = RNG_ROTL(s[3], 11);
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// NAME: RNG Bounded
+//
+// DESCRIPTION:
+//    This function returns a random number from 0 to bound - 1 with one
+//    draw and no retry: the 32 random bits are scaled by bound and the high
+//    half of the product is kept.  Unlike rand() % n the low bits are not
+//    used, and for the small bounds of a color draw the bias is below one
+//    part in 400 million.
+//
+// INPUT:
+//   rng - the generator state
+//   bound - the number of possible values, at least 1
+//
+// OUTPUT:
+//   rng - the advanced generator state
+//
+// RETURN:
+//   the random number
+//----------------------------------------------------------------------------
+uint32 rng_Bounded(RngState* rng, uint32 bound)
+{
+  return (uint32)(((unsigned long long)rng_Next(rng) * bound) >> 32);
+}
@@ -0,0 +1,36 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: rng Definitions
+//
+//    FILENAME: rng.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the random number
+//              generator state used in rng.c.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef RNG_MOD_H_
+#define RNG_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+// xoshiro128** state, never all zero once seeded
+typedef struct
+{
+  uint32 s[4];
+} RngState;
+
+void   rng_Seed(RngState* rng, uint32 seed);
+uint32 rng_Next(RngState* rng);
+uint32 rng_Bounded(RngState* rng, uint32 bound);
+
+#endif /*RNG_MOD_H_*/
@@ -0,0 +1,377 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: score Functions
+//
+//    FILENAME: score.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the table driven scoring engine.  A code is
+//              packed into an integer with 3 bits per peg, and the feedback
+//              for every pair of distinct-color codes is precomputed so that
+//              scoring a guess is a single table lookup.  The P/C/- hint
+//              string is only built when it is going to be displayed.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for score definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define SCORE_NUM_PACKED      (1 << (SCORE_NUM_PEGS * SCORE_BITS_PER_PEG))
+
+// SCORE_NUM_PATTERNS is written out for four pegs
+typedef char scorePatternsFit[(SCORE_NUM_PEGS == 4) ? 1 : -1];
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+
+// color letters in the same order GenerateSecretCode assigns them
+static const uint8 scoreColorLetters[SCORE_NUM_COLORS] =
+  {'G', 'B', 'R', 'O', 'Y', 'W'};
+
+static uint16 scoreCodeList[SCORE_NUM_SECRETS];
+static int16  scoreCodeIndex[SCORE_NUM_PACKED];
+
+
+//*****************************************************************************
+//                           Define external data
+//*****************************************************************************
+uint8 scoreFeedbackTable[SCORE_NUM_SECRETS * SCORE_NUM_SECRETS];
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Letter To Color
+//
+// DESCRIPTION:
+//    This function converts a color letter into its color number.
+//
+// INPUT:
+//   letter - the color letter typed by the user
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the color number, or SCORE_NUM_COLORS if the letter is not a color
+//----------------------------------------------------------------------------
+static int score_LetterToColor(uint8 letter)
+{
+  int color;
+  for (color = 0; color < SCORE_NUM_COLORS; color++)
+  {
+    if (scoreColorLetters[color] == letter)
+    {
+      break;
+    }
+  }
+  return color;
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Init
+//
+// DESCRIPTION:
+//    This function enumerates every code with no repeated color and fills
+//    the feedback table for every (guess, secret) pair of those codes.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void score_Init(void)
+{
+  int code;
+  int count = 0;
+  int guess;
+  int secret;
+
+  for (code = 0; code < SCORE_NUM_PACKED; code++)
+  {
+    uint32 used = 0;
+    int distinct = TRUE;
+    int i;
+
+    scoreCodeIndex[code] = -1;
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      int color = (code >> (i * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK;
+      if ((color >= SCORE_NUM_COLORS) || (used & (1 << color)))
+      {
+        distinct = FALSE;
+      }
+      used |= 1 << color;
+    }
+    if (distinct)
+    {
+      scoreCodeList[count] = (uint16)code;
+      scoreCodeIndex[code] = (int16)count;
+      count++;
+    }
+  }
+
+  for (guess = 0; guess < SCORE_NUM_SECRETS; guess++)
+  {
+    for (secret = 0; secret < SCORE_NUM_SECRETS; secret++)
+    {
+      SCORE_LOOKUP(guess, secret) =
+        score_ScoreCodes(scoreCodeList[guess], scoreCodeList[secret]);
+    }
+  }
+} /* score_Init */
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Pack Code
+//
+// DESCRIPTION:
+//    This function converts a string of color letters into a packed code.
+//
+// INPUT:
+//   letters - the color letters, one per peg
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed code, or SCORE_INVALID_CODE if a letter is not a color
+//----------------------------------------------------------------------------
+uint16 score_PackCode(const uint8* letters)
+{
+  uint16 code = 0;
+  int i;
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    int color = score_LetterToColor(letters[i]);
+    if (color == SCORE_NUM_COLORS)
+    {
+      return SCORE_INVALID_CODE;
+    }
+    code |= (uint16)(color << (i * SCORE_BITS_PER_PEG));
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Unpack Code
+//
+// DESCRIPTION:
+//    This function converts a packed code back into a NULL terminated string
+//    of color letters.
+//
+// INPUT:
+//   code - the packed code
+//
+// OUTPUT:
+//   letters - the color letters, must hold SCORE_NUM_PEGS + 1 bytes
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void score_UnpackCode(uint16 code, uint8* letters)
+{
+  int i;
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    letters[i] = scoreColorLetters[(code >> (i * SCORE_BITS_PER_PEG)) &
+                                   SCORE_PEG_MASK];
+  }
+  letters[SCORE_NUM_PEGS] = '\0';
+}
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Code Index
+//
+// DESCRIPTION:
+//    This function returns the position of a packed code in the table.
+//
+// INPUT:
+//   code - the packed code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the table index, or -1 if the code repeats a color or is invalid
+//----------------------------------------------------------------------------
+int score_CodeIndex(uint16 code)
+{
+  if (code >= SCORE_NUM_PACKED)
+  {
+    return -1;
+  }
+  return scoreCodeIndex[code];
+}
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Index To Code
+//
+// DESCRIPTION:
+//    This function returns the packed code stored at a table index.
+//
+// INPUT:
+//   index - the table index, 0 to SCORE_NUM_SECRETS - 1
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed code
+//----------------------------------------------------------------------------
+uint16 score_IndexToCode(int index)
+{
+  return scoreCodeList[index];
+}
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Score Codes
+//
+// DESCRIPTION:
+//    This function computes the feedback of a guess against a secret with
+//    the same rules as compareCode: a peg is exact when it matches the
+//    secret in the same position, and color-only when it matches the secret
+//    anywhere else.  It works for any packed code, including repeats.
+//
+// INPUT:
+//   guess - the packed guess
+//   secret - the packed secret code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed feedback
+//----------------------------------------------------------------------------
+uint8 score_ScoreCodes(uint16 guess, uint16 secret)
+{
+  int exact = 0;
+  int color = 0;
+  int i;
+  int j;
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    int peg = (guess >> (i * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK;
+    int is_exact = (peg == ((secret >> (i * SCORE_BITS_PER_PEG)) &
+                            SCORE_PEG_MASK));
+    int present = 0;
+    for (j = 0; j < SCORE_NUM_PEGS; j++)
+    {
+      present |= (peg == ((secret >> (j * SCORE_BITS_PER_PEG)) &
+                          SCORE_PEG_MASK));
+    }
+    exact += is_exact;
+    color += present & !is_exact;
+  }
+  return (uint8)SCORE_FEEDBACK(exact, color);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Pattern Codes
+//
+// DESCRIPTION:
+//    This function computes the hint compareCode would have produced as a
+//    packed pattern, so two secrets give the same pattern exactly when
+//    they give the same hint string.
+//
+// INPUT:
+//   guess - the packed guess
+//   secret - the packed secret code
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed pattern
+//----------------------------------------------------------------------------
+uint8 score_PatternCodes(uint16 guess, uint16 secret)
+{
+  int pattern = 0;
+  int i;
+  int j;
+
+  for (i = SCORE_NUM_PEGS - 1; i >= 0; i--)
+  {
+    int peg = (guess >> (i * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK;
+    int is_exact = (peg == ((secret >> (i * SCORE_BITS_PER_PEG)) &
+                            SCORE_PEG_MASK));
+    int present = 0;
+    for (j = 0; j < SCORE_NUM_PEGS; j++)
+    {
+      present |= (peg == ((secret >> (j * SCORE_BITS_PER_PEG)) &
+                          SCORE_PEG_MASK));
+    }
+    pattern = pattern * 3 + present + is_exact;
+  }
+  return (uint8)pattern;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SCORE Render Hint
+//
+// DESCRIPTION:
+//    This function builds the hint string compareCode would have produced:
+//    'P' for a peg in the correct position, 'C' for a color that is in the
+//    code in another position and '-' otherwise.
+//
+// INPUT:
+//   guess - the packed guess
+//   secret - the packed secret code
+//
+// OUTPUT:
+//   hint - the hint string, must hold SCORE_NUM_PEGS + 1 bytes
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void score_RenderHint(uint16 guess, uint16 secret, uint8* hint)
+{
+  int i;
+  int j;
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    int peg = (guess >> (i * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK;
+    hint[i] = '-';
+    for (j = 0; j < SCORE_NUM_PEGS; j++)
+    {
+      if (peg == ((secret >> (j * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK))
+      {
+        hint[i] = (i == j) ? 'P' : 'C';
+        if (i == j)
+        {
+          break;
+        }
+      }
+    }
+  }
+  hint[SCORE_NUM_PEGS] = '\0';
+}
@@ -0,0 +1,67 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: score Definitions
+//
+//    FILENAME: score.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the packed code format
+//              and the feedback table used in score.c.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef SCORE_MOD_H_
+#define SCORE_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define SCORE_NUM_PEGS        4
+#define SCORE_NUM_COLORS      6
+#define SCORE_BITS_PER_PEG    3
+#define SCORE_PEG_MASK        0x7
+
+// number of codes with no repeated color: 6 * 5 * 4 * 3
+#define SCORE_NUM_SECRETS     360
+
+// a feedback is the pair (exact, color-only) packed into a single byte
+#define SCORE_NUM_FEEDBACKS   ((SCORE_NUM_PEGS + 1) * (SCORE_NUM_PEGS + 1))
+#define SCORE_FEEDBACK(exact, color)  ((exact) * (SCORE_NUM_PEGS + 1) + \
+                                       (color))
+#define SCORE_EXACT(feedback)         ((feedback) / (SCORE_NUM_PEGS + 1))
+#define SCORE_COLOR(feedback)         ((feedback) % (SCORE_NUM_PEGS + 1))
+#define SCORE_WIN_FEEDBACK            SCORE_FEEDBACK(SCORE_NUM_PEGS, 0)
+
+// a pattern is the P/C/- hint the game shows packed into a single byte,
+// one base 3 digit per peg with peg 0 lowest: 0 '-', 1 'C' and 2 'P'
+#define SCORE_NUM_PATTERNS    (3 * 3 * 3 * 3)   // 3 ^ SCORE_NUM_PEGS
+#define SCORE_WIN_PATTERN     (SCORE_NUM_PATTERNS - 1)
+
+#define SCORE_INVALID_CODE    0xFFFF
+
+// (guess index, secret index) -> feedback, valid after score_Init
+#define SCORE_LOOKUP(guess_index, secret_index) \
+  (scoreFeedbackTable[(guess_index) * SCORE_NUM_SECRETS + (secret_index)])
+
+extern uint8 scoreFeedbackTable[SCORE_NUM_SECRETS * SCORE_NUM_SECRETS];
+
+void   score_Init(void);
+uint16 score_PackCode(const uint8* letters);
+void   score_UnpackCode(uint16 code, uint8* letters);
+int    score_CodeIndex(uint16 code);
+uint16 score_IndexToCode(int index);
+uint8  score_ScoreCodes(uint16 guess, uint16 secret);
+uint8  score_PatternCodes(uint16 guess, uint16 secret);
+void   score_RenderHint(uint16 guess, uint16 secret, uint8* hint);
+
+#endif /*SCORE_MOD_H_*/
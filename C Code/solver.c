@@ -0,0 +1,433 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: solver Functions
+//
+//    FILENAME: solver.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the CodeBreaker auto-solver.  It plays
+//              Knuth style minimax: every code is tried as the next guess,
+//              the remaining candidate secrets are split by the feedback
+//              they would give, and the guess whose largest group is the
+//              smallest is played.  Secrets are the distinct-color codes
+//              GenerateSecretCode produces, and the feedback is the P/C/-
+//              pattern the game shows, not classic Mastermind's counts, so
+//              a guess is told which of its pegs hit.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <time.h>                     // for clock
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes and feedback
+#include "batch.h"                    // for the batch scorer
+#include "solver.h"                   // for solver definitions
+#include "book.h"                     // for the opening book
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static uint16 solverGuessList[SOLVER_NUM_GUESSES];
+static uint16 solverFirstGuess = SCORE_INVALID_CODE;
+
+static uint8  solverPegStorage[SCORE_NUM_PEGS][SCORE_NUM_SECRETS];
+static uint8  solverFeedback[SCORE_NUM_SECRETS];
+
+static SolverEvaluator solverEvaluator = NULL;
+
+static const void*        solverBook = NULL;
+static const BookSection* solverBookSection = NULL;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Elapsed Usec
+//
+// DESCRIPTION:
+//    This function converts a clock interval into microseconds.
+//
+// INPUT:
+//   start - the clock value at the start of the interval
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the microseconds since start
+//----------------------------------------------------------------------------
+static uint32 solver_ElapsedUsec(clock_t start)
+{
+  return (uint32)(((double)(clock() - start) * 1000000.0) / CLOCKS_PER_SEC);
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Init
+//
+// DESCRIPTION:
+//    This function lists every code that may be played as a guess and picks
+//    the batch kernel.  It must be called after score_Init and before any
+//    thread evaluates guesses.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void solver_Init(void)
+{
+  int count = 0;
+  int code;
+
+  batch_Init();
+  for (code = 0; code < (1 << (SCORE_NUM_PEGS * SCORE_BITS_PER_PEG)); code++)
+  {
+    int valid = TRUE;
+    int i;
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      if (((code >> (i * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK) >=
+          SCORE_NUM_COLORS)
+      {
+        valid = FALSE;
+      }
+    }
+    if (valid)
+    {
+      solverGuessList[count++] = (uint16)code;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Next Guess
+//
+// DESCRIPTION:
+//    This function picks the minimax guess for a set of candidate secrets.
+//    Ties go to a guess that could itself be the secret, then to the first
+//    guess in code order.  The choice for the full set never changes, so it
+//    is only computed once.
+//
+// INPUT:
+//   candidates - the packed secrets that are still possible
+//   count - the number of candidates, at least 1
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed guess to play
+//----------------------------------------------------------------------------
+uint16 solver_NextGuess(const uint16* candidates, int count)
+{
+  BatchCandidates batch;
+  SolverChoice best;
+  uint16 best_guess;
+  int i;
+
+  if (count == 1)
+  {
+    return candidates[0];
+  }
+  if ((count == SCORE_NUM_SECRETS) && (solverFirstGuess != SCORE_INVALID_CODE))
+  {
+    return solverFirstGuess;
+  }
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    batch.peg[i] = solverPegStorage[i];
+  }
+  batch_LoadCandidates(&batch, candidates, count);
+
+  solver_InitChoice(&best);
+  if (solverEvaluator != NULL)
+  {
+    solverEvaluator(&batch, &best);
+  }
+  else
+  {
+    solver_EvaluateGuesses(&batch, 0, SOLVER_NUM_GUESSES, solverFeedback,
+                           &best);
+  }
+  best_guess = solverGuessList[best.index];
+
+  if (count == SCORE_NUM_SECRETS)
+  {
+    solverFirstGuess = best_guess;
+  }
+  return best_guess;
+} /* solver_NextGuess */
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Solve
+//
+// DESCRIPTION:
+//    This function plays a full game against a secret code and records the
+//    guess, pattern and time taken for every move.
+//
+// INPUT:
+//   secret - the packed secret code, with no repeated color
+//
+// OUTPUT:
+//   result - the moves played
+//
+// RETURN:
+//   the number of guesses used, or 0 if the game was not solved within
+//   SOLVER_MAX_MOVES guesses
+//----------------------------------------------------------------------------
+int solver_Solve(uint16 secret, SolverResult* result)
+{
+  uint16 candidates[SCORE_NUM_SECRETS];
+  uint8 feedbacks[SOLVER_MAX_MOVES];
+  int count = SCORE_NUM_SECRETS;
+  int n;
+
+  for (n = 0; n < SCORE_NUM_SECRETS; n++)
+  {
+    candidates[n] = score_IndexToCode(n);
+  }
+  result->num_moves = 0;
+  result->total_usec = 0;
+
+  while (result->num_moves < SOLVER_MAX_MOVES)
+  {
+    SolverMove* move = &result->moves[result->num_moves];
+    clock_t start = clock();
+    uint32 book_guess = BOOK_NO_GUESS;
+    int kept = 0;
+
+    if (solverBook != NULL)
+    {
+      book_guess = book_Lookup(solverBook, solverBookSection, feedbacks,
+                               result->num_moves);
+    }
+    move->candidates = count;
+    move->guess = (book_guess != BOOK_NO_GUESS) ? (uint16)book_guess :
+                  solver_NextGuess(candidates, count);
+    move->feedback = score_PatternCodes(move->guess, secret);
+    feedbacks[result->num_moves++] = move->feedback;
+    move->usec = solver_ElapsedUsec(start);
+    result->total_usec += move->usec;
+
+    if (move->feedback == SCORE_WIN_PATTERN)
+    {
+      return result->num_moves;
+    }
+
+    // keep only the secrets that would have given the same pattern
+    for (n = 0; n < count; n++)
+    {
+      if (score_PatternCodes(move->guess, candidates[n]) == move->feedback)
+      {
+        candidates[kept++] = candidates[n];
+      }
+    }
+    count = kept;
+  }
+  return 0;
+} /* solver_Solve */
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Evaluate Guesses
+//
+// DESCRIPTION:
+//    This function partitions the candidates under a range of guesses and
+//    keeps the best choice.  Only the caller's feedback buffer and choice
+//    are written, so several threads may evaluate different ranges at once.
+//
+// INPUT:
+//   batch - the candidate secrets
+//   first - the first guess to try, in code order
+//   last - one past the last guess to try
+//
+// OUTPUT:
+//   feedback - scratch buffer that holds one byte per candidate
+//   best - the best choice, updated if a better guess is found
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void solver_EvaluateGuesses(const BatchCandidates* batch, int first,
+                            int last, uint8* feedback, SolverChoice* best)
+{
+  int g;
+  for (g = first; g < last; g++)
+  {
+    uint16 histogram[SCORE_NUM_PATTERNS] = {0};
+    SolverChoice choice;
+    int n;
+    int f;
+
+    batch_Score(solverGuessList[g], batch, feedback);
+    for (n = 0; n < batch->count; n++)
+    {
+      histogram[feedback[n]]++;
+    }
+    choice.worst = 0;
+    for (f = 0; f < SCORE_NUM_PATTERNS; f++)
+    {
+      if (histogram[f] > choice.worst)
+      {
+        choice.worst = histogram[f];
+      }
+    }
+    choice.is_candidate = (histogram[SCORE_WIN_PATTERN] != 0);
+    choice.index = g;
+
+    if (solver_IsBetterChoice(&choice, best))
+    {
+      *best = choice;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Is Better Choice
+//
+// DESCRIPTION:
+//    This function orders two choices: the smaller worst group wins, then a
+//    guess that could be the secret, then the first in code order.  The
+//    order is total, so merging the best choice of several ranges always
+//    gives the same guess as a single pass.
+//
+// INPUT:
+//   choice - the choice being considered
+//   best - the best choice so far
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if choice is better than best
+//----------------------------------------------------------------------------
+int solver_IsBetterChoice(const SolverChoice* choice, const SolverChoice* best)
+{
+  if (choice->worst != best->worst)
+  {
+    return choice->worst < best->worst;
+  }
+  if (choice->is_candidate != best->is_candidate)
+  {
+    return choice->is_candidate;
+  }
+  return choice->index < best->index;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Init Choice
+//
+// DESCRIPTION:
+//    This function sets a choice that every real guess is better than.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   choice - the choice to reset
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void solver_InitChoice(SolverChoice* choice)
+{
+  choice->worst = SCORE_NUM_SECRETS + 1;
+  choice->is_candidate = FALSE;
+  choice->index = SOLVER_NUM_GUESSES;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Set Evaluator
+//
+// DESCRIPTION:
+//    This function installs a replacement for the serial evaluation of
+//    every guess.  The cached first guess is cleared so the new evaluator
+//    is used from the start of the next game.
+//
+// INPUT:
+//   evaluator - the evaluator, or NULL for the serial one
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void solver_SetEvaluator(SolverEvaluator evaluator)
+{
+  solverEvaluator = evaluator;
+  solverFirstGuess = SCORE_INVALID_CODE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Get Guess
+//
+// DESCRIPTION:
+//    This function returns a code that may be played as a guess.
+//
+// INPUT:
+//   index - the position of the guess in code order, below
+//           SOLVER_NUM_GUESSES
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed guess
+//----------------------------------------------------------------------------
+uint16 solver_GetGuess(int index)
+{
+  return solverGuessList[index];
+}
+
+//----------------------------------------------------------------------------
+// NAME: SOLVER Set Book
+//
+// DESCRIPTION:
+//    This function lets solver_Solve take its opening guesses from a book
+//    instead of computing them.  The section must be for the 4x6 game and
+//    should have passed book_CheckSection.
+//
+// INPUT:
+//   book - the start of the book, or NULL to compute every guess
+//   section - the 4x6 section of the book
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void solver_SetBook(const void* book, const BookSection* section)
+{
+  solverBook = (section != NULL) ? book : NULL;
+  solverBookSection = section;
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: solver Definitions
+//
+//    FILENAME: solver.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the data types used in
+//              solver.c.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef SOLVER_MOD_H_
+#define SOLVER_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes and feedback
+#include "batch.h"                    // for the candidate batch
+#include "book.h"                     // for the opening book
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+// every code, repeats allowed, may be played as a guess: 6 ^ 4
+#define SOLVER_NUM_GUESSES    1296
+#define SOLVER_MAX_MOVES      10
+
+typedef struct
+{
+  uint16 guess;                       // packed code that was played
+  uint8  feedback;                    // packed pattern it received
+  int    candidates;                  // secrets still possible before it
+  uint32 usec;                        // time taken to choose it
+} SolverMove;
+
+// the best guess found so far when partitioning the candidates
+typedef struct
+{
+  int worst;                          // size of the largest pattern group
+  int is_candidate;                   // TRUE if the guess could be the secret
+  int index;                          // position of the guess in code order
+} SolverChoice;
+
+// replaces the serial evaluation of every guess, for example with a pool of
+// threads that each call solver_EvaluateGuesses on part of the guesses
+typedef void (*SolverEvaluator)(const BatchCandidates* batch,
+                                SolverChoice* best);
+
+typedef struct
+{
+  int        num_moves;
+  uint32     total_usec;
+  SolverMove moves[SOLVER_MAX_MOVES];
+} SolverResult;
+
+void   solver_Init(void);
+uint16 solver_NextGuess(const uint16* candidates, int count);
+int    solver_Solve(uint16 secret, SolverResult* result);
+void   solver_EvaluateGuesses(const BatchCandidates* batch, int first,
+                              int last, uint8* feedback, SolverChoice* best);
+int    solver_IsBetterChoice(const SolverChoice* choice,
+                             const SolverChoice* best);
+void   solver_InitChoice(SolverChoice* choice);
+void   solver_SetEvaluator(SolverEvaluator evaluator);
+uint16 solver_GetGuess(int index);
+void   solver_SetBook(const void* book, const BookSection* section);
+
+#endif /*SOLVER_MOD_H_*/
@@ -24,6 +24,8 @@
 #include <sys/alt_irq.h>              // for irq support function
 #include "system.h"                   // for QSYS defines
 #include "nios_std_types.h"           // for standard embedded types
+#include "timer.h"                    // for timer definitions
+#include "event.h"                    // for the event queue
 
 //*****************************************************************************
 //                        Define symbolic constants
@@ -82,7 +84,8 @@ volatile uint32* ledr_ptr         = (uint32*)LED_R_BASE;
 //    This function will trigger every time the Timeout Bit of the interval
 //    timer is triggered.  Based on which enable is on, the ISR will trigger
 //    one of three if statements.  If normalEnable is on, the seven-segment
-//    timer will count down every second.  If ledREnable is on, the red LEDs
+//    timer will count down every second, posting a tick, and a timeout
+//    once it reaches zero.  If ledREnable is on, the red LEDs
 //    will toggle on and off every half second.  If ledGEnable is on, the
 //    green LEDs will toggle on and off every quarter second.
 //
@@ -106,12 +109,14 @@ void timer_countdownIsr(void* context)
     if (timerTimeLimit > 0)
     {
       timerTimeLimit--;
+      event_Post(EVENT_TICK, NULL);
     }
     else
     {
       timerTimeExpired = TRUE;
       ledREnable = TRUE;
       normalEnable = FALSE;
+      event_Post(EVENT_TIMEOUT, NULL);
     }
     time_count = 0;
   }
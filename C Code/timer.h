@@ -28,6 +28,7 @@ void timer_StopTimer(void);
 void timer_ConfigureTimerInterrupt(void);
 void timer_EnableTimerInterrupt(void);
 void timer_DisableTimerInterrupt(void);
+void timer_DecimalToBCD(int dec_num);
 uint32 timer_IsTimerExpired(void);
 
 #endif /*TIMER_MOD_H_*/
@@ -0,0 +1,3794 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Host Benchmarks
+//
+//    FILENAME: bench.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the host benchmark program.  Each benchmark
+//              first checks its results against the reference scorer and
+//              then reports its throughput.  The micro benchmarks time the
+//              game's own functions, with the UART and timer drivers
+//              writing to the simulated registers in hostregs.c, and report
+//              the time, cycles and allocations per call.  The events
+//              benchmark runs the whole game in Main.c on its own thread and
+//              drives it through the key, UART and timer ISRs, timing each
+//              event until the game is idle again and measuring the CPU the
+//              game uses while it waits.  The coro benchmark checks the
+//              coroutine sessions against game_Step and reports how many
+//              suspended sessions fit in a GB and how fast they resume.
+//              The packed benchmark keeps a million 16 byte sessions in one
+//              array and times their steps and timeout sweeps.  The uart
+//              benchmark counts the bytes written per read of the UART
+//              control register, checks each transmit policy and the
+//              driver's counters against the JTAG UART model and times the
+//              help message through a slow host.  The link benchmark
+//              writes through the model read at a few rates and FIFO depths
+//              and reports when the write returned, when the last byte left
+//              and how long bytes waited in the FIFO.  The rx benchmark types
+//              lines from a thread of its own as fast as the model takes
+//              them and checks that the main loop's side of the receive
+//              ring gets every one whole.  The linedisc benchmark checks
+//              the line editing against what its echo leaves on a terminal
+//              and times it per character.  The msgcat benchmark checks the
+//              message catalog against its text, reports the bytes it saves
+//              and times its expansion.
+//              Build and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" -Dmain=game_Main -c
+//                    "C Code/Main.c" -o Main.o
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/bench.c"
+//                    "Host Code/pool.c" "Host Code/hostregs.c"
+//                    "Host Code/bookgen.c" "Host Code/fmatgen.c"
+//                    "Host Code/mapfile.c" "Host Code/framepool.c"
+//                    "Host Code/jtaguart.c" Main.o "C Code/linedisc.c"
+//                    "C Code/outq.c" "C Code/msgcat.c"
+//                    "C Code/score.c" "C Code/cosession.c"
+//                    "C Code/packsess.c"
+//                    "C Code/batch.c" "C Code/solver.c" "C Code/engine.c"
+//                    "C Code/rng.c" "C Code/cands.c" "C Code/advisor.c"
+//                    "C Code/book.c" "C Code/fmat.c" "C Code/game.c"
+//                    "C Code/UART.c" "C Code/timer.c" "C Code/pio.c"
+//                    "C Code/display.c" "C Code/event.c" -pthread -lm
+//                    -o bench
+//                ./bench [-j results.json] [benchmark ...]
+//
+//              With no benchmark named, all run but matrix-large, which
+//              writes and scores a 1 GB matrix.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <stdlib.h>                   // for malloc
+#include <string.h>                   // for strcmp
+#include <time.h>                     // for clock_gettime
+#include <unistd.h>                   // for sysconf
+#include <fcntl.h>                    // for posix_fadvise
+#include <pthread.h>                  // for the game thread
+#include <sched.h>                    // for sched_yield
+#include "system.h"                   // for the simulated registers
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for the scoring engine
+#include "batch.h"                    // for the batch scorer
+#include "solver.h"                   // for the auto-solver
+#include "pool.h"                     // for the work stealing pool
+#include "engine.h"                   // for the specialized engines
+#include "rng.h"                      // for the random number generator
+#include "cands.h"                    // for the candidate sets
+#include "advisor.h"                  // for the hint advisor
+#include "book.h"                     // for the opening book
+#include "bookgen.h"                  // for the book builder
+#include "mapfile.h"                  // for mapped files
+#include "fmat.h"                     // for the feedback matrix
+#include "fmatgen.h"                  // for the matrix builder
+#include "game.h"                     // for the game library
+#include "UART.h"                     // for the UART driver
+#include "timer.h"                    // for the timer driver
+#include "event.h"                    // for the event queue
+#include "sys/alt_irq.h"              // for alt_isr_func
+#include "cosession.h"                // for the coroutine sessions
+#include "framepool.h"                // for the coroutine frames
+#include "packsess.h"                 // for the packed sessions
+#include "display.h"                  // for the help message
+#include "jtaguart.h"                 // for the JTAG UART model
+#include "linedisc.h"                 // for the line discipline
+#include "outq.h"                     // for the output queue
+#include "msgcat.h"                   // for the message catalog
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>                // for __rdtsc
+#define BENCH_HAVE_TSC        1
+#else
+#define BENCH_HAVE_TSC        0
+#endif
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define BENCH_MIN_SECONDS     0.5
+#define BENCH_NUM_GUESSES     1296    // every code, repeats allowed
+#define BENCH_NUM_CANDIDATES  (SCORE_NUM_SECRETS * 28 + 5)  // leaves a tail
+
+#define BENCH_POOL_WORKERS    4       // for the check, on any host
+
+#define BENCH_ENGINE_CODES    1024
+#define BENCH_RNG_CODES       (1 << 20)
+#define BENCH_RNG_DRAWS       (SCORE_NUM_SECRETS * 10000)
+#define BENCH_RNG_SEED        12345
+
+#define BENCH_CANDS_GAMES     20
+#define BENCH_CANDS_MOVES     6
+#define BENCH_CANDS_SLOTS     256
+
+#define BENCH_ADVISOR_GAMES   40
+#define BENCH_ADVISOR_BUDGET  200     // usec, to cut the first search short
+
+#define BENCH_BOOK_PATH       "/tmp/bench_opening.book"
+#define BENCH_NUM_BAD_GUESSES 3
+
+#define BENCH_FMAT_PATH       "/tmp/bench_feedback.fmat"
+#define BENCH_FMAT_LOOKUPS    (1 << 20)
+#define BENCH_FMAT_SAMPLES    1000
+
+#define BENCH_MAX_RESULTS     64
+#define BENCH_MICRO_CODES     256     // a power of two, indexed with a mask
+#define BENCH_MICRO_BATCH     4096    // calls between two clock reads
+#define BENCH_HINT_MSG        "\nhint from your guess:  PC--\n"
+
+#define BENCH_EVENT_GAMES     20
+#define BENCH_EVENT_GUESSES   3       // guesses before the timer runs out
+#define BENCH_EVENT_SAMPLES   2048
+#define BENCH_EVENT_IDLE_MSEC 200
+#define BENCH_KEY_EDGE        3       // edge capture register
+#define BENCH_TIMER_TICKS     4       // timer interrupts per second
+
+// the kinds of event the events benchmark times
+#define BENCH_EV_LINE         0
+#define BENCH_EV_KEY2         1
+#define BENCH_EV_TICK         2
+#define BENCH_EV_TIMEOUT      3
+#define BENCH_EV_KEY1         4
+#define BENCH_EV_KINDS        5
+
+#define BENCH_CORO_CHECKS     2000    // random events checked by game_Step
+#define BENCH_CORO_SESSIONS   (1 << 19)
+#define BENCH_CORO_ITEMS      (GAME_MAX_OUTPUTS * 4)
+#define BENCH_GB              (1024.0 * 1024.0 * 1024.0)
+
+#define BENCH_UART_BYTES      5000
+#define BENCH_UART_WRITES     200     // writes of BENCH_UART_BYTES timed
+#define BENCH_UART_RESPONSES  20000   // wrong guess responses timed
+#define BENCH_UART_DRAIN      64      // bytes the slow host reads at a time
+#define BENCH_UART_DRAIN_NSEC 1000000 // between two reads, about 64 KB/s
+
+#define BENCH_LINK_BYTES      4000    // written at once to a rated link
+#define BENCH_LINK_POLL_NSEC  100000  // between two looks at what was sent
+#define BENCH_LINK_SECONDS    5       // longer means the link stopped
+
+#define BENCH_RX_LINES        200000
+#define BENCH_RX_SECONDS      30      // longer means a lost EVENT_RX
+#define BENCH_TERM_WIDTH      40      // columns of the echo's terminal
+
+#define BENCH_MSGCAT_PIECE    128     // bytes expanded at a time, as display.c
+
+#define BENCH_PACKED_SESSIONS (1 << 20)
+#define BENCH_PACKED_SPREAD   60000   // msec over which the games start
+#define BENCH_MB              (1024.0 * 1024.0)
+
+typedef struct
+{
+  const char* name;
+  int (*run)(void);
+  int by_default;                     // run when no benchmark is named
+} BenchEntry;
+
+typedef struct
+{
+  const char* name;
+  uint8  (*score)(uint32 guess, uint32 secret);
+  uint16 (*pattern)(uint32 guess, uint32 secret);
+  uint32 (*generate)(RngState* rng);
+  void   (*generate_bulk)(RngState* rng, uint32* codes, int count);
+  int    (*list)(uint32* codes);
+  int    num_codes;
+  int    num_feedbacks;
+  int    num_patterns;
+} BenchEngine;
+
+typedef struct
+{
+  const char* name;
+  int    ok;
+  double ns_per_op;
+  double cycles_per_op;
+  double allocs_per_op;
+} BenchResult;
+
+typedef struct
+{
+  double seconds;
+  uint64_t cycles;
+  long   allocs;
+} BenchMark;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static uint16 benchGuesses[BENCH_NUM_GUESSES];
+static BenchResult benchResults[BENCH_MAX_RESULTS];
+static int benchNumResults = 0;
+static long benchAllocs = 0;
+static volatile uint32 benchSink;
+
+// secret codes as letters, and the menu lines, for the micro benchmarks
+static uint8 benchLetters[BENCH_MICRO_CODES][SCORE_NUM_PEGS + 1];
+static uint8 benchCommands[][GAME_LINE_MAX + 1] =
+{
+  "HELP", "PLAY", "EXIT", "SOLVE", "JUNK", "STATS", "SEED 1234"
+};
+static GameSession benchSession;
+
+// the terminal the line discipline's echo is checked on
+static char     benchTermRow[BENCH_TERM_WIDTH];
+static char     benchTermLine[BENCH_TERM_WIDTH + 1];  // the row at a new line
+static int      benchTermCursor;
+static LineDisc benchLineDisc;
+
+// the messages the catalog must expand to
+static const char* const benchMessages[MSGCAT_NUM_MESSAGES] =
+{
+#define MSGCAT_TEXT(id, text)  text,
+#include "msgtext.h"
+#undef MSGCAT_TEXT
+};
+
+// the game thread of the events benchmark idles on benchEventCond until an
+// ISR posts; benchIdles counts the times it went idle
+static pthread_mutex_t benchEventLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  benchEventCond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  benchIdleCond = PTHREAD_COND_INITIALIZER;
+static int    benchEventPosted = FALSE;
+static long   benchIdles = 0;
+static long   benchWakes = 0;
+static int    benchGameState = -1;
+static long   benchWins = 0;
+static long   benchLosses = 0;
+static uint32 benchLatency[BENCH_EV_KINDS][BENCH_EVENT_SAMPLES];
+static int    benchNumLatency[BENCH_EV_KINDS];
+static const char* benchEventNames[BENCH_EV_KINDS] =
+{
+  "line", "key2", "tick", "timeout", "key1"
+};
+
+extern alt_isr_func hostIsrTable[HOST_NUM_IRQS];
+extern void*        hostIsrContext[HOST_NUM_IRQS];
+
+#define BENCH_ENGINE_ENTRY(name, pegs, colors, repeats)               \
+  {#name, engine_Score##name, engine_Pattern##name,                  \
+   engine_Generate##name, engine_GenerateBulk##name,                  \
+   engine_ListCodes##name, ENGINE_NUM_CODES_##name,                   \
+   ENGINE_NUM_FEEDBACKS_##name, ENGINE_NUM_PATTERNS_##name},
+
+static const BenchEngine benchEngines[] =
+{
+  ENGINE_CONFIGS(BENCH_ENGINE_ENTRY)
+};
+
+#define BENCH_NUM_ENGINES  (int)(sizeof(benchEngines) / \
+                                 sizeof(benchEngines[0]))
+#define BENCH_NUM_COMMANDS (int)(sizeof(benchCommands) / \
+                                 sizeof(benchCommands[0]))
+
+// packed 4x6 guesses that win against themselves but cannot be played:
+// pegs of 6 and 7 and a bit above the pegs
+static const uint32 benchBadGuesses[BENCH_NUM_BAD_GUESSES] =
+  {0x68E, 0xE88, 0x1688};
+
+
+//*****************************************************************************
+//                           Define external data
+//*****************************************************************************
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Now
+//
+// DESCRIPTION:
+//    This function returns a monotonic time stamp in seconds.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the time stamp
+//----------------------------------------------------------------------------
+static double bench_Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+//----------------------------------------------------------------------------
+// NAME: Malloc, Calloc and Realloc
+//
+// DESCRIPTION:
+//    These functions replace the C library allocator entry points so the
+//    benchmarks can count the allocations made by the code they time.  The
+//    work is passed on to the glibc allocator.
+//
+// INPUT:
+//   size, count, ptr - as for the C library functions
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   as for the C library functions
+//----------------------------------------------------------------------------
+void* malloc(size_t size)
+{
+  __atomic_add_fetch(&benchAllocs, 1, __ATOMIC_RELAXED);
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+  __atomic_add_fetch(&benchAllocs, 1, __ATOMIC_RELAXED);
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+  __atomic_add_fetch(&benchAllocs, 1, __ATOMIC_RELAXED);
+  return __libc_realloc(ptr, size);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Cycles
+//
+// DESCRIPTION:
+//    This function returns the processor time stamp counter, or 0 where
+//    there is none.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the counter value
+//----------------------------------------------------------------------------
+static uint64_t bench_Cycles(void)
+{
+#if BENCH_HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Start
+//
+// DESCRIPTION:
+//    This function marks the start of a timed region.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   mark - the time, cycle count and allocation count at the start
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_Start(BenchMark* mark)
+{
+  mark->allocs = __atomic_load_n(&benchAllocs, __ATOMIC_RELAXED);
+  mark->cycles = bench_Cycles();
+  mark->seconds = bench_Now();
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Record
+//
+// DESCRIPTION:
+//    This function ends a timed region and adds its cost per operation to
+//    the results written by the -j option.
+//
+// INPUT:
+//   mark - the start of the region
+//   name - the result name
+//   ops - the number of operations done in the region
+//   ok - FALSE if the benchmark's check failed
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the recorded result
+//----------------------------------------------------------------------------
+static const BenchResult* bench_Record(const BenchMark* mark, const char* name,
+                                       long ops, int ok)
+{
+  double seconds = bench_Now() - mark->seconds;
+  uint64_t cycles = bench_Cycles() - mark->cycles;
+  long allocs = __atomic_load_n(&benchAllocs, __ATOMIC_RELAXED) - mark->allocs;
+  static BenchResult overflow;
+  BenchResult* result = &overflow;
+
+  if (benchNumResults < BENCH_MAX_RESULTS)
+  {
+    result = &benchResults[benchNumResults++];
+  }
+  result->name = name;
+  result->ok = ok;
+  result->ns_per_op = seconds * 1e9 / ops;
+  result->cycles_per_op = (double)cycles / ops;
+  result->allocs_per_op = (double)allocs / ops;
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Measure
+//
+// DESCRIPTION:
+//    This function calls a micro benchmark in batches until the minimum
+//    time has passed, then records and prints its cost per call.
+//
+// INPUT:
+//   name - the result name
+//   op - runs the code under test the given number of times
+//   ok - FALSE if the benchmark's check failed
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   1 if the check failed, else 0
+//----------------------------------------------------------------------------
+static int bench_Measure(const char* name, void (*op)(long iterations), int ok)
+{
+  const BenchResult* result;
+  BenchMark mark;
+  long ops = 0;
+
+  op(BENCH_MICRO_BATCH);
+  bench_Start(&mark);
+  do
+  {
+    op(BENCH_MICRO_BATCH);
+    ops += BENCH_MICRO_BATCH;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  result = bench_Record(&mark, name, ops, ok);
+
+  printf("%-14s %s  %8.2f ns/op  %8.1f cycles/op  %5.2f allocs/op\n", name,
+         ok ? "ok      " : "FAILED  ", result->ns_per_op,
+         result->cycles_per_op, result->allocs_per_op);
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Write Json
+//
+// DESCRIPTION:
+//    This function writes the recorded results to a JSON file, so runs can
+//    be kept and compared.
+//
+// INPUT:
+//   path - the file to write
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if the file could not be written
+//----------------------------------------------------------------------------
+static int bench_WriteJson(const char* path)
+{
+  FILE* file = fopen(path, "w");
+  int r;
+
+  if (file == NULL)
+  {
+    printf("cannot write %s\n", path);
+    return 1;
+  }
+  fprintf(file, "{\n  \"tsc\": %s,\n  \"results\": [\n",
+          BENCH_HAVE_TSC ? "true" : "false");
+  for (r = 0; r < benchNumResults; r++)
+  {
+    fprintf(file, "    {\"name\": \"%s\", \"ok\": %s, \"ns_per_op\": %.3f, "
+            "\"cycles_per_op\": %.1f, \"allocs_per_op\": %.3f}%s\n",
+            benchResults[r].name, benchResults[r].ok ? "true" : "false",
+            benchResults[r].ns_per_op, benchResults[r].cycles_per_op,
+            benchResults[r].allocs_per_op,
+            (r + 1 < benchNumResults) ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+  return (0 != fclose(file));
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Init Guesses
+//
+// DESCRIPTION:
+//    This function lists every packed code, repeats allowed, as the guesses
+//    used by the benchmarks.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_InitGuesses(void)
+{
+  int count = 0;
+  int code;
+  for (code = 0; code < (1 << (SCORE_NUM_PEGS * SCORE_BITS_PER_PEG)); code++)
+  {
+    int valid = TRUE;
+    int i;
+    for (i = 0; i < SCORE_NUM_PEGS; i++)
+    {
+      if (((code >> (i * SCORE_BITS_PER_PEG)) & SCORE_PEG_MASK) >=
+          SCORE_NUM_COLORS)
+      {
+        valid = FALSE;
+      }
+    }
+    if (valid)
+    {
+      benchGuesses[count++] = (uint16)code;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Batch
+//
+// DESCRIPTION:
+//    This function checks every batch kernel against score_PatternCodes
+//    for every guess and reports the candidates scored per second.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a kernel gave a wrong feedback
+//----------------------------------------------------------------------------
+static int bench_Batch(void)
+{
+  uint16* codes = malloc(BENCH_NUM_CANDIDATES * sizeof(uint16));
+  uint8* storage = malloc(SCORE_NUM_PEGS * BENCH_NUM_CANDIDATES);
+  uint8* feedback = malloc(BENCH_NUM_CANDIDATES);
+  BatchCandidates candidates;
+  int failed = 0;
+  int kernel;
+  int n;
+  int i;
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    candidates.peg[i] = storage + i * BENCH_NUM_CANDIDATES;
+  }
+  for (n = 0; n < BENCH_NUM_CANDIDATES; n++)
+  {
+    codes[n] = score_IndexToCode(n % SCORE_NUM_SECRETS);
+  }
+  batch_LoadCandidates(&candidates, codes, BENCH_NUM_CANDIDATES);
+
+  for (kernel = 0; kernel < BATCH_NUM_KERNELS; kernel++)
+  {
+    static char names[BATCH_NUM_KERNELS][32];
+    BatchKernel run = batch_GetKernel(kernel);
+    BenchMark mark;
+    double start;
+    double elapsed;
+    long scored = 0;
+    int mismatch = 0;
+    int g;
+
+    if (run == NULL)
+    {
+      printf("batch/%-8s unsupported on this processor\n",
+             batch_GetKernelName(kernel));
+      continue;
+    }
+
+    for (g = 0; g < BENCH_NUM_GUESSES; g++)
+    {
+      run(benchGuesses[g], &candidates, feedback);
+      for (n = 0; n < BENCH_NUM_CANDIDATES; n++)
+      {
+        if (feedback[n] != score_PatternCodes(benchGuesses[g], codes[n]))
+        {
+          mismatch = 1;
+        }
+      }
+    }
+
+    bench_Start(&mark);
+    start = mark.seconds;
+    do
+    {
+      for (g = 0; g < BENCH_NUM_GUESSES; g++)
+      {
+        run(benchGuesses[g], &candidates, feedback);
+      }
+      scored += (long)BENCH_NUM_GUESSES * BENCH_NUM_CANDIDATES;
+      elapsed = bench_Now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    snprintf(names[kernel], sizeof(names[kernel]), "batch/%s",
+             batch_GetKernelName(kernel));
+    bench_Record(&mark, names[kernel], scored, !mismatch);
+
+    printf("batch/%-8s %s  %8.1f M candidates/s\n",
+           batch_GetKernelName(kernel), mismatch ? "MISMATCH" : "ok      ",
+           (double)scored / elapsed * 1e-6);
+    failed |= mismatch;
+  }
+
+  free(codes);
+  free(storage);
+  free(feedback);
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Solver
+//
+// DESCRIPTION:
+//    This function lets the solver play against every possible secret and
+//    reports the guesses used and the time taken per game.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a game was not solved
+//----------------------------------------------------------------------------
+static int bench_Solver(void)
+{
+  SolverResult result;
+  BenchMark mark;
+  double start;
+  double elapsed;
+  long total_guesses = 0;
+  int max_guesses = 0;
+  int failed = 0;
+  int s;
+
+  bench_Start(&mark);
+  start = mark.seconds;
+  for (s = 0; s < SCORE_NUM_SECRETS; s++)
+  {
+    int guesses = solver_Solve(score_IndexToCode(s), &result);
+    if (guesses == 0)
+    {
+      failed = 1;
+    }
+    total_guesses += guesses;
+    if (guesses > max_guesses)
+    {
+      max_guesses = guesses;
+    }
+  }
+  elapsed = bench_Now() - start;
+  bench_Record(&mark, "solver", SCORE_NUM_SECRETS, !failed);
+
+  printf("solver         %s  %8.3f ms/game  %.3f avg guesses  %d max\n",
+         failed ? "UNSOLVED" : "ok      ",
+         elapsed * 1e3 / SCORE_NUM_SECRETS,
+         (double)total_guesses / SCORE_NUM_SECRETS, max_guesses);
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Pool Games
+//
+// DESCRIPTION:
+//    This function plays every secret with the serial solver and again
+//    with BENCH_POOL_WORKERS workers, however many cores there are, and
+//    checks that every game plays the same guesses.  The workers then
+//    steal from each other whenever the scheduler switches between them.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a game played a different guess
+//----------------------------------------------------------------------------
+static int bench_PoolGames(void)
+{
+  static SolverResult serial[SCORE_NUM_SECRETS];
+  SolverResult pooled;
+  BenchMark mark;
+  int mismatches = 0;
+  int workers;
+  int ok;
+  int s;
+  int m;
+
+  solver_SetEvaluator(NULL);
+  for (s = 0; s < SCORE_NUM_SECRETS; s++)
+  {
+    solver_Solve(score_IndexToCode(s), &serial[s]);
+  }
+
+  workers = pool_EnableSolver(BENCH_POOL_WORKERS);
+  bench_Start(&mark);
+  for (s = 0; s < SCORE_NUM_SECRETS; s++)
+  {
+    solver_Solve(score_IndexToCode(s), &pooled);
+    if (pooled.num_moves != serial[s].num_moves)
+    {
+      mismatches++;
+      continue;
+    }
+    for (m = 0; m < pooled.num_moves; m++)
+    {
+      if (pooled.moves[m].guess != serial[s].moves[m].guess)
+      {
+        mismatches++;
+        break;
+      }
+    }
+  }
+  // a pool that could not start every worker has not been checked
+  ok = (mismatches == 0) && (workers == BENCH_POOL_WORKERS);
+  bench_Record(&mark, "pool/games", SCORE_NUM_SECRETS, ok);
+  pool_DisableSolver();
+
+  printf("pool/games     %s  %d games on %d workers, %d played differently\n",
+         ok ? "ok      " : "MISMATCH", SCORE_NUM_SECRETS, workers,
+         mismatches);
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Pool
+//
+// DESCRIPTION:
+//    This function times one solver move over a large candidate set with
+//    1 to N worker threads, N being the number of cores, and reports the
+//    speedup over one thread.  Every thread count must choose the same
+//    guess as the serial solver.  The games of bench_PoolGames are played
+//    as well, so several workers are checked even on a single core.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a thread count chose a different guess
+//----------------------------------------------------------------------------
+static int bench_Pool(void)
+{
+  // one short of the full set so the cached first guess is not used
+  uint16 candidates[SCORE_NUM_SECRETS - 1];
+  int count = SCORE_NUM_SECRETS - 1;
+  int max_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  double single = 0.0;
+  uint16 expected;
+  int failed = 0;
+  int threads;
+  int n;
+
+  for (n = 0; n < count; n++)
+  {
+    candidates[n] = score_IndexToCode(n);
+  }
+  expected = solver_NextGuess(candidates, count);
+
+  if (max_threads > POOL_MAX_THREADS)
+  {
+    max_threads = POOL_MAX_THREADS;
+  }
+  for (threads = 1; threads <= max_threads;
+       threads = (threads * 2 > max_threads && threads != max_threads) ?
+                 max_threads : threads * 2)
+  {
+    static char names[POOL_MAX_THREADS + 1][32];
+    BenchMark mark;
+    double start;
+    double elapsed;
+    long moves = 0;
+    int mismatch = 0;
+
+    pool_EnableSolver(threads);
+    bench_Start(&mark);
+    start = mark.seconds;
+    do
+    {
+      if (solver_NextGuess(candidates, count) != expected)
+      {
+        mismatch = 1;
+      }
+      moves++;
+      elapsed = bench_Now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    snprintf(names[threads], sizeof(names[threads]), "pool/%d", threads);
+    bench_Record(&mark, names[threads], moves, !mismatch);
+    pool_DisableSolver();
+
+    if (threads == 1)
+    {
+      single = elapsed / moves;
+    }
+    printf("pool/%-2d        %s  %8.3f ms/move  %5.2fx speedup\n", threads,
+           mismatch ? "MISMATCH" : "ok      ", elapsed * 1e3 / moves,
+           single / (elapsed / moves));
+    failed |= mismatch;
+  }
+  failed |= bench_PoolGames();
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Engine
+//
+// DESCRIPTION:
+//    This function checks the 4x6 engine against score_ScoreCodes and
+//    score_PatternCodes for every pair of codes, then reports the time per
+//    score for every configuration over codes from that configuration's
+//    own generator.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if the 4x6 engine gave a wrong feedback
+//----------------------------------------------------------------------------
+static int bench_Engine(void)
+{
+  static uint32 codes[BENCH_ENGINE_CODES];
+  RngState rng;
+  int failed = 0;
+  int e;
+  int g;
+  int n;
+
+  for (g = 0; g < BENCH_NUM_GUESSES; g++)
+  {
+    for (n = 0; n < BENCH_NUM_GUESSES; n++)
+    {
+      if ((engine_Score4x6(benchGuesses[g], benchGuesses[n]) !=
+           score_ScoreCodes(benchGuesses[g], benchGuesses[n])) ||
+          (engine_Pattern4x6(benchGuesses[g], benchGuesses[n]) !=
+           score_PatternCodes(benchGuesses[g], benchGuesses[n])))
+      {
+        failed = 1;
+      }
+    }
+  }
+
+  rng_Seed(&rng, BENCH_RNG_SEED);
+  for (e = 0; e < BENCH_NUM_ENGINES; e++)
+  {
+    static char names[BENCH_NUM_ENGINES][32];
+    volatile uint32 sink = 0;
+    BenchMark mark;
+    double start;
+    double elapsed;
+    long scored = 0;
+
+    for (n = 0; n < BENCH_ENGINE_CODES; n++)
+    {
+      codes[n] = benchEngines[e].generate(&rng);
+    }
+    bench_Start(&mark);
+    start = mark.seconds;
+    do
+    {
+      uint32 total = 0;
+      for (g = 0; g < BENCH_ENGINE_CODES; g++)
+      {
+        for (n = 0; n < BENCH_ENGINE_CODES; n++)
+        {
+          total += benchEngines[e].score(codes[g], codes[n]);
+        }
+      }
+      sink += total;
+      scored += (long)BENCH_ENGINE_CODES * BENCH_ENGINE_CODES;
+      elapsed = bench_Now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    snprintf(names[e], sizeof(names[e]), "engine/%s", benchEngines[e].name);
+    bench_Record(&mark, names[e], scored, (e != 0) || !failed);
+
+    printf("engine/%-7s %s  %8.2f ns/score  %d codes\n", benchEngines[e].name,
+           (e == 0 && failed) ? "MISMATCH" : "ok      ",
+           elapsed * 1e9 / scored, benchEngines[e].num_codes);
+  }
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Rng
+//
+// DESCRIPTION:
+//    This function checks the secret code generator and reports its
+//    throughput.  The same seed must give the same codes, every 4x6 code
+//    must be valid, and the counts of the 360 codes must pass a chi-square
+//    test against a uniform distribution.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Rng(void)
+{
+  static uint32 codes[BENCH_RNG_CODES];
+  static uint32 counts[SCORE_NUM_SECRETS];
+  RngState rng;
+  RngState replay;
+  double expected = (double)BENCH_RNG_DRAWS / SCORE_NUM_SECRETS;
+  double chi_square = 0.0;
+  double limit;
+  int failed = 0;
+  int e;
+  int n;
+
+  // 359 degrees of freedom: mean 359, five standard deviations above it
+  limit = (SCORE_NUM_SECRETS - 1) + 5.0 * 26.8;
+
+  rng_Seed(&rng, BENCH_RNG_SEED);
+  rng_Seed(&replay, BENCH_RNG_SEED);
+  for (n = 0; n < BENCH_RNG_DRAWS; n++)
+  {
+    uint32 code = engine_Generate4x6(&rng);
+    int index = score_CodeIndex((uint16)code);
+    if ((index < 0) || (code != engine_Generate4x6(&replay)))
+    {
+      failed = 1;
+      break;
+    }
+    counts[index]++;
+  }
+  for (n = 0; n < SCORE_NUM_SECRETS; n++)
+  {
+    double delta = counts[n] - expected;
+    chi_square += delta * delta / expected;
+  }
+  if (chi_square > limit)
+  {
+    failed = 1;
+  }
+  printf("rng/uniform    %s  chi-square %.1f over %d codes (limit %.1f)\n",
+         failed ? "FAILED  " : "ok      ", chi_square, SCORE_NUM_SECRETS,
+         limit);
+
+  for (e = 0; e < BENCH_NUM_ENGINES; e++)
+  {
+    static char names[BENCH_NUM_ENGINES][32];
+    BenchMark mark;
+    double start;
+    double elapsed;
+    long generated = 0;
+
+    bench_Start(&mark);
+    start = mark.seconds;
+    do
+    {
+      benchEngines[e].generate_bulk(&rng, codes, BENCH_RNG_CODES);
+      generated += BENCH_RNG_CODES;
+      elapsed = bench_Now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    snprintf(names[e], sizeof(names[e]), "rng/%s", benchEngines[e].name);
+    bench_Record(&mark, names[e], generated, !failed);
+
+    printf("rng/%-10s ok        %8.1f M codes/s\n", benchEngines[e].name,
+           (double)generated / elapsed * 1e-6);
+  }
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Cands
+//
+// DESCRIPTION:
+//    This function plays random games in every configuration with the
+//    candidate sets and checks each filtered set against a rescan of every
+//    code with the engine's pattern scorer.  It then reports the time to
+//    apply a hint with a cached mask, to build the masks of a new guess,
+//    and to apply the same hint by rescanning the codes.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a set did not match the rescan
+//----------------------------------------------------------------------------
+static int bench_Cands(void)
+{
+  RngState rng;
+  int failed = 0;
+  int e;
+
+  rng_Seed(&rng, BENCH_RNG_SEED);
+  for (e = 0; e < BENCH_NUM_ENGINES; e++)
+  {
+    static char names[BENCH_NUM_ENGINES][32];
+    const BenchEngine* engine = &benchEngines[e];
+    CandsSpace* space = cands_CreateSpace(engine->num_codes,
+                                          engine->num_patterns, engine->list,
+                                          engine->pattern, BENCH_CANDS_SLOTS);
+    uint32 guesses[BENCH_CANDS_MOVES];
+    uint16 feedbacks[BENCH_CANDS_MOVES];
+    CandsSet set;
+    CandsSet full;
+    BenchMark mark;
+    double filter_ns;
+    double build_us;
+    double rescan_ns;
+    long ops;
+    int mismatch = 0;
+    int game;
+    int m;
+    int n;
+
+    if ((space == NULL) || !cands_CreateSet(&set, space) ||
+        !cands_CreateSet(&full, space))
+    {
+      printf("cands/%-8s out of memory\n", engine->name);
+      return 1;
+    }
+    cands_Fill(&full);
+    if (cands_Count(&full) != engine->num_codes)
+    {
+      mismatch = 1;
+    }
+    // the 4x6 space must list its codes in the score module's order
+    for (n = 0; (e == 0) && (n < SCORE_NUM_SECRETS); n++)
+    {
+      if (space->codes[n] != score_IndexToCode(n))
+      {
+        mismatch = 1;
+      }
+    }
+
+    for (game = 0; game < BENCH_CANDS_GAMES; game++)
+    {
+      uint32 secret = engine->generate(&rng);
+      cands_Copy(&set, &full);
+      for (m = 0; m < BENCH_CANDS_MOVES; m++)
+      {
+        uint32 guess = engine->generate(&rng);
+        uint16 feedback = engine->pattern(guess, secret);
+        int count = cands_Filter(&set, space, guess, feedback);
+        int expected = 0;
+
+        guesses[m] = guess;
+        feedbacks[m] = feedback;
+        for (n = 0; n < engine->num_codes; n++)
+        {
+          int keep = TRUE;
+          int k;
+          for (k = 0; k <= m; k++)
+          {
+            if (engine->pattern(guesses[k], space->codes[n]) !=
+                feedbacks[k])
+            {
+              keep = FALSE;
+            }
+          }
+          expected += keep;
+          if (keep != (int)((set.bits[n / CANDS_WORD_BITS] >>
+                             (n % CANDS_WORD_BITS)) & 1))
+          {
+            mismatch = 1;
+          }
+        }
+        if ((count != expected) || (cands_Count(&set) != expected))
+        {
+          mismatch = 1;
+        }
+      }
+    }
+
+    // a hint with its masks in the cache: copy the full set and filter
+    cands_GetMask(space, guesses[0], feedbacks[0]);
+    ops = 0;
+    bench_Start(&mark);
+    do
+    {
+      for (n = 0; n < 64; n++)
+      {
+        cands_Copy(&set, &full);
+        benchSink += cands_Filter(&set, space, guesses[0], feedbacks[0]);
+      }
+      ops += 64;
+    } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+    snprintf(names[e], sizeof(names[e]), "cands/%s", engine->name);
+    filter_ns = bench_Record(&mark, names[e], ops, !mismatch)->ns_per_op;
+
+    // the masks of a guess that is not in the cache
+    ops = 0;
+    bench_Start(&mark);
+    do
+    {
+      uint32 guess = engine->generate(&rng);
+      cands_GetMask(space, guess, 0);
+      ops++;
+    } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+    build_us = (bench_Now() - mark.seconds) * 1e6 / ops;
+
+    // the same hint by scoring every code
+    ops = 0;
+    bench_Start(&mark);
+    do
+    {
+      int count = 0;
+      for (n = 0; n < engine->num_codes; n++)
+      {
+        count += (engine->pattern(guesses[0], space->codes[n]) ==
+                  feedbacks[0]);
+      }
+      benchSink += count;
+      ops++;
+    } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+    rescan_ns = (bench_Now() - mark.seconds) * 1e9 / ops;
+
+    printf("cands/%-8s %s  %8.1f ns/filter  %8.1f us/new guess  "
+           "%9.1f ns/rescan  %d words  %d slots\n", engine->name,
+           mismatch ? "MISMATCH" : "ok      ", filter_ns, build_us, rescan_ns,
+           space->num_words, space->cache_slots);
+    failed |= mismatch;
+    cands_DestroySet(&set);
+    cands_DestroySet(&full);
+    cands_DestroySpace(space);
+  }
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Advisor
+//
+// DESCRIPTION:
+//    This function plays games that follow the advisor's hints.  Every
+//    hint must report the number of secrets that fit the history, must be
+//    one of the guesses, and must come back from the cache when asked for
+//    again.  A small time budget must give a partial answer, and a hint
+//    must be filtered by its P/C/- pattern, not by its counts.  The time
+//    per hint is reported with and without the cache.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Advisor(void)
+{
+  uint16 guesses[SOLVER_MAX_MOVES];
+  uint8 feedbacks[SOLVER_MAX_MOVES];
+  AdvisorHint hint;
+  AdvisorHint again;
+  RngState rng;
+  BenchMark mark;
+  double cold_us = 0.0;
+  double cached_us;
+  long total_moves = 0;
+  long hints = 0;
+  int failed = 0;
+  int game;
+  int n;
+
+  if (!advisor_Init())
+  {
+    printf("advisor        out of memory\n");
+    return 1;
+  }
+  rng_Seed(&rng, BENCH_RNG_SEED);
+  for (game = 0; game < BENCH_ADVISOR_GAMES; game++)
+  {
+    uint16 secret = (uint16)engine_Generate4x6(&rng);
+    int moves = 0;
+
+    advisor_ClearCache();
+    while (moves < SOLVER_MAX_MOVES)
+    {
+      int expected = 0;
+      double start = bench_Now();
+
+      if (!advisor_Suggest(guesses, feedbacks, moves, ADVISOR_NO_BUDGET,
+                           &hint))
+      {
+        failed = 1;
+        break;
+      }
+      cold_us += (bench_Now() - start) * 1e6;
+      hints++;
+
+      for (n = 0; n < SCORE_NUM_SECRETS; n++)
+      {
+        int keep = TRUE;
+        int m;
+        for (m = 0; m < moves; m++)
+        {
+          if (score_PatternCodes(guesses[m], score_IndexToCode(n)) !=
+              feedbacks[m])
+          {
+            keep = FALSE;
+          }
+        }
+        expected += keep;
+      }
+      if ((hint.candidates != expected) || !hint.complete || hint.cached ||
+          !advisor_Suggest(guesses, feedbacks, moves, ADVISOR_NO_BUDGET,
+                           &again) ||
+          !again.cached || (again.guess != hint.guess))
+      {
+        failed = 1;
+      }
+
+      guesses[moves] = hint.guess;
+      feedbacks[moves] = score_PatternCodes(hint.guess, secret);
+      moves++;
+      if (feedbacks[moves - 1] == SCORE_WIN_PATTERN)
+      {
+        break;
+      }
+    }
+    if (feedbacks[moves - 1] != SCORE_WIN_PATTERN)
+    {
+      failed = 1;
+    }
+    total_moves += moves;
+  }
+
+  // the opening is cached by now
+  n = 0;
+  bench_Start(&mark);
+  do
+  {
+    advisor_Suggest(guesses, feedbacks, 0, ADVISOR_NO_BUDGET, &hint);
+    n++;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  cached_us = bench_Record(&mark, "advisor/cached", n, !failed)->ns_per_op *
+              1e-3;
+
+  advisor_ClearCache();
+  advisor_Suggest(guesses, feedbacks, 0, BENCH_ADVISOR_BUDGET, &hint);
+  if (hint.complete || (hint.evaluated == 0) ||
+      (score_CodeIndex(hint.guess) < 0))
+  {
+    failed = 1;
+  }
+
+  // GBYW shows PP-- against GBRO, which leaves only GBRO and GBOR; the
+  // counts of two exact and no color would leave 12
+  guesses[0] = score_PackCode((const uint8*)"GBYW");
+  feedbacks[0] = score_PatternCodes(guesses[0],
+                                    score_PackCode((const uint8*)"GBRO"));
+  if (!advisor_Suggest(guesses, feedbacks, 1, ADVISOR_NO_BUDGET, &again) ||
+      (again.candidates != 2))
+  {
+    failed = 1;
+  }
+
+  printf("advisor        %s  %8.1f us/hint  %6.3f us/cached hint  "
+         "%.3f avg guesses\n", failed ? "FAILED  " : "ok      ",
+         cold_us / hints, cached_us,
+         (double)total_moves / BENCH_ADVISOR_GAMES);
+  printf("advisor/budget %s  %d of %d guesses in %d us, %lu.%03lu bits\n",
+         failed ? "FAILED  " : "ok      ", hint.evaluated, SOLVER_NUM_GUESSES,
+         BENCH_ADVISOR_BUDGET,
+         (unsigned long)(hint.entropy_milli / 1000),
+         (unsigned long)(hint.entropy_milli % 1000));
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Book
+//
+// DESCRIPTION:
+//    This function builds the opening book, writes it out and maps it back.
+//    The mapped book must pass the scoring rules check, a corrupted copy
+//    must be rejected, and the solver must play every game the same with
+//    the book as without it.  It reports the time of the first two moves
+//    from a cold start with and without the book.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Book(void)
+{
+  static uint32 codes[ENGINE_NUM_CODES_4x6];
+  static SolverResult plain[SCORE_NUM_SECRETS];
+  SolverResult booked;
+  const BookSection* section;
+  BookSection* bad_section;
+  BookEntry* entry;
+  BookHeader* header;
+  MapFile file;
+  BenchMark mark;
+  uint32 size;
+  uint8* book;
+  double open_us;
+  double cold_us = 0.0;
+  double warm_us = 0.0;
+  int failed = 0;
+  int n;
+  int m;
+
+  engine_ListCodes4x6(codes);
+  book = bookgen_Build(&size);
+  if ((book == NULL) || !mapfile_Write(BENCH_BOOK_PATH, book, size))
+  {
+    printf("book           cannot build %s\n", BENCH_BOOK_PATH);
+    free(book);
+    return 1;
+  }
+
+  bench_Start(&mark);
+  if (!mapfile_Open(&file, BENCH_BOOK_PATH))
+  {
+    printf("book           cannot map %s\n", BENCH_BOOK_PATH);
+    free(book);
+    return 1;
+  }
+  section = book_FindSection(file.data, (uint32)file.size, ENGINE_PEGS_4x6,
+                             ENGINE_COLORS_4x6, ENGINE_REPEATS_4x6);
+  if ((section == NULL) ||
+      !book_CheckSection(file.data, section, codes, engine_Pattern4x6))
+  {
+    failed = 1;
+  }
+  open_us = (bench_Now() - mark.seconds) * 1e6;
+
+  // a flipped byte fails the checksum, a wrong count fails the rules
+  header = (BookHeader*)book;
+  book[size - 1] ^= 1;
+  if (NULL != book_FindSection(book, size, ENGINE_PEGS_4x6,
+                               ENGINE_COLORS_4x6, ENGINE_REPEATS_4x6))
+  {
+    failed = 1;
+  }
+  book[size - 1] ^= 1;
+  entry = (BookEntry*)(book + ((BookSection*)(header + 1))->entries);
+  entry->candidates++;
+  header->checksum = book_Checksum(book + sizeof(BookHeader),
+                                   size - sizeof(BookHeader));
+  if ((NULL == book_FindSection(book, size, ENGINE_PEGS_4x6,
+                                ENGINE_COLORS_4x6, ENGINE_REPEATS_4x6)) ||
+      book_CheckSection(book, (BookSection*)(header + 1), codes,
+                        engine_Pattern4x6))
+  {
+    failed = 1;
+  }
+  entry->candidates--;
+
+  // a guess that cannot be played fails the rules, even though it scores
+  // as a win against itself, and misaligned entries fail the header
+  bad_section = (BookSection*)(header + 1);
+  entry = (BookEntry*)(book + bad_section->entries);
+  for (m = 0; entry[m].guess == BOOK_NO_GUESS; m++)
+  {
+  }
+  for (n = 0; n < 2 * BENCH_NUM_BAD_GUESSES; n++)
+  {
+    uint32* guess = (n & 1) ? &entry[m].guess : &bad_section->first_guess;
+    uint32 good = *guess;
+    *guess = benchBadGuesses[n / 2];
+    header->checksum = book_Checksum(book + sizeof(BookHeader),
+                                     size - sizeof(BookHeader));
+    if ((NULL == book_FindSection(book, size, ENGINE_PEGS_4x6,
+                                  ENGINE_COLORS_4x6, ENGINE_REPEATS_4x6)) ||
+        book_CheckSection(book, bad_section, codes, engine_Pattern4x6))
+    {
+      failed = 1;
+    }
+    *guess = good;
+  }
+  bad_section->entries += 2;
+  header->checksum = book_Checksum(book + sizeof(BookHeader),
+                                   size - sizeof(BookHeader));
+  if (NULL != book_FindSection(book, size, ENGINE_PEGS_4x6,
+                               ENGINE_COLORS_4x6, ENGINE_REPEATS_4x6))
+  {
+    failed = 1;
+  }
+  free(book);
+
+  if (failed)
+  {
+    printf("book           FAILED    the book checks did not hold\n");
+    mapfile_Close(&file);
+    remove(BENCH_BOOK_PATH);
+    return 1;
+  }
+
+  for (n = 0; n < SCORE_NUM_SECRETS; n++)
+  {
+    solver_SetEvaluator(NULL);
+    solver_Solve(score_IndexToCode(n), &plain[n]);
+    for (m = 0; (m < 2) && (m < plain[n].num_moves); m++)
+    {
+      cold_us += plain[n].moves[m].usec;
+    }
+  }
+  solver_SetBook(file.data, section);
+  for (n = 0; n < SCORE_NUM_SECRETS; n++)
+  {
+    solver_SetEvaluator(NULL);
+    solver_Solve(score_IndexToCode(n), &booked);
+    if (booked.num_moves != plain[n].num_moves)
+    {
+      failed = 1;
+      continue;
+    }
+    for (m = 0; m < booked.num_moves; m++)
+    {
+      if (booked.moves[m].guess != plain[n].moves[m].guess)
+      {
+        failed = 1;
+      }
+    }
+    for (m = 0; (m < 2) && (m < booked.num_moves); m++)
+    {
+      warm_us += booked.moves[m].usec;
+    }
+  }
+  solver_SetBook(NULL, NULL);
+
+  n = 0;
+  bench_Start(&mark);
+  do
+  {
+    for (m = 0; m < 64; m++)
+    {
+      uint8 feedback = (uint8)(m % SCORE_NUM_PATTERNS);
+      benchSink += book_Lookup(file.data, section, &feedback, m & 1);
+    }
+    n += 64;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  bench_Record(&mark, "book/lookup", n, !failed);
+  mapfile_Close(&file);
+  remove(BENCH_BOOK_PATH);
+
+  printf("book           %s  %8.1f us to map and check  %lu bytes\n",
+         failed ? "MISMATCH" : "ok      ", open_us, (unsigned long)size);
+  printf("book/opening   %s  %8.1f us computed  %8.1f us from the book  "
+         "%.2f ns/lookup\n", failed ? "MISMATCH" : "ok      ",
+         cold_us / SCORE_NUM_SECRETS, warm_us / SCORE_NUM_SECRETS,
+         benchResults[benchNumResults - 1].ns_per_op);
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Matrix Config
+//
+// DESCRIPTION:
+//    This function compares a mapped feedback matrix with scoring on the
+//    fly for one configuration.  Cold start is the time to compute the
+//    whole matrix in memory against the time to map the file, with its
+//    pages dropped from the page cache first, and check it.  Steady state
+//    is the rate of random lookups and of scans of one guess against every
+//    secret.  The mapped matrix must match the scorer on every pair
+//    computed.
+//
+// INPUT:
+//   engine - the configuration
+//   pegs, colors, repeats - the configuration's parameters
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_MatrixConfig(const BenchEngine* engine, int pegs, int colors,
+                              int repeats)
+{
+  static char names[2][BENCH_NUM_ENGINES][32];
+  size_t num_codes = (size_t)engine->num_codes;
+  uint32* codes = malloc(sizeof(uint32) * num_codes);
+  uint32* pairs = malloc(sizeof(uint32) * 2 * BENCH_FMAT_LOOKUPS);
+  uint8* matrix = malloc(num_codes * num_codes);
+  int e = (int)(engine - benchEngines);
+  double compute_s;
+  double map_us;
+  double mapped_ns;
+  double scored_ns;
+  double mapped_scan_us;
+  double scored_scan_us;
+  RngState rng;
+  MapFile file;
+  FmatView view;
+  BenchMark mark;
+  uint32 total;
+  int failed = 0;
+  long ops;
+  size_t g;
+  size_t n;
+  int fd;
+
+  if ((codes == NULL) || (pairs == NULL) || (matrix == NULL) ||
+      !fmatgen_Write(BENCH_FMAT_PATH, pegs, colors, repeats, engine->num_codes,
+                     engine->num_feedbacks, engine->list, engine->score))
+  {
+    printf("matrix/%-7s cannot build %s\n", engine->name, BENCH_FMAT_PATH);
+    free(codes);
+    free(pairs);
+    free(matrix);
+    return 1;
+  }
+  engine->list(codes);
+
+  // cold start by computing every pair
+  bench_Start(&mark);
+  for (g = 0; g < num_codes; g++)
+  {
+    for (n = 0; n < num_codes; n++)
+    {
+      matrix[g * num_codes + n] = engine->score(codes[g], codes[n]);
+    }
+  }
+  compute_s = bench_Now() - mark.seconds;
+
+  // cold start by mapping, once the file is out of the page cache
+  fd = open(BENCH_FMAT_PATH, O_RDONLY);
+  if (fd >= 0)
+  {
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+  }
+  bench_Start(&mark);
+  if (!mapfile_Open(&file, BENCH_FMAT_PATH) ||
+      !fmat_Open(&view, file.data, file.size, pegs, colors, repeats) ||
+      !fmat_Check(&view, codes, engine->score, BENCH_FMAT_SAMPLES))
+  {
+    printf("matrix/%-7s FAILED    the mapped matrix does not check\n",
+           engine->name);
+    mapfile_Close(&file);
+    remove(BENCH_FMAT_PATH);
+    free(codes);
+    free(pairs);
+    free(matrix);
+    return 1;
+  }
+  map_us = (bench_Now() - mark.seconds) * 1e6;
+
+  for (g = 0; g < num_codes; g++)
+  {
+    for (n = 0; n < num_codes; n++)
+    {
+      if (FMAT_LOOKUP(&view, g, n) != matrix[g * num_codes + n])
+      {
+        failed = 1;
+      }
+    }
+  }
+
+  // steady state random lookups
+  rng_Seed(&rng, BENCH_RNG_SEED);
+  for (n = 0; n < 2 * BENCH_FMAT_LOOKUPS; n++)
+  {
+    pairs[n] = rng_Bounded(&rng, engine->num_codes);
+  }
+  ops = 0;
+  bench_Start(&mark);
+  do
+  {
+    total = 0;
+    for (n = 0; n < BENCH_FMAT_LOOKUPS; n++)
+    {
+      total += FMAT_LOOKUP(&view, pairs[2 * n], pairs[2 * n + 1]);
+    }
+    benchSink += total;
+    ops += BENCH_FMAT_LOOKUPS;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  snprintf(names[0][e], sizeof(names[0][e]), "matrix/%s", engine->name);
+  mapped_ns = bench_Record(&mark, names[0][e], ops, !failed)->ns_per_op;
+
+  ops = 0;
+  bench_Start(&mark);
+  do
+  {
+    total = 0;
+    for (n = 0; n < BENCH_FMAT_LOOKUPS; n++)
+    {
+      total += engine->score(codes[pairs[2 * n]], codes[pairs[2 * n + 1]]);
+    }
+    benchSink += total;
+    ops += BENCH_FMAT_LOOKUPS;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  snprintf(names[1][e], sizeof(names[1][e]), "matrix/%s/scored",
+           engine->name);
+  scored_ns = bench_Record(&mark, names[1][e], ops, !failed)->ns_per_op;
+
+  // steady state scans of one guess against every secret
+  ops = 0;
+  bench_Start(&mark);
+  do
+  {
+    uint32 guess = pairs[ops % BENCH_FMAT_LOOKUPS];
+    total = 0;
+    for (n = 0; n < num_codes; n++)
+    {
+      total += FMAT_LOOKUP(&view, guess, n);
+    }
+    benchSink += total;
+    ops++;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  mapped_scan_us = (bench_Now() - mark.seconds) * 1e6 / ops;
+
+  ops = 0;
+  bench_Start(&mark);
+  do
+  {
+    uint32 guess = codes[pairs[ops % BENCH_FMAT_LOOKUPS]];
+    total = 0;
+    for (n = 0; n < num_codes; n++)
+    {
+      total += engine->score(guess, codes[n]);
+    }
+    benchSink += total;
+    ops++;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  scored_scan_us = (bench_Now() - mark.seconds) * 1e6 / ops;
+
+  printf("matrix/%-7s %s  start %10.1f us computed  %8.1f us mapped  "
+         "%llu bytes\n", engine->name, failed ? "MISMATCH" : "ok      ",
+         compute_s * 1e6, map_us, file.size);
+  printf("matrix/%-7s %s  random %6.2f ns mapped  %6.2f ns scored  "
+         "scan %8.2f us mapped  %8.2f us scored\n", engine->name,
+         failed ? "MISMATCH" : "ok      ", mapped_ns, scored_ns,
+         mapped_scan_us, scored_scan_us);
+
+  mapfile_Close(&file);
+  remove(BENCH_FMAT_PATH);
+  free(codes);
+  free(pairs);
+  free(matrix);
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Matrix and Matrix Large
+//
+// DESCRIPTION:
+//    These functions run bench_MatrixConfig for the 4x6 game and for the
+//    5x8 configuration, whose matrix is 1 GB.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Matrix(void)
+{
+  return bench_MatrixConfig(&benchEngines[0], ENGINE_PEGS_4x6,
+                            ENGINE_COLORS_4x6, ENGINE_REPEATS_4x6);
+}
+
+static int bench_MatrixLarge(void)
+{
+  return bench_MatrixConfig(&benchEngines[1], ENGINE_PEGS_5x8,
+                            ENGINE_COLORS_5x8, ENGINE_REPEATS_5x8);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Op Compare Code, Generate, Decimal To BCD, Send Byte,
+//       Send String and Menu Command
+//
+// DESCRIPTION:
+//    These functions run one game function the given number of times for
+//    bench_Measure.  The inputs cycle through small tables so the calls
+//    are not all alike.
+//
+// INPUT:
+//   iterations - the number of calls
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_OpScoreGuess(long iterations)
+{
+  uint32 total = 0;
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    GameHint hint =
+      game_ScoreGuess(benchLetters[n & (BENCH_MICRO_CODES - 1)],
+                      benchLetters[(n * 7 + 3) & (BENCH_MICRO_CODES - 1)]);
+    total += hint.exact + hint.text[0];
+  }
+  benchSink += total;
+}
+
+static void bench_OpGenerate(long iterations)
+{
+  uint8 code[SCORE_NUM_PEGS + 1];
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    game_GenerateSecret(&benchSession, code);
+    benchSink += code[0];
+  }
+}
+
+static void bench_OpDecimalToBCD(long iterations)
+{
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    timer_DecimalToBCD((int)(n % 100));
+  }
+}
+
+static void bench_OpSendByte(long iterations)
+{
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    uart_SendByte((uint8)n);
+  }
+}
+
+static void bench_OpSendString(long iterations)
+{
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    uart_SendString(BENCH_HINT_MSG);
+  }
+}
+
+static void bench_OpMenuCommand(long iterations)
+{
+  uint32 total = 0;
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    total += game_MenuCommand(benchCommands[n % BENCH_NUM_COMMANDS]);
+  }
+  benchSink += total;
+}
+
+static void bench_OpStep(long iterations)
+{
+  GameEvent event;
+  GameOutput output;
+  uint32 total = 0;
+  long n;
+  for (n = 0; n < iterations; n++)
+  {
+    // play game after game, always losing to the guesses in benchLetters
+    event.type = GAME_EVENT_NONE;
+    if (benchSession.state == eGAME_IDLE)
+    {
+      event.type = GAME_EVENT_LINE;
+      memcpy(event.line, "PLAY", 5);
+    }
+    else if (benchSession.state == eWAITING_4_USER)
+    {
+      event.type = (benchSession.history_moves < 8) ? GAME_EVENT_LINE :
+                                                      GAME_EVENT_TIMEOUT;
+      memcpy(event.line, benchLetters[n & (BENCH_MICRO_CODES - 1)],
+             SCORE_NUM_PEGS + 1);
+    }
+    else if (benchSession.state == eWAIT_4_KEY1)
+    {
+      event.type = GAME_EVENT_KEY1;
+    }
+    game_Step(&benchSession, &event, &output);
+    total += output.count;
+  }
+  benchSink += total;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Check Step
+//
+// DESCRIPTION:
+//    This function plays a scripted game through game_Step: a wrong guess
+//    must be answered with its hint, the secret must win, and KEY1 must
+//    return to the main menu.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the game went as it should, else FALSE
+//----------------------------------------------------------------------------
+static int bench_CheckStep(void)
+{
+  GameSession session;
+  GameEvent event;
+  GameOutput output;
+  GameHint hint;
+  int ok = TRUE;
+
+  game_Init(&session, BENCH_RNG_SEED, &output);
+  ok &= (output.count > 0) && (output.items[0].type == GAME_OUT_WELCOME);
+
+  event.type = GAME_EVENT_LINE;
+  memcpy(event.line, "PLAY", 5);
+  game_Step(&session, &event, &output);
+  event.type = GAME_EVENT_NONE;
+  game_Step(&session, &event, &output);
+  game_Step(&session, &event, &output);
+  ok &= (session.state == eWAITING_4_USER);
+
+  // a step with nothing to do changes nothing
+  game_Step(&session, &event, &output);
+  ok &= (session.state == eWAITING_4_USER) && (output.count == 0);
+
+  memcpy(event.line, "BGRO", 5);
+  if (0 == memcmp(session.secret, "BGRO", 5))
+  {
+    memcpy(event.line, "GBRO", 5);
+  }
+  hint = game_ScoreGuess(event.line, session.secret);
+  event.type = GAME_EVENT_LINE;
+  game_Step(&session, &event, &output);
+  ok &= (session.state == eREQUEST_GUESS) && (session.history_moves == 1) &&
+        (output.items[1].type == GAME_OUT_WRONG_GUESS) &&
+        (0 == memcmp(output.items[1].hint, hint.text, SCORE_NUM_PEGS + 1));
+
+  event.type = GAME_EVENT_NONE;
+  game_Step(&session, &event, &output);
+  memcpy(event.line, session.secret, SCORE_NUM_PEGS + 1);
+  event.type = GAME_EVENT_LINE;
+  game_Step(&session, &event, &output);
+  ok &= (session.state == eWIN_GAME);
+  game_Step(&session, &event, &output);
+  ok &= (session.state == eWAIT_4_KEY1);
+  event.type = GAME_EVENT_KEY1;
+  game_Step(&session, &event, &output);
+  ok &= (session.state == eGAME_IDLE);
+  return ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Micro
+//
+// DESCRIPTION:
+//    This function checks and times the game's own functions:
+//    game_ScoreGuess against score_RenderHint for every pair of secret
+//    codes, the secret code generator, the seven segment BCD conversion,
+//    the UART send functions against the simulated data register, the main
+//    menu dispatch and a step of the game library.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Micro(void)
+{
+  uint8 guess[SCORE_NUM_PEGS + 1];
+  uint8 secret[SCORE_NUM_PEGS + 1];
+  uint8 hint[SCORE_NUM_PEGS + 1];
+  int compare_ok = TRUE;
+  int generate_ok = TRUE;
+  int bcd_ok;
+  int byte_ok;
+  int string_ok;
+  int menu_ok;
+  int step_ok;
+  int failed = 0;
+  int g;
+  int n;
+
+  for (g = 0; g < SCORE_NUM_SECRETS; g++)
+  {
+    score_UnpackCode(score_IndexToCode(g), guess);
+    for (n = 0; n < SCORE_NUM_SECRETS; n++)
+    {
+      score_UnpackCode(score_IndexToCode(n), secret);
+      score_RenderHint(score_IndexToCode(g), score_IndexToCode(n), hint);
+      GameHint compared = game_ScoreGuess(guess, secret);
+      if ((compared.exact !=
+           SCORE_EXACT(score_ScoreCodes(score_IndexToCode(g),
+                                        score_IndexToCode(n)))) ||
+          (0 != memcmp(compared.text, hint, SCORE_NUM_PEGS + 1)))
+      {
+        compare_ok = FALSE;
+      }
+    }
+  }
+
+  rng_Seed(&benchSession.rng, BENCH_RNG_SEED);
+  for (n = 0; n < BENCH_MICRO_CODES; n++)
+  {
+    game_GenerateSecret(&benchSession, benchLetters[n]);
+    if (score_CodeIndex(score_PackCode(benchLetters[n])) < 0)
+    {
+      generate_ok = FALSE;
+    }
+  }
+
+  timer_DecimalToBCD(59);
+  bcd_ok = (hostSevenSegRegs[0] == 0x59);
+  jtaguart_ClearOutput();
+  uart_SendByte('P');
+  byte_ok = (0 == strcmp(hostJtagUart.out, "P"));
+  uart_SendString(BENCH_HINT_MSG);
+  string_ok = (0 == strcmp(hostJtagUart.out + 1, BENCH_HINT_MSG));
+  menu_ok = (game_MenuCommand((uint8*)"PLAY") !=
+             game_MenuCommand((uint8*)"JUNK"));
+  step_ok = bench_CheckStep();
+
+  failed |= bench_Measure("scoreGuess", bench_OpScoreGuess, compare_ok);
+  failed |= bench_Measure("generate", bench_OpGenerate, generate_ok);
+  failed |= bench_Measure("bcd", bench_OpDecimalToBCD, bcd_ok);
+  failed |= bench_Measure("uart/byte", bench_OpSendByte, byte_ok);
+  failed |= bench_Measure("uart/string", bench_OpSendString, string_ok);
+  failed |= bench_Measure("menu", bench_OpMenuCommand, menu_ok);
+  failed |= bench_Measure("step", bench_OpStep, step_ok);
+  return failed;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Compare Latency
+//
+// DESCRIPTION:
+//    This function orders latency samples for qsort.
+//
+// INPUT:
+//   a - the first sample
+//   b - the second sample
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   less than, equal to or greater than zero
+//----------------------------------------------------------------------------
+static int bench_CompareLatency(const void* a, const void* b)
+{
+  uint32 x = *(const uint32*)a;
+  uint32 y = *(const uint32*)b;
+  return (x > y) - (x < y);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Game Thread
+//
+// DESCRIPTION:
+//    This function runs the game in Main.c for the events benchmark.
+//
+// INPUT:
+//   arg - unused
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   NULL
+//----------------------------------------------------------------------------
+int game_Main(void);
+
+static void* bench_GameThread(void* arg)
+{
+  (void)arg;
+  game_Main();
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Wait Idle
+//
+// DESCRIPTION:
+//    This function waits until the game thread has gone idle more times
+//    than given.
+//
+// INPUT:
+//   idles - the idle count to pass
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the new idle count
+//----------------------------------------------------------------------------
+static long bench_WaitIdle(long idles)
+{
+  long now;
+
+  pthread_mutex_lock(&benchEventLock);
+  while (benchIdles <= idles)
+  {
+    pthread_cond_wait(&benchIdleCond, &benchEventLock);
+  }
+  now = benchIdles;
+  pthread_mutex_unlock(&benchEventLock);
+  return now;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Interrupt
+//
+// DESCRIPTION:
+//    This function raises a simulated interrupt, holding the simulated
+//    CPU as the board would; the UART's is raised by typing a character
+//    into the JTAG UART model.  If the ISR posts an event, the time until
+//    the game is idle again is kept as a sample of the given kind.
+//
+// INPUT:
+//   irq - the interrupt number
+//   character - the character typed, for the UART
+//   kind - the BENCH_EV_ kind of the event expected; a timer interrupt
+//          that ends the guess is counted as a timeout
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the ISR posted an event
+//----------------------------------------------------------------------------
+static int bench_Interrupt(int irq, uint8 character, int kind)
+{
+  alt_irq_context context;
+  long idles;
+  long wakes;
+  double start;
+  double latency;
+
+  pthread_mutex_lock(&benchEventLock);
+  idles = benchIdles;
+  wakes = benchWakes;
+  pthread_mutex_unlock(&benchEventLock);
+
+  start = bench_Now();
+  if (irq == JTAG_UART_0_IRQ)
+  {
+    jtaguart_Receive(character);
+  }
+  else
+  {
+    context = alt_irq_disable_all();
+    hostIsrTable[irq](hostIsrContext[irq]);
+    alt_irq_enable_all(context);
+  }
+
+  pthread_mutex_lock(&benchEventLock);
+  wakes = benchWakes - wakes;
+  pthread_mutex_unlock(&benchEventLock);
+  if (wakes == 0)
+  {
+    return FALSE;
+  }
+  bench_WaitIdle(idles);
+  latency = (bench_Now() - start) * 1e9;
+  if ((irq == TIMER_0_IRQ) && (benchGameState != eWAITING_4_USER))
+  {
+    // the timer only ends a guess with its timeout
+    kind = BENCH_EV_TIMEOUT;
+  }
+  if (benchNumLatency[kind] < BENCH_EVENT_SAMPLES)
+  {
+    benchLatency[kind][benchNumLatency[kind]++] = (uint32)latency;
+  }
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Type
+//
+// DESCRIPTION:
+//    This function types a line into the JTAG UART model, one receive
+//    interrupt per character, and ends it with RETURN if asked.
+//
+// INPUT:
+//   line - the characters to type
+//   enter - TRUE to end the line with RETURN
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_Type(const char* line, int enter)
+{
+  while (*line != '\0')
+  {
+    bench_Interrupt(JTAG_UART_0_IRQ, (uint8)*line++, BENCH_EV_LINE);
+  }
+  if (enter)
+  {
+    bench_Interrupt(JTAG_UART_0_IRQ, '\n', BENCH_EV_LINE);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Press
+//
+// DESCRIPTION:
+//    This function presses a key on the simulated PIO.
+//
+// INPUT:
+//   key - the key's bit in the edge capture register
+//   kind - the BENCH_EV_ kind of the event
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_Press(uint32 key, int kind)
+{
+  hostKeyRegs[BENCH_KEY_EDGE] = key;
+  bench_Interrupt(KEY1_KEY2_IRQ, 0, kind);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Events
+//
+// DESCRIPTION:
+//    This function plays games against Main.c through its ISRs: PLAY is
+//    typed at the menu, a few wrong guesses are entered with KEY2, then the
+//    timer interrupt runs until the guess times out and KEY1 goes back to
+//    the menu.  Every game not won by chance must be lost to the timer, and
+//    no event may be dropped.
+//    It reports the time from each interrupt to the game being idle again,
+//    and the CPU the game thread uses while idle at the menu.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Events(void)
+{
+  static const char* guesses[] = {"RRRR", "GGGG", "BBBB"};
+  pthread_t thread;
+  clockid_t clock;
+  struct timespec cpu_start;
+  struct timespec cpu_end;
+  struct timespec pause = {0, BENCH_EVENT_IDLE_MSEC * 1000000L};
+  double idle_cpu;
+  int ok = TRUE;
+  int game;
+  int g;
+  int k;
+
+  benchWins = 0;
+  benchLosses = 0;
+  memset(benchNumLatency, 0, sizeof(benchNumLatency));
+  if (0 != pthread_create(&thread, NULL, bench_GameThread, NULL))
+  {
+    printf("events         FAILED  no game thread\n");
+    return 1;
+  }
+
+  bench_WaitIdle(0);
+
+  for (game = 0; game < BENCH_EVENT_GAMES; game++)
+  {
+    bench_Type("PLAY", TRUE);
+    for (g = 0; (g < BENCH_EVENT_GUESSES) &&
+                (benchGameState == eWAITING_4_USER); g++)
+    {
+      bench_Type(guesses[g], FALSE);
+      bench_Press(0x2, BENCH_EV_KEY2);
+    }
+    while (benchGameState == eWAITING_4_USER)
+    {
+      bench_Interrupt(TIMER_0_IRQ, 0, BENCH_EV_TICK);
+    }
+    bench_Press(0x1, BENCH_EV_KEY1);
+  }
+  ok &= (benchGameState == eGAME_IDLE);
+
+  // the game waits at the menu; it should use no CPU
+  pthread_getcpuclockid(thread, &clock);
+  clock_gettime(clock, &cpu_start);
+  nanosleep(&pause, NULL);
+  clock_gettime(clock, &cpu_end);
+  idle_cpu = (cpu_end.tv_sec - cpu_start.tv_sec) * 1e3 +
+             (cpu_end.tv_nsec - cpu_start.tv_nsec) * 1e-6;
+
+  // the game ends on EXIT rather than going idle, so RETURN is not timed
+  bench_Type("EXIT", FALSE);
+  jtaguart_Receive('\n');
+  pthread_join(thread, NULL);
+
+  // a guess may win by chance; every other game must time out
+  ok &= (benchWins + benchLosses == BENCH_EVENT_GAMES) &&
+        (benchNumLatency[BENCH_EV_TIMEOUT] == benchLosses) &&
+        (0 == event_Dropped());
+
+  printf("events         %s  %d games, %ld idles, %u dropped\n",
+         ok ? "ok      " : "FAILED  ", BENCH_EVENT_GAMES, benchIdles,
+         event_Dropped());
+  printf("idle cpu       %.3f ms over %d ms (%.2f%%)\n", idle_cpu,
+         BENCH_EVENT_IDLE_MSEC, idle_cpu * 100.0 / BENCH_EVENT_IDLE_MSEC);
+  for (k = 0; k < BENCH_EV_KINDS; k++)
+  {
+    int n = benchNumLatency[k];
+    if (n == 0)
+    {
+      continue;
+    }
+    qsort(benchLatency[k], n, sizeof(uint32), bench_CompareLatency);
+    printf("event/%-8s %6d events  p50 %7u ns  p99 %7u ns  max %7u ns\n",
+           benchEventNames[k], n, benchLatency[k][n / 2],
+           benchLatency[k][n * 99 / 100], benchLatency[k][n - 1]);
+  }
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Step To Wait
+//
+// DESCRIPTION:
+//    This function steps a game_Step session with an event and then on
+//    through the states that do not wait, collecting all the output, as
+//    one resume of a coroutine session does.
+//
+// INPUT:
+//   event - the event
+//
+// OUTPUT:
+//   session - the session
+//   items - the output items
+//   count - the number of items
+//
+// RETURN:
+//   FALSE once the player has left the game, else TRUE
+//----------------------------------------------------------------------------
+static int bench_StepToWait(GameSession* session, const GameEvent* event,
+                            GameOutputItem* items, int* count)
+{
+  GameEvent none;
+  GameOutput output;
+  int running = game_Step(session, event, &output);
+  int i;
+
+  none.type = GAME_EVENT_NONE;
+  *count = 0;
+  for (;;)
+  {
+    for (i = 0; (i < output.count) && (*count < BENCH_CORO_ITEMS); i++)
+    {
+      items[(*count)++] = output.items[i];
+    }
+    if (!running || game_IsWaiting(session->state))
+    {
+      return running;
+    }
+    running = game_Step(session, &none, &output);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Coro Event
+//
+// DESCRIPTION:
+//    This function picks an event for a session in the given state: the
+//    events it waits for, mostly, and some it does not.
+//
+// INPUT:
+//   state - the session's state
+//   n - picks the event
+//   random - TRUE to pick at random from rng, FALSE to play a plain game
+//   rng - the generator
+//
+// OUTPUT:
+//   event - the event
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_CoroEvent(uint8 state, long n, int random, RngState* rng,
+                            GameEvent* event)
+{
+  static const uint8 types[] =
+  {
+    GAME_EVENT_LINE, GAME_EVENT_LINE, GAME_EVENT_LINE, GAME_EVENT_KEY1,
+    GAME_EVENT_TIMEOUT, GAME_EVENT_TICK, GAME_EVENT_NONE
+  };
+  uint32 pick = random ? rng_Next(rng) : 0;
+
+  event->type = types[pick % sizeof(types)];
+  memcpy(event->line, benchLetters[n & (BENCH_MICRO_CODES - 1)],
+         SCORE_NUM_PEGS + 1);
+  if (state == eGAME_IDLE)
+  {
+    memcpy(event->line, "PLAY", 5);
+    if (random && ((pick >> 8) % 4 == 0))
+    {
+      memcpy(event->line, benchCommands[(pick >> 16) % BENCH_NUM_COMMANDS],
+             sizeof(benchCommands[0]));
+    }
+  }
+  else if (state == eWAITING_4_USER)
+  {
+    if (random && ((pick >> 8) % 8 == 0))
+    {
+      memcpy(event->line, "HINT", 5);
+    }
+    else if (!random && ((n & 7) == 7))
+    {
+      event->type = GAME_EVENT_TIMEOUT;
+    }
+  }
+  else if (!random)
+  {
+    event->type = GAME_EVENT_KEY1;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Coro Shown
+//
+// DESCRIPTION:
+//    This function is the coroutine scheduler's output callback for the
+//    benchmark.  It counts the output and queues the session's next event.
+//
+// INPUT:
+//   session - the session that ran
+//   output - its output
+//   running - FALSE if it finished
+//   context - the scheduler
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_CoroShown(CoSession* session, const GameOutput* output,
+                            int running, void* context)
+{
+  GameEvent event;
+
+  benchSink += output->count;
+  if (running)
+  {
+    bench_CoroEvent(session->game.state, benchSink, FALSE, NULL, &event);
+    cosession_Post((CoScheduler*)context, session, event.type, event.line);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Coro
+//
+// DESCRIPTION:
+//    This function checks the coroutine sessions against game_Step: from
+//    the same seed and random events, EXIT included, both must show the
+//    same output and be in the same state after every event.  Then it
+//    starts many sessions in frames from a frame pool and keeps them all
+//    playing through the scheduler, reporting the memory per session and
+//    the resumes per second.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Coro(void)
+{
+  GameOutputItem step_items[BENCH_CORO_ITEMS];
+  GameSession reference;
+  CoSession checked;
+  CoScheduler scheduler;
+  FramePool pool;
+  CoSession** sessions;
+  GameOutput output;
+  GameEvent event;
+  RngState rng;
+  BenchMark mark;
+  const BenchResult* result;
+  int step_count;
+  int step_running;
+  int co_running;
+  int ok = TRUE;
+  int i;
+  long resumes = 0;
+  long n;
+
+  rng_Seed(&rng, BENCH_RNG_SEED);
+  for (n = 0; n < BENCH_MICRO_CODES; n++)
+  {
+    engine_Unpack4x6(engine_Generate4x6(&rng), benchLetters[n]);
+  }
+
+  // the same games both ways; a finished game starts over
+  game_Init(&reference, BENCH_RNG_SEED, &output);
+  cosession_Init(&checked, BENCH_RNG_SEED, &output);
+  for (n = 0; (n < BENCH_CORO_CHECKS) && ok; n++)
+  {
+    bench_CoroEvent(reference.state, n, TRUE, &rng, &event);
+    step_running = bench_StepToWait(&reference, &event, step_items,
+                                    &step_count);
+    co_running = cosession_Resume(&checked, &event, &output);
+    ok = (step_running == co_running) &&
+         (reference.state == checked.game.state) &&
+         (step_count == output.count);
+    for (i = 0; ok && (i < step_count); i++)
+    {
+      // only the text up to the NULL is set
+      ok = (step_items[i].type == output.items[i].type) &&
+           (step_items[i].value == output.items[i].value) &&
+           (0 == strcmp((char*)step_items[i].text,
+                        (char*)output.items[i].text)) &&
+           (0 == strcmp((char*)step_items[i].hint,
+                        (char*)output.items[i].hint));
+    }
+    if (!co_running)
+    {
+      game_Init(&reference, (uint32)n, &output);
+      cosession_Init(&checked, (uint32)n, &output);
+    }
+  }
+
+  sessions = malloc(BENCH_CORO_SESSIONS * sizeof(CoSession*));
+  framepool_Init(&pool, sizeof(CoSession));
+  cosession_InitScheduler(&scheduler);
+  for (n = 0; n < BENCH_CORO_SESSIONS; n++)
+  {
+    sessions[n] = framepool_Alloc(&pool);
+    cosession_Init(sessions[n], (uint32)n, &output);
+    bench_CoroShown(sessions[n], &output, TRUE, &scheduler);
+  }
+  ok &= (pool.in_use == BENCH_CORO_SESSIONS) && (scheduler.ignored == 0);
+
+  bench_Start(&mark);
+  do
+  {
+    resumes += cosession_RunReady(&scheduler, bench_CoroShown, &scheduler);
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  result = bench_Record(&mark, "coro/resume", resumes, ok);
+
+  printf("coro           %s  %d sessions, %lu bytes a frame, "
+         "%.1f M sessions/GB\n", ok ? "ok      " : "FAILED  ",
+         BENCH_CORO_SESSIONS, pool.frame_size,
+         BENCH_GB * BENCH_CORO_SESSIONS / pool.mapped / 1e6);
+  printf("coro/resume    %.1f M resumes/s  %8.2f ns/op  %5.2f allocs/op\n",
+         1e3 / result->ns_per_op, result->ns_per_op, result->allocs_per_op);
+
+  for (n = 0; n < BENCH_CORO_SESSIONS; n++)
+  {
+    framepool_Free(&pool, sessions[n]);
+  }
+  ok &= (pool.in_use == 0);
+  framepool_Destroy(&pool);
+  free(sessions);
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Packed Run
+//
+// DESCRIPTION:
+//    This function steps a packed session with an event and then on
+//    through the states that do not wait for the player.
+//
+// INPUT:
+//   event - the event
+//   now - the time in msec
+//
+// OUTPUT:
+//   session - the session
+//
+// RETURN:
+//   the number of output items
+//----------------------------------------------------------------------------
+static int bench_PackedRun(PackedSession* session, const GameEvent* event,
+                           uint32 now)
+{
+  GameEvent none;
+  GameOutput output;
+  int count = 0;
+
+  none.type = GAME_EVENT_NONE;
+  packsess_Step(session, event, now, &output);
+  count += output.count;
+  while (!game_IsWaiting(packsess_State(session)))
+  {
+    packsess_Step(session, &none, now, &output);
+    count += output.count;
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Packed Expired
+//
+// DESCRIPTION:
+//    This function is the sweep callback of the packed benchmark; it times
+//    the session out.
+//
+// INPUT:
+//   session - the session that timed out
+//   context - the time in msec
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_PackedExpired(PackedSession* session, void* context)
+{
+  GameEvent event;
+
+  event.type = GAME_EVENT_TIMEOUT;
+  benchSink += bench_PackedRun(session, &event, *(uint32*)context);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Check Packed
+//
+// DESCRIPTION:
+//    This function plays a packed session: PLAY typed at the menu must
+//    start a game, HINT must be refused as the session has no history, a
+//    wrong guess entered with KEY2 must be answered with its hint and
+//    restart the timer, and a sweep must time the guess out only once its
+//    minute has passed.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the game went as it should, else FALSE
+//----------------------------------------------------------------------------
+static int bench_CheckPacked(void)
+{
+  PackedSession session;
+  GameSession game;
+  GameOutput output;
+  GameEvent event;
+  GameHint hint;
+  const char* typed = "play\n";
+  uint8 guess[SCORE_NUM_PEGS + 1] = "BGRO";
+  uint32 now = 0xFFFF0000;            // the deadline wraps round
+  int refused = FALSE;
+  int ok = TRUE;
+  int i;
+
+  packsess_Init(&session, BENCH_RNG_SEED, &output);
+  ok &= (output.count > 0) && (packsess_State(&session) == eGAME_IDLE);
+  for (i = 0; typed[i] != '\0'; i++)
+  {
+    if (packsess_Type(&session, (uint8)typed[i], &event))
+    {
+      bench_PackedRun(&session, &event, now);
+    }
+  }
+  ok &= (packsess_State(&session) == eWAITING_4_USER) &&
+        (session.state & PACKSESS_RUNNING);
+
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    packsess_Type(&session, (uint8)"hint"[i], &event);
+  }
+  ok &= packsess_Press(&session, KEY2, &event);
+  packsess_Step(&session, &event, now, &output);
+  for (i = 0; i < output.count; i++)
+  {
+    ok &= (output.items[i].type != GAME_OUT_HINT);
+    refused |= (output.items[i].type == GAME_OUT_NO_HISTORY);
+  }
+  ok &= refused;
+  bench_PackedRun(&session, &event, now);
+  ok &= (packsess_State(&session) == eWAITING_4_USER);
+
+  packsess_Load(&session, &game);
+  if (0 == memcmp(game.secret, guess, SCORE_NUM_PEGS))
+  {
+    memcpy(guess, "GBRO", 5);
+  }
+  hint = game_ScoreGuess(guess, game.secret);
+  now += 30000;
+  for (i = 0; i < SCORE_NUM_PEGS; i++)
+  {
+    packsess_Type(&session, guess[i], &event);
+  }
+  ok &= packsess_Press(&session, KEY2, &event);
+  packsess_Step(&session, &event, now, &output);
+  ok &= (output.items[1].type == GAME_OUT_WRONG_GUESS) &&
+        (0 == memcmp(output.items[1].hint, hint.text, SCORE_NUM_PEGS + 1));
+  bench_PackedRun(&session, &event, now);
+
+  now += TIME_OUT_PERIOD * 1000 - 1;
+  ok &= (0 == packsess_Sweep(&session, 1, now, bench_PackedExpired, &now));
+  now += 1;
+  ok &= (1 == packsess_Sweep(&session, 1, now, bench_PackedExpired, &now));
+  ok &= (packsess_State(&session) == eWAIT_4_KEY1) &&
+        !(session.state & PACKSESS_RUNNING);
+  return ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Packed
+//
+// DESCRIPTION:
+//    This function checks a packed session, then starts a million of them
+//    in one array, their games starting over a minute.  It times a step,
+//    a sweep that finds no timeouts, and a sweep a minute later that times
+//    every game out.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Packed(void)
+{
+  PackedSession* sessions;
+  const BenchResult* step;
+  const BenchResult* sweep;
+  const BenchResult* timeout;
+  GameOutput output;
+  GameEvent event;
+  BenchMark mark;
+  uint32 now;
+  long found = 0;
+  long sweeps = 0;
+  long expired;
+  int ok = bench_CheckPacked();
+  long n;
+
+  sessions = malloc(BENCH_PACKED_SESSIONS * sizeof(PackedSession));
+  for (n = 0; n < BENCH_PACKED_SESSIONS; n++)
+  {
+    packsess_Init(&sessions[n], (uint32)n, &output);
+  }
+
+  event.type = GAME_EVENT_LINE;
+  memcpy(event.line, "PLAY", 5);
+  bench_Start(&mark);
+  for (n = 0; n < BENCH_PACKED_SESSIONS; n++)
+  {
+    now = (uint32)(n % BENCH_PACKED_SPREAD);
+    bench_PackedRun(&sessions[n], &event, now);
+  }
+  step = bench_Record(&mark, "packed/play", BENCH_PACKED_SESSIONS, ok);
+
+  // the first games time out a minute after the last one started
+  now = BENCH_PACKED_SPREAD - 1;
+  bench_Start(&mark);
+  do
+  {
+    found += packsess_Sweep(sessions, BENCH_PACKED_SESSIONS, now,
+                            bench_PackedExpired, &now);
+    sweeps++;
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  sweep = bench_Record(&mark, "packed/sweep", sweeps * BENCH_PACKED_SESSIONS,
+                       ok);
+  ok &= (found == 0);
+
+  now += TIME_OUT_PERIOD * 1000;
+  bench_Start(&mark);
+  expired = packsess_Sweep(sessions, BENCH_PACKED_SESSIONS, now,
+                           bench_PackedExpired, &now);
+  timeout = bench_Record(&mark, "packed/timeout", BENCH_PACKED_SESSIONS, ok);
+  ok &= (expired == BENCH_PACKED_SESSIONS);
+  for (n = 0; n < BENCH_PACKED_SESSIONS; n++)
+  {
+    ok &= (packsess_State(&sessions[n]) == eWAIT_4_KEY1);
+  }
+
+  printf("packed         %s  %d sessions in %.1f MB, %d bytes each\n",
+         ok ? "ok      " : "FAILED  ", BENCH_PACKED_SESSIONS,
+         BENCH_PACKED_SESSIONS * sizeof(PackedSession) / BENCH_MB,
+         (int)sizeof(PackedSession));
+  printf("packed/play    %8.2f ns/session\n", step->ns_per_op);
+  printf("packed/sweep   %8.2f ns/session  %.2f ms a sweep\n",
+         sweep->ns_per_op, sweep->ns_per_op * BENCH_PACKED_SESSIONS / 1e6);
+  printf("packed/timeout %8.2f ns/session  %ld timed out\n",
+         timeout->ns_per_op, expired);
+  free(sessions);
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Uart Flush
+//
+// DESCRIPTION:
+//    This function reads everything the game has sent from the JTAG UART
+//    model, letting the write interrupt refill the FIFO from the transmit
+//    ring until both are empty.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_UartFlush(void)
+{
+  while (jtaguart_Drain(JTAGUART_MAX_DEPTH) > 0)
+  {
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Uart Sent
+//
+// DESCRIPTION:
+//    This function tells whether the model sent exactly the given bytes
+//    since it was attached, with none lost to a full FIFO.
+//
+// INPUT:
+//   data - the bytes expected
+//   length - the number of bytes
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if they match
+//----------------------------------------------------------------------------
+static int bench_UartSent(const uint8* data, uint32 length)
+{
+  return (hostJtagUart.sent == length) && (hostJtagUart.overruns == 0) &&
+         (0 == memcmp(hostJtagUart.out, data, length));
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Uart Writes
+//
+// DESCRIPTION:
+//    This function sends the test bytes a number of times through a model
+//    that the host reads as fast as they come, one uart_Write per byte or
+//    one for all of them, and times it.
+//
+// INPUT:
+//   data - the bytes
+//   bytewise - TRUE to write them one at a time
+//   name - the name of the result
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the result; the model's counters cover these writes
+//----------------------------------------------------------------------------
+static const BenchResult* bench_UartWrites(const uint8* data, int bytewise,
+                                           const char* name)
+{
+  BenchMark mark;
+  int ok;
+  int w;
+  int n;
+
+  jtaguart_Attach(JTAGUART_DEPTH, FALSE);
+  uart_EnableInterrupt();
+  hostJtagUart.control_reads = 0;
+  bench_Start(&mark);
+  for (w = 0; w < BENCH_UART_WRITES; w++)
+  {
+    if (!bytewise)
+    {
+      uart_Write(data, BENCH_UART_BYTES);
+      continue;
+    }
+    for (n = 0; n < BENCH_UART_BYTES; n++)
+    {
+      uart_Write(&data[n], 1);
+    }
+  }
+  ok = (hostJtagUart.overruns == 0) &&
+       (hostJtagUart.sent == (unsigned long long)BENCH_UART_WRITES *
+                             BENCH_UART_BYTES) &&
+       (0 == memcmp(hostJtagUart.out, data, BENCH_UART_BYTES));
+  return bench_Record(&mark, name, (long)BENCH_UART_WRITES * BENCH_UART_BYTES,
+                      ok);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Uart Send Queue
+//
+// DESCRIPTION:
+//    This function is the sink of the benchmark's output queue, as in
+//    Main.c.
+//
+// INPUT:
+//   descs - the descriptors
+//   count - the number of descriptors
+//   context - not used
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_UartSendQueue(const OutDesc* descs, uint32 count,
+                                void* context)
+{
+  (void)context;
+  uart_WriteVector(descs, count);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Uart Responses
+//
+// DESCRIPTION:
+//    This function sends the response to a wrong guess a number of times
+//    through a model that the host reads as fast as it comes, a
+//    uart_Write per message as display_DisplayOutput does alone, or one
+//    uart_WriteVector for the whole step as Main.c does, and times it.
+//
+// INPUT:
+//   queued - TRUE to queue the messages
+//   name - the name of the result
+//
+// OUTPUT:
+//   expected - the response, NULL terminated, when queued is FALSE
+//
+// RETURN:
+//   the result; the model's counters cover these responses
+//----------------------------------------------------------------------------
+static const BenchResult* bench_UartResponses(int queued, const char* name,
+                                              char* expected)
+{
+  static OutQueue queue;
+  GameOutput output;
+  GameOutputItem* item;
+  BenchMark mark;
+  int ok = TRUE;
+  int w;
+  int i;
+
+  output.count = 0;
+  game_Emit(&output, GAME_OUT_TIMER_STOP, 0, NULL);
+  item = game_Emit(&output, GAME_OUT_WRONG_GUESS, 0, (const uint8*)"RGBY");
+  memcpy(item->hint, "PC--", NUM_OF_COLORS_INCODE + 1);
+  game_Emit(&output, GAME_OUT_CLEAR_KEY, KEY1, NULL);
+  game_Emit(&output, GAME_OUT_TIMER_START, SECOND, NULL);
+  game_Emit(&output, GAME_OUT_ENTER_GUESS, 0, NULL);
+
+  jtaguart_Attach(JTAGUART_DEPTH, FALSE);
+  uart_EnableInterrupt();
+  outq_Init(&queue, bench_UartSendQueue, NULL);
+  bench_Start(&mark);
+  for (w = 0; w < BENCH_UART_RESPONSES; w++)
+  {
+    for (i = 0; i < output.count; i++)
+    {
+      if (queued)
+      {
+        display_QueueOutput(&queue, &benchSession, &output.items[i]);
+      }
+      else
+      {
+        display_DisplayOutput(&benchSession, &output.items[i]);
+      }
+    }
+    outq_Drain(&queue);
+    if (w == 0)
+    {
+      if (!queued)
+      {
+        strcpy(expected, hostJtagUart.out);
+      }
+      ok = (0 == strcmp(hostJtagUart.out, expected));
+    }
+  }
+  ok &= (hostJtagUart.overruns == 0) &&
+        (hostJtagUart.sent == (unsigned long long)BENCH_UART_RESPONSES *
+                              strlen(expected));
+  return bench_Record(&mark, name, BENCH_UART_RESPONSES, ok);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Drain Thread
+//
+// DESCRIPTION:
+//    This function is a slow host reading the JTAG UART: a few bytes at a
+//    time with a pause between, until told to stop.
+//
+// INPUT:
+//   arg - the flag that stops it
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   NULL
+//----------------------------------------------------------------------------
+static void* bench_DrainThread(void* arg)
+{
+  volatile int* running = (volatile int*)arg;
+  struct timespec pause = {0, BENCH_UART_DRAIN_NSEC};
+
+  while (*running)
+  {
+    jtaguart_Drain(BENCH_UART_DRAIN);
+    nanosleep(&pause, NULL);
+  }
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Uart
+//
+// DESCRIPTION:
+//    This function first counts the bytes the driver writes per read of
+//    the control register, writing a byte at a time and in one burst.
+//    It then checks the interrupt driven transmit path against the
+//    JTAG UART model holding what is written until it is read.  PARTIAL
+//    must keep as many bytes as fit in the ring and the FIFO, DROP must
+//    keep a write whole or not at all, and BLOCK must get every byte out
+//    through a slow host; each must send exactly what it kept, in order.
+//    It then times the help message through the slow host: uart_Write
+//    returns once the message is in the ring, where waiting on WSPACE
+//    would take as long as the host takes to read it.  Last it sends the
+//    response to a wrong guess a message at a time and queued, which must
+//    send the same text with fewer control register reads.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Uart(void)
+{
+  static uint8 data[BENCH_UART_BYTES];
+  static volatile int running;
+  static char expected[JTAGUART_OUT_MAX + 1];
+  const BenchResult* bytewise;
+  const BenchResult* burst;
+  const BenchResult* messages;
+  const BenchResult* queued;
+  double bytewise_reads;
+  double burst_reads;
+  double messages_reads;
+  double queued_reads;
+  pthread_t thread;
+  uint32 dropped;
+  uint32 written;
+  uint32 first = UART_TX_RING_SIZE - 8;
+  int partial_ok;
+  int drop_ok;
+  int block_ok;
+  int stats_ok = TRUE;
+#if(UART_STATS_ENABLE)
+  UartStats before;
+  UartStats after;
+#endif
+  double start;
+  double returned;
+  double sent;
+  unsigned long long length;
+  int n;
+
+  for (n = 0; n < BENCH_UART_BYTES; n++)
+  {
+    data[n] = (uint8)('A' + n % 26);
+  }
+  uart_ConfigInterrupt();
+
+  bytewise = bench_UartWrites(data, TRUE, "uart/bytewise");
+  bytewise_reads = (double)hostJtagUart.control_reads;
+  burst = bench_UartWrites(data, FALSE, "uart/burst");
+  burst_reads = (double)hostJtagUart.control_reads;
+
+  jtaguart_Attach(JTAGUART_DEPTH, TRUE);
+  uart_EnableInterrupt();
+  uart_SetTxPolicy(UART_TX_PARTIAL);
+  dropped = uart_TxDropped();
+  written = uart_Write(data, BENCH_UART_BYTES);
+  partial_ok = (written == UART_TX_RING_SIZE + JTAGUART_DEPTH) &&
+               (uart_TxDropped() - dropped == BENCH_UART_BYTES - written);
+  bench_UartFlush();
+  partial_ok &= bench_UartSent(data, written);
+
+  // the second write finds 72 bytes of room and is dropped whole
+  jtaguart_Attach(JTAGUART_DEPTH, TRUE);
+  uart_EnableInterrupt();
+  uart_SetTxPolicy(UART_TX_DROP);
+  dropped = uart_TxDropped();
+  drop_ok = (uart_Write(data, first) == first) &&
+            (uart_Write(data + first, JTAGUART_DEPTH + 16) == 0) &&
+            (uart_Write(data + first, 8) == 8) &&
+            (uart_TxDropped() - dropped == JTAGUART_DEPTH + 16);
+  bench_UartFlush();
+  drop_ok &= bench_UartSent(data, first + 8);
+
+  jtaguart_Attach(JTAGUART_DEPTH, TRUE);
+  uart_EnableInterrupt();
+  uart_SetTxPolicy(UART_TX_BLOCK);
+#if(UART_STATS_ENABLE)
+  uart_GetStats(&before);
+#endif
+  running = TRUE;
+  pthread_create(&thread, NULL, bench_DrainThread, (void*)&running);
+  dropped = uart_TxDropped();
+  block_ok = (uart_Write(data, BENCH_UART_BYTES) == BENCH_UART_BYTES) &&
+             (uart_TxDropped() == dropped);
+  running = FALSE;
+  pthread_join(thread, NULL);
+  bench_UartFlush();
+  block_ok &= bench_UartSent(data, BENCH_UART_BYTES);
+#if(UART_STATS_ENABLE)
+  // the counters must agree with what the model saw
+  uart_GetStats(&after);
+  stats_ok = (after.tx_bytes - before.tx_bytes == hostJtagUart.sent) &&
+             (after.isr_calls - before.isr_calls == hostJtagUart.raises) &&
+             (after.tx_waits - before.tx_waits == 1) &&
+             (after.tx_spins > before.tx_spins) &&
+             (after.tx_dropped == before.tx_dropped);
+#endif
+
+  // the help message through the slow host
+  jtaguart_Attach(JTAGUART_DEPTH, TRUE);
+  uart_EnableInterrupt();
+  running = TRUE;
+  pthread_create(&thread, NULL, bench_DrainThread, (void*)&running);
+  start = bench_Now();
+  display_DisplayHelpMsg();
+  returned = bench_Now() - start;
+  while ((uart_TxPending() > 0) || (hostJtagUart.tx_count > 0))
+  {
+    sched_yield();
+  }
+  sent = bench_Now() - start;
+  length = hostJtagUart.sent;
+  running = FALSE;
+  pthread_join(thread, NULL);
+
+  messages = bench_UartResponses(FALSE, "uart/messages", expected);
+  messages_reads = (double)hostJtagUart.control_reads;
+  queued = bench_UartResponses(TRUE, "uart/queued", expected);
+  queued_reads = (double)hostJtagUart.control_reads;
+
+  jtaguart_Attach(JTAGUART_DEPTH, FALSE);
+  uart_EnableInterrupt();
+  uart_SetTxPolicy(UART_TX_POLICY);
+
+  printf("uart/bytewise  %s  %6.2f bytes per control read  %6.2f ns/byte\n",
+         bytewise->ok ? "ok      " : "FAILED  ",
+         (double)BENCH_UART_WRITES * BENCH_UART_BYTES / bytewise_reads,
+         bytewise->ns_per_op);
+  printf("uart/burst     %s  %6.2f bytes per control read  %6.2f ns/byte\n",
+         burst->ok ? "ok      " : "FAILED  ",
+         (double)BENCH_UART_WRITES * BENCH_UART_BYTES / burst_reads,
+         burst->ns_per_op);
+  printf("uart/partial   %s  %u of %d bytes written\n",
+         partial_ok ? "ok      " : "FAILED  ",
+         UART_TX_RING_SIZE + JTAGUART_DEPTH, BENCH_UART_BYTES);
+  printf("uart/drop      %s  %d byte write dropped whole\n",
+         drop_ok ? "ok      " : "FAILED  ", JTAGUART_DEPTH + 16);
+  printf("uart/block     %s  %d bytes through a slow host\n",
+         block_ok ? "ok      " : "FAILED  ", BENCH_UART_BYTES);
+#if(UART_STATS_ENABLE)
+  printf("uart/stats     %s  %lu tries to write, ISR %.0f cycles a call, "
+         "at most %lu\n", stats_ok ? "ok      " : "FAILED  ",
+         (unsigned long)(after.tx_spins - before.tx_spins),
+         (double)(after.isr_cycles - before.isr_cycles) /
+         (after.isr_calls - before.isr_calls), (unsigned long)after.isr_max);
+#endif
+  printf("uart/help      returned in %8.1f us, sent in %8.1f us, %llu bytes\n",
+         returned * 1e6, sent * 1e6, length);
+  printf("uart/messages  %s  %6.2f control reads a response  %8.1f ns\n",
+         messages->ok ? "ok      " : "FAILED  ",
+         messages_reads / BENCH_UART_RESPONSES, messages->ns_per_op);
+  printf("uart/queued    %s  %6.2f control reads a response  %8.1f ns\n",
+         queued->ok ? "ok      " : "FAILED  ",
+         queued_reads / BENCH_UART_RESPONSES, queued->ns_per_op);
+  return !(bytewise->ok && burst->ok && partial_ok && drop_ok && block_ok &&
+           stats_ok && messages->ok && queued->ok &&
+           (queued_reads < messages_reads));
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Link
+//
+// DESCRIPTION:
+//    This function writes BENCH_LINK_BYTES at once through the unchanged
+//    driver to the JTAG UART model read at a few rates and FIFO depths.
+//    It reports when uart_Write returned, which is when what did not fit
+//    in the ring and the FIFO had left, when the last byte left, against
+//    what the rate alone allows, how long a byte waited in the FIFO and
+//    how long the FIFO was full.  Every byte must arrive in order and the
+//    link must be within a quarter of its rate.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Link(void)
+{
+  static const uint32 links[][2] =
+  {
+    // FIFO depth, bytes a second
+    {JTAGUART_DEPTH, 16384},
+    {JTAGUART_DEPTH, 65536},
+    {8, 65536},
+    {JTAGUART_DEPTH, 1048576},
+  };
+  static uint8 data[BENCH_LINK_BYTES];
+  struct timespec pause = {0, BENCH_LINK_POLL_NSEC};
+  char name[32];
+  double start;
+  double returned;
+  double sent;
+  double expected;
+  int failed = 0;
+  int ok;
+  int l;
+  int n;
+
+  for (n = 0; n < BENCH_LINK_BYTES; n++)
+  {
+    data[n] = (uint8)('a' + n % 26);
+  }
+  uart_ConfigInterrupt();
+  uart_SetTxPolicy(UART_TX_BLOCK);
+
+  for (l = 0; l < (int)(sizeof(links) / sizeof(links[0])); l++)
+  {
+    jtaguart_Attach(links[l][0], FALSE);
+    jtaguart_SetRate(links[l][1]);
+    uart_EnableInterrupt();
+
+    start = bench_Now();
+    ok = (uart_Write(data, BENCH_LINK_BYTES) == BENCH_LINK_BYTES);
+    returned = bench_Now() - start;
+    while ((hostJtagUart.sent < BENCH_LINK_BYTES) &&
+           (bench_Now() - start < BENCH_LINK_SECONDS))
+    {
+      nanosleep(&pause, NULL);
+    }
+    sent = bench_Now() - start;
+    jtaguart_SetRate(0);
+
+    expected = (double)BENCH_LINK_BYTES / links[l][1];
+    ok &= bench_UartSent(data, BENCH_LINK_BYTES) &&
+          (sent > 0.9 * expected) && (sent < 1.25 * expected + 0.002);
+    failed += !ok;
+
+    sprintf(name, "link/%lu@%luk", (unsigned long)links[l][0],
+            (unsigned long)(links[l][1] / 1024));
+    printf("%-14s %s  returned %7.2f ms, sent %7.2f ms of %7.2f, "
+           "%6.3f ms a byte in the FIFO, %7.2f ms full\n", name,
+           ok ? "ok      " : "FAILED  ", returned * 1e3, sent * 1e3,
+           expected * 1e3,
+           (double)hostJtagUart.wait_nsec / hostJtagUart.sent / 1e6,
+           (double)hostJtagUart.full_nsec / 1e6);
+  }
+
+  jtaguart_Attach(JTAGUART_DEPTH, FALSE);
+  uart_EnableInterrupt();
+  uart_SetTxPolicy(UART_TX_POLICY);
+  return failed != 0;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Rx Line
+//
+// DESCRIPTION:
+//    This function makes the letters of a numbered test line, upper case
+//    for odd lines and lower case for even ones.
+//
+// INPUT:
+//   n - the line number
+//   upper - TRUE for upper case whatever the number
+//
+// OUTPUT:
+//   line - the four letters, NULL terminated
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_RxLine(long n, int upper, uint8* line)
+{
+  uint8 base = (upper || (n & 1)) ? 'A' : 'a';
+  int i;
+
+  for (i = 0; i < UART_LINE_MAX; i++)
+  {
+    line[i] = (uint8)(base + n % 26);
+    n /= 26;
+  }
+  line[UART_LINE_MAX] = '\0';
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Rx Producer
+//
+// DESCRIPTION:
+//    This function is the JTAG host typing the test lines, each ended by
+//    RETURN, as fast as the read FIFO takes them.  The UART ISR runs on
+//    this thread each time a character goes in.
+//
+// INPUT:
+//   arg - where to count the characters the full FIFO refused
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   NULL
+//----------------------------------------------------------------------------
+static void* bench_RxProducer(void* arg)
+{
+  long* refused = (long*)arg;
+  uint8 line[UART_LINE_MAX + 2];
+  long n;
+  int i;
+
+  for (n = 0; n < BENCH_RX_LINES; n++)
+  {
+    bench_RxLine(n, FALSE, line);
+    line[UART_LINE_MAX] = '\n';
+    for (i = 0; i <= UART_LINE_MAX; i++)
+    {
+      while (!jtaguart_Receive(line[i]))
+      {
+        (*refused)++;
+        sched_yield();
+      }
+    }
+  }
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Rx
+//
+// DESCRIPTION:
+//    This function stresses the receive ring: a producer thread types
+//    lines into the JTAG UART model while this thread takes them with
+//    uart_GetLine as the main loop does, calling it again only when an
+//    EVENT_RX comes.  Every line must come out whole and in order, none
+//    may be lost, and a lost EVENT_RX shows up as the test running out of
+//    time.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_Rx(void)
+{
+  uint8 expected[UART_LINE_MAX + 1];
+  uint8 line[UART_LINE_MAX + 1];
+  EventItem item;
+  pthread_t thread;
+  uint32 dropped;
+  long refused = 0;
+  long lines = 0;
+  long torn = 0;
+  long events = 0;
+  double start;
+  double seconds;
+  int ok;
+
+  jtaguart_Attach(JTAGUART_DEPTH, FALSE);
+  uart_ConfigInterrupt();
+  uart_EnableInterrupt();
+  while (event_Get(&item))
+  {
+  }
+  dropped = event_Dropped();
+
+  start = bench_Now();
+  pthread_create(&thread, NULL, bench_RxProducer, &refused);
+  while ((lines < BENCH_RX_LINES) &&
+         (bench_Now() - start < BENCH_RX_SECONDS))
+  {
+    if (uart_GetLine(line))
+    {
+      bench_RxLine(lines, TRUE, expected);
+      torn += (0 != memcmp(line, expected, UART_LINE_MAX + 1));
+      lines++;
+      continue;
+    }
+    while (!event_Get(&item) && (bench_Now() - start < BENCH_RX_SECONDS))
+    {
+      sched_yield();
+    }
+    events++;
+  }
+  seconds = bench_Now() - start;
+  if (lines < BENCH_RX_LINES)
+  {
+    // let the producer finish so it can be joined
+    while (uart_GetLine(line) || event_Get(&item))
+    {
+    }
+  }
+  pthread_join(thread, NULL);
+  uart_ClearUserInput();
+
+  ok = (lines == BENCH_RX_LINES) && (torn == 0) &&
+       (event_Dropped() == dropped);
+  printf("rx             %s  %ld lines, %ld torn, %ld events, %u dropped\n",
+         ok ? "ok      " : "FAILED  ", lines, torn, events,
+         event_Dropped() - dropped);
+  printf("rx/throughput  %8.2f M chars/s  %ld refused by a full FIFO\n",
+         lines * (UART_LINE_MAX + 1) / seconds / 1e6, refused);
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Term Echo
+//
+// DESCRIPTION:
+//    This function is a terminal one line wide for the line discipline's
+//    echo: a backspace moves the cursor left, a character is written at
+//    the cursor and moves it right, and a new line keeps what the row
+//    shows and starts an empty one.
+//
+// INPUT:
+//   data - the echo
+//   length - its length
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_TermEcho(const uint8* data, uint32 length)
+{
+  uint32 i;
+  int end;
+
+  for (i = 0; i < length; i++)
+  {
+    if (data[i] == '\b')
+    {
+      benchTermCursor -= (benchTermCursor > 0);
+    }
+    else if (data[i] == '\n')
+    {
+      for (end = BENCH_TERM_WIDTH; (end > 0) && (benchTermRow[end - 1] == ' ');
+           end--)
+      {
+      }
+      memcpy(benchTermLine, benchTermRow, end);
+      benchTermLine[end] = '\0';
+      memset(benchTermRow, ' ', BENCH_TERM_WIDTH);
+      benchTermCursor = 0;
+    }
+    else if (benchTermCursor < BENCH_TERM_WIDTH)
+    {
+      benchTermRow[benchTermCursor++] = (char)data[i];
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Line Disc Sink
+//
+// DESCRIPTION:
+//    This function takes the echo while the line discipline is timed.
+//
+// INPUT:
+//   data - the echo
+//   length - its length
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_LineDiscSink(const uint8* data, uint32 length)
+{
+  benchSink += data[0] + length;
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Line Disc Feed
+//
+// DESCRIPTION:
+//    This function feeds characters of an editing session, arrows and
+//    history included, to the line discipline.
+//
+// INPUT:
+//   iterations - the number of characters
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void bench_LineDiscFeed(long iterations)
+{
+  static const char typed[] = "seed 12\x1b[D\x1b[D\x1b[3~\x1b[F4\r\n"
+                              "solvx\x7f" "e\n\x1b[A\x1b[A\x15stats\n";
+  static long next = 0;
+  long n;
+
+  for (n = 0; n < iterations; n++)
+  {
+    benchSink += linedisc_Feed(&benchLineDisc, (uint8)typed[next]);
+    next = (next + 1) % (long)(sizeof(typed) - 1);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Line Disc
+//
+// DESCRIPTION:
+//    This function types editing sessions into the line discipline and
+//    checks both the line that comes out and what the echo leaves on a
+//    terminal, then times it per character.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_LineDisc(void)
+{
+  // one LineDisc takes them all in order, so the last ones find the
+  // history the first ones left
+  static const char* cases[][2] =
+  {
+    {"solve\r\n", "SOLVE"},
+    {"plaz\x7fy\n", "PLAY"},
+    {"abc\x1b[D\x1b[Dx\n", "AXBC"},
+    {"junk\x15help\n", "HELP"},
+    {"seed 12\x1b[D\x1b[D\x1b[3~\x1b[F4\n", "SEED 24"},
+    {"tats\x1b[Hs\x1bOF\n", "STATS"},
+    {"\x1b[5~pl\x1b[1~\x01\x05\x1b[4~ay\n", "PLAY"},
+    {"abcdefghijklmnopqrstuvwxyz\n", "ABCDEFGHIJKLMNOP"},
+    {"one\n", "ONE"},
+    {"two\n", "TWO"},
+    {"\x1b[A\x1b[A\n", "ONE"},
+    {"\x1b[A\x1b[A\x1b[B\x1b[Bx\n", "X"},
+    {"\x1bOA\x1bOAs\n", "ONES"},
+    {"x\b\b\b\n", ""},
+  };
+  LineDisc ld;
+  int failed = 0;
+  int ended;
+  int c;
+  int i;
+
+  memset(benchTermRow, ' ', BENCH_TERM_WIDTH);
+  benchTermCursor = 0;
+  linedisc_Init(&ld, UART_LINE_MAX, LINEDISC_UPPER | LINEDISC_ECHO,
+                bench_TermEcho);
+  for (c = 0; c < (int)(sizeof(cases) / sizeof(cases[0])); c++)
+  {
+    ended = 0;
+    for (i = 0; cases[c][0][i] != '\0'; i++)
+    {
+      ended += linedisc_Feed(&ld, (uint8)cases[c][0][i]);
+    }
+    if ((ended != 1) || (0 != strcmp((char*)ld.line, cases[c][1])) ||
+        (0 != strcmp(benchTermLine, cases[c][1])))
+    {
+      printf("  case %d: line \"%s\", terminal \"%s\", expected \"%s\"\n", c,
+             (char*)ld.line, benchTermLine, cases[c][1]);
+      failed++;
+    }
+  }
+
+  linedisc_Init(&benchLineDisc, UART_LINE_MAX, LINEDISC_UPPER | LINEDISC_ECHO,
+                bench_LineDiscSink);
+  return bench_Measure("linedisc/feed", bench_LineDiscFeed, failed == 0);
+}
+
+//----------------------------------------------------------------------------
+// NAME: BENCH Msg Cat
+//
+// DESCRIPTION:
+//    This function expands every message of the catalog in pieces of a few
+//    sizes and checks it against msgtext.h, which also catches a
+//    msgcat_tab.h that mkmsgcat was not run again for.  It then times the
+//    expansion per character in the pieces display.c uses and reports the
+//    bytes the catalog saves.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, 1 if a check failed
+//----------------------------------------------------------------------------
+static int bench_MsgCat(void)
+{
+  static const uint32 pieces[] = {1, 7, BENCH_MSGCAT_PIECE};
+  static uint8 text[BENCH_MSGCAT_PIECE * 16];
+  static uint8 piece[BENCH_MSGCAT_PIECE];
+  const BenchResult* result;
+  BenchMark mark;
+  MsgCursor cursor;
+  long characters = 0;
+  uint32 length;
+  uint32 n;
+  int ok = TRUE;
+  int p;
+  int m;
+
+  for (p = 0; p < (int)(sizeof(pieces) / sizeof(pieces[0])); p++)
+  {
+    for (m = 0; m < MSGCAT_NUM_MESSAGES; m++)
+    {
+      msgcat_Open(&cursor, m);
+      length = 0;
+      while ((length + pieces[p] <= sizeof(text)) &&
+             ((n = msgcat_Read(&cursor, &text[length], pieces[p])) > 0))
+      {
+        length += n;
+      }
+      if ((length != strlen(benchMessages[m])) ||
+          (length != msgcat_Length(m)) ||
+          (0 != memcmp(text, benchMessages[m], length)))
+      {
+        printf("  message %d in pieces of %lu does not match\n", m,
+               (unsigned long)pieces[p]);
+        ok = FALSE;
+      }
+    }
+  }
+
+  bench_Start(&mark);
+  do
+  {
+    for (m = 0; m < MSGCAT_NUM_MESSAGES; m++)
+    {
+      msgcat_Open(&cursor, m);
+      while ((n = msgcat_Read(&cursor, piece, BENCH_MSGCAT_PIECE)) > 0)
+      {
+        benchSink += piece[n - 1];
+        characters += n;
+      }
+    }
+  } while (bench_Now() - mark.seconds < BENCH_MIN_SECONDS);
+  result = bench_Record(&mark, "msgcat/decode", characters, ok);
+
+  printf("msgcat         %s  %d messages, %lu bytes as literals, %lu coded, "
+         "%ld saved\n", ok ? "ok      " : "FAILED  ", MSGCAT_NUM_MESSAGES,
+         (unsigned long)msgcat_PlainBytes(),
+         (unsigned long)msgcat_PackedBytes(),
+         (long)msgcat_PlainBytes() - (long)msgcat_PackedBytes());
+  printf("msgcat/decode  %s  %8.2f ns/char  %8.1f cycles/char  %6.1f MB/s\n",
+         ok ? "ok      " : "FAILED  ", result->ns_per_op,
+         result->cycles_per_op, 1e3 / result->ns_per_op);
+  return !ok;
+}
+
+//----------------------------------------------------------------------------
+// NAME: Host State Hook
+//
+// DESCRIPTION:
+//    This function is called by the game's state machine.  It keeps the
+//    state and counts the games won and lost, for the events benchmark.
+//
+// INPUT:
+//   state - the current game state
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void host_StateHook(int state)
+{
+  if (state != benchGameState)
+  {
+    benchWins += (state == eWIN_GAME);
+    benchLosses += (state == eLOSE_GAME);
+  }
+  benchGameState = state;
+}
+
+//----------------------------------------------------------------------------
+// NAME: Host Event Idle
+//
+// DESCRIPTION:
+//    These functions are called by the event queue.  An idle game thread
+//    sleeps until an ISR posts an event, so it uses no CPU while it waits.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void host_EventIdle(void)
+{
+  pthread_mutex_lock(&benchEventLock);
+  benchIdles++;
+  pthread_cond_broadcast(&benchIdleCond);
+  while (!benchEventPosted)
+  {
+    pthread_cond_wait(&benchEventCond, &benchEventLock);
+  }
+  benchEventPosted = FALSE;
+  pthread_mutex_unlock(&benchEventLock);
+}
+
+void host_EventWake(void)
+{
+  pthread_mutex_lock(&benchEventLock);
+  benchEventPosted = TRUE;
+  benchWakes++;
+  pthread_cond_signal(&benchEventCond);
+  pthread_mutex_unlock(&benchEventLock);
+}
+
+
+//*****************************************************************************
+//                            benchmark table
+//*****************************************************************************
+static const BenchEntry benchEntries[] =
+{
+  {"batch", bench_Batch, TRUE},
+  {"solver", bench_Solver, TRUE},
+  {"pool", bench_Pool, TRUE},
+  {"engine", bench_Engine, TRUE},
+  {"rng", bench_Rng, TRUE},
+  {"micro", bench_Micro, TRUE},
+  {"events", bench_Events, TRUE},
+  {"uart", bench_Uart, TRUE},
+  {"link", bench_Link, TRUE},
+  {"rx", bench_Rx, TRUE},
+  {"linedisc", bench_LineDisc, TRUE},
+  {"msgcat", bench_MsgCat, TRUE},
+  {"coro", bench_Coro, TRUE},
+  {"packed", bench_Packed, TRUE},
+  {"cands", bench_Cands, TRUE},
+  {"advisor", bench_Advisor, TRUE},
+  {"book", bench_Book, TRUE},
+  {"matrix", bench_Matrix, TRUE},
+  {"matrix-large", bench_MatrixLarge, FALSE},
+};
+
+#define BENCH_NUM_ENTRIES  (int)(sizeof(benchEntries) / \
+                                 sizeof(benchEntries[0]))
+
+int main(int argc, char* argv[])
+{
+  const char* json_path = NULL;
+  int first = 1;
+  int failed = 0;
+  int e;
+  int a;
+
+  if ((argc > 2) && (0 == strcmp(argv[1], "-j")))
+  {
+    json_path = argv[2];
+    first = 3;
+  }
+
+  jtaguart_Attach(JTAGUART_DEPTH, FALSE);
+  score_Init();
+  bench_InitGuesses();
+  solver_Init();
+
+  for (e = 0; e < BENCH_NUM_ENTRIES; e++)
+  {
+    int selected = (argc <= first) && benchEntries[e].by_default;
+    for (a = first; a < argc; a++)
+    {
+      if (0 == strcmp(argv[a], benchEntries[e].name))
+      {
+        selected = TRUE;
+      }
+    }
+    if (selected)
+    {
+      failed |= benchEntries[e].run();
+    }
+  }
+  if (json_path != NULL)
+  {
+    failed |= bench_WriteJson(json_path);
+  }
+  return failed;
+} /* main */
@@ -0,0 +1,113 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: bookgen Functions
+//
+//    FILENAME: bookgen.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file builds the opening book.  The solver only plays
+//              the 4x6 game, so that is the one section written; the format
+//              holds any number of configurations.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <stdlib.h>                   // for calloc
+#include <string.h>                   // for memcpy
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for packed codes and feedback
+#include "solver.h"                   // for the solver's guesses
+#include "engine.h"                   // for the 4x6 configuration
+#include "book.h"                     // for the book layout
+#include "bookgen.h"                  // for bookgen definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: BOOKGEN Build
+//
+// DESCRIPTION:
+//    This function builds an opening book in memory.  The first guess is
+//    the solver's choice for every secret, and each second guess is its
+//    choice for the secrets that give that pattern to the first.  The
+//    solver must have been initialized, with no book set.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   size - the number of bytes in the book
+//
+// RETURN:
+//   the book, to be freed by the caller, or NULL if out of memory
+//----------------------------------------------------------------------------
+uint8* bookgen_Build(uint32* size)
+{
+  uint32 total = sizeof(BookHeader) + sizeof(BookSection) +
+                 SCORE_NUM_PATTERNS * sizeof(BookEntry);
+  uint8* book = calloc(1, total);
+  BookHeader* header = (BookHeader*)book;
+  BookSection* section = (BookSection*)(header + 1);
+  BookEntry* entries = (BookEntry*)(section + 1);
+  uint16 secrets[SCORE_NUM_SECRETS];
+  uint16 group[SCORE_NUM_SECRETS];
+  int pattern;
+  int n;
+
+  if (book == NULL)
+  {
+    return NULL;
+  }
+  for (n = 0; n < SCORE_NUM_SECRETS; n++)
+  {
+    secrets[n] = score_IndexToCode(n);
+  }
+
+  section->pegs = ENGINE_PEGS_4x6;
+  section->colors = ENGINE_COLORS_4x6;
+  section->repeats = ENGINE_REPEATS_4x6;
+  section->depth = BOOK_MAX_DEPTH;
+  section->num_codes = SCORE_NUM_SECRETS;
+  section->num_feedbacks = SCORE_NUM_PATTERNS;
+  section->first_guess = solver_NextGuess(secrets, SCORE_NUM_SECRETS);
+  section->entries = (uint32)((uint8*)entries - book);
+
+  for (pattern = 0; pattern < SCORE_NUM_PATTERNS; pattern++)
+  {
+    int count = 0;
+    for (n = 0; n < SCORE_NUM_SECRETS; n++)
+    {
+      if (score_PatternCodes((uint16)section->first_guess, secrets[n]) ==
+          pattern)
+      {
+        group[count++] = secrets[n];
+      }
+    }
+    entries[pattern].candidates = (uint32)count;
+    entries[pattern].guess = (count == 0) ? BOOK_NO_GUESS :
+                             solver_NextGuess(group, count);
+  }
+
+  memcpy(header->magic, BOOK_MAGIC, sizeof(BOOK_MAGIC));
+  header->version = BOOK_VERSION;
+  header->file_size = total;
+  header->num_sections = 1;
+  header->checksum = book_Checksum(book + sizeof(BookHeader),
+                                   total - sizeof(BookHeader));
+  *size = total;
+  return book;
+} /* bookgen_Build */
@@ -0,0 +1,28 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: bookgen Definitions
+//
+//    FILENAME: bookgen.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the opening book
+//              builder used by mkbook and by the host benchmarks.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef BOOKGEN_MOD_H_
+#define BOOKGEN_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+uint8* bookgen_Build(uint32* size);
+
+#endif /*BOOKGEN_MOD_H_*/
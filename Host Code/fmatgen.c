@@ -0,0 +1,148 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: fmatgen Functions
+//
+//    FILENAME: fmatgen.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file builds a feedback matrix file.  The larger
+//              matrices do not fit in memory, so the tiles are scored and
+//              written one row of tiles at a time.  The file is written
+//              under a temporary name and renamed once it is complete.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for fwrite
+#include <stdlib.h>                   // for malloc
+#include <string.h>                   // for memcpy
+#include <unistd.h>                   // for fsync
+#include "nios_std_types.h"           // for standard embedded types
+#include "fmat.h"                     // for the matrix layout
+#include "fmatgen.h"                  // for fmatgen definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: FMATGEN Write
+//
+// DESCRIPTION:
+//    This function scores every pair of codes of a configuration and writes
+//    the feedback matrix file.
+//
+// INPUT:
+//   path - the file to write
+//   pegs - the number of pegs of the configuration
+//   colors - the number of colors of the configuration
+//   repeats - TRUE if codes of the configuration may repeat a color
+//   num_codes - the number of codes of the configuration
+//   num_feedbacks - the number of feedback values
+//   list - lists the codes, returning how many there are
+//   score - the configuration's scorer
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE on success, FALSE if out of memory or the file could not be
+//   written
+//----------------------------------------------------------------------------
+int fmatgen_Write(const char* path, int pegs, int colors, int repeats,
+                  int num_codes, int num_feedbacks,
+                  int (*list)(uint32* codes),
+                  uint8 (*score)(uint32 guess, uint32 secret))
+{
+  uint32 tiles_per_row = (num_codes + FMAT_TILE - 1) / FMAT_TILE;
+  uint32 codes_offset = sizeof(FmatHeader);
+  uint32 data_offset = (codes_offset + sizeof(uint32) * num_codes +
+                        FMAT_PAGE - 1) / FMAT_PAGE * FMAT_PAGE;
+  uint8* head = calloc(1, data_offset);
+  uint8* band = malloc((size_t)tiles_per_row * FMAT_TILE_BYTES);
+  FmatHeader* header = (FmatHeader*)head;
+  uint32* codes = (uint32*)(head + codes_offset);
+  char temp[4096];
+  FILE* file = NULL;
+  int ok = FALSE;
+  uint32 tile_row;
+
+  snprintf(temp, sizeof(temp), "%s.tmp", path);
+  if ((head == NULL) || (band == NULL) || (list(codes) != num_codes))
+  {
+    goto done;
+  }
+  memcpy(header->magic, FMAT_MAGIC, sizeof(FMAT_MAGIC));
+  header->version = FMAT_VERSION;
+  header->pegs = (uint8)pegs;
+  header->colors = (uint8)colors;
+  header->repeats = (uint8)repeats;
+  header->tile_bits = FMAT_TILE_BITS;
+  header->num_codes = (uint32)num_codes;
+  header->num_feedbacks = (uint32)num_feedbacks;
+  header->tiles_per_row = tiles_per_row;
+  header->codes_offset = codes_offset;
+  header->data_offset = data_offset;
+  header->data_tiles = tiles_per_row * tiles_per_row;
+
+  file = fopen(temp, "wb");
+  if ((file == NULL) || (fwrite(head, 1, data_offset, file) != data_offset))
+  {
+    goto done;
+  }
+  for (tile_row = 0; tile_row < tiles_per_row; tile_row++)
+  {
+    uint32 first = tile_row * FMAT_TILE;
+    uint32 tile_col;
+    for (tile_col = 0; tile_col < tiles_per_row; tile_col++)
+    {
+      uint8* tile = band + (size_t)tile_col * FMAT_TILE_BYTES;
+      uint32 r;
+      for (r = 0; r < FMAT_TILE; r++)
+      {
+        uint32 guess = first + r;
+        uint32 c;
+        for (c = 0; c < FMAT_TILE; c++)
+        {
+          uint32 secret = tile_col * FMAT_TILE + c;
+          tile[(r << FMAT_TILE_BITS) + c] =
+            ((guess < (uint32)num_codes) && (secret < (uint32)num_codes)) ?
+            score(codes[guess], codes[secret]) : FMAT_PAD;
+        }
+      }
+    }
+    if (fwrite(band, FMAT_TILE_BYTES, tiles_per_row, file) != tiles_per_row)
+    {
+      goto done;
+    }
+  }
+  ok = (0 == fflush(file)) && (0 == fsync(fileno(file)));
+
+done:
+  if (file != NULL)
+  {
+    ok &= (0 == fclose(file));
+    if (ok)
+    {
+      ok = (0 == rename(temp, path));
+    }
+    if (!ok)
+    {
+      remove(temp);
+    }
+  }
+  free(head);
+  free(band);
+  return ok;
+} /* fmatgen_Write */
@@ -0,0 +1,38 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: fmatgen Definitions
+//
+//    FILENAME: fmatgen.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the feedback matrix
+//              builder used by mkfmat and by the host benchmarks.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef FMATGEN_MOD_H_
+#define FMATGEN_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+// the arguments of fmatgen_Write for an ENGINE_CONFIGS entry, e.g.
+// fmatgen_Write(path, FMATGEN_ENGINE_ARGS(5x8))
+#define FMATGEN_ENGINE_ARGS(name)                                     \
+  ENGINE_PEGS_##name, ENGINE_COLORS_##name, ENGINE_REPEATS_##name,    \
+  ENGINE_NUM_CODES_##name, ENGINE_NUM_FEEDBACKS_##name,               \
+  engine_ListCodes##name, engine_Score##name
+
+int fmatgen_Write(const char* path, int pegs, int colors, int repeats,
+                  int num_codes, int num_feedbacks,
+                  int (*list)(uint32* codes),
+                  uint8 (*score)(uint32 guess, uint32 secret));
+
+#endif /*FMATGEN_MOD_H_*/
@@ -0,0 +1,166 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: framepool Functions
+//
+//    FILENAME: framepool.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the frame pool.  Each slab is mapped with
+//              a pointer to the previous slab in its first block, and frames
+//              are cut from the rest of it in order.  A freed frame holds
+//              the pointer to the next free one, so the pool keeps no other
+//              bookkeeping.  Slabs are unmapped only when the pool is
+//              destroyed.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memset
+#include <sys/mman.h>                 // for mmap
+#include "nios_std_types.h"           // for standard embedded types
+#include "framepool.h"                // for framepool definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: FRAMEPOOL Init
+//
+// DESCRIPTION:
+//    This function starts an empty pool of frames of one size.
+//
+// INPUT:
+//   frame_size - the size of a frame, at most a slab
+//
+// OUTPUT:
+//   pool - the pool
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void framepool_Init(FramePool* pool, unsigned long frame_size)
+{
+  memset(pool, 0, sizeof(FramePool));
+  if (frame_size < sizeof(void*))
+  {
+    frame_size = sizeof(void*);
+  }
+  pool->frame_size = (frame_size + FRAMEPOOL_ALIGN - 1) &
+                     ~(unsigned long)(FRAMEPOOL_ALIGN - 1);
+}
+
+//----------------------------------------------------------------------------
+// NAME: FRAMEPOOL Alloc
+//
+// DESCRIPTION:
+//    This function takes a frame from the pool, mapping a new slab when
+//    there is no free frame and the last slab is used up.
+//
+// INPUT:
+//   pool - the pool
+//
+// OUTPUT:
+//   pool - the pool
+//
+// RETURN:
+//   the frame, or NULL if no slab could be mapped
+//----------------------------------------------------------------------------
+void* framepool_Alloc(FramePool* pool)
+{
+  void* frame = pool->free;
+  void* slab;
+
+  if (frame != NULL)
+  {
+    pool->free = *(void**)frame;
+  }
+  else
+  {
+    if ((unsigned long)(pool->end - pool->next) < pool->frame_size)
+    {
+      slab = mmap(NULL, FRAMEPOOL_SLAB_BYTES, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (slab == MAP_FAILED)
+      {
+        return NULL;
+      }
+      *(void**)slab = pool->slabs;
+      pool->slabs = slab;
+      pool->next = (char*)slab + FRAMEPOOL_ALIGN;
+      pool->end = (char*)slab + FRAMEPOOL_SLAB_BYTES;
+      pool->mapped += FRAMEPOOL_SLAB_BYTES;
+    }
+    frame = pool->next;
+    pool->next += pool->frame_size;
+  }
+  pool->in_use++;
+  return frame;
+}
+
+//----------------------------------------------------------------------------
+// NAME: FRAMEPOOL Free
+//
+// DESCRIPTION:
+//    This function returns a frame to the pool.
+//
+// INPUT:
+//   frame - a frame from framepool_Alloc, or NULL
+//
+// OUTPUT:
+//   pool - the pool
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void framepool_Free(FramePool* pool, void* frame)
+{
+  if (frame == NULL)
+  {
+    return;
+  }
+  *(void**)frame = pool->free;
+  pool->free = frame;
+  pool->in_use--;
+}
+
+//----------------------------------------------------------------------------
+// NAME: FRAMEPOOL Destroy
+//
+// DESCRIPTION:
+//    This function unmaps every slab of the pool, freeing all its frames.
+//
+// INPUT:
+//   pool - the pool
+//
+// OUTPUT:
+//   pool - an empty pool of the same frame size
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void framepool_Destroy(FramePool* pool)
+{
+  void* slab = pool->slabs;
+  void* next;
+
+  while (slab != NULL)
+  {
+    next = *(void**)slab;
+    munmap(slab, FRAMEPOOL_SLAB_BYTES);
+    slab = next;
+  }
+  framepool_Init(pool, pool->frame_size);
+}
@@ -0,0 +1,50 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: framepool Definitions
+//
+//    FILENAME: framepool.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the frame pool, which
+//              hands out blocks of one size for coroutine frames.  Blocks
+//              are cut from large mapped slabs and freed blocks are reused
+//              first, so frames pack tightly and never touch the heap.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef FRAMEPOOL_MOD_H_
+#define FRAMEPOOL_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define FRAMEPOOL_SLAB_BYTES  (2UL << 20)
+#define FRAMEPOOL_ALIGN       16
+
+typedef struct
+{
+  unsigned long      frame_size;      // rounded up to FRAMEPOOL_ALIGN
+  void*              free;            // freed frames, linked through them
+  void*              slabs;           // mapped slabs, linked through them
+  char*              next;            // the next unused byte of the slab
+  char*              end;             // the end of the slab
+  long               in_use;
+  unsigned long long mapped;          // bytes of slabs
+} FramePool;
+
+void  framepool_Init(FramePool* pool, unsigned long frame_size);
+void* framepool_Alloc(FramePool* pool);
+void  framepool_Free(FramePool* pool, void* frame);
+void  framepool_Destroy(FramePool* pool);
+
+#endif /*FRAMEPOOL_MOD_H_*/
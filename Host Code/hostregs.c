@@ -0,0 +1,361 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Host Registers
+//
+//    FILENAME: hostregs.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the simulated peripheral registers and
+//              interrupt table used when the board drivers are built on a
+//              Linux host.  The registers are plain memory: a write is kept
+//              and a read returns the last value written, unless a harness
+//              changes them or attaches a device model through host_IoAttach;
+//              IORD and IOWR then call the model.
+//
+//              alt_irq_disable_all takes the simulated CPU, a recursive lock
+//              that a device model also takes to run an ISR, so a harness
+//              thread raising an interrupt waits for the game's masked code
+//              as it would on the board.  When the interrupts are enabled
+//              again the pending hook lets the model raise what it held
+//              back.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <pthread.h>                  // for pthread_mutex_lock
+#include "system.h"                   // for the register declarations
+#include "nios_std_types.h"           // for standard embedded types
+#include "sys/alt_irq.h"              // for alt_ic_isr_register
+#include "io.h"                       // for IORD and IOWR
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>                // for __rdtsc
+#else
+#include <time.h>                     // for clock_gettime
+#endif
+
+
+//*****************************************************************************
+//                           Define external data
+//*****************************************************************************
+unsigned int hostJtagUartRegs[2];
+unsigned int hostKeyRegs[4];
+unsigned int hostTimerRegs[6];
+unsigned int hostSevenSegRegs[1];
+unsigned int hostLedGRegs[1];
+unsigned int hostLedRRegs[1];
+
+alt_isr_func hostIsrTable[HOST_NUM_IRQS];
+void*        hostIsrContext[HOST_NUM_IRQS];
+
+int          hostIrqDisabled = FALSE;
+void       (*hostIrqPending)(void) = NULL;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static HostIoDevice hostIoDevices[HOST_MAX_DEVICES];
+static int          hostNumDevices = 0;
+
+static pthread_once_t  hostCpuOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t hostCpuLock;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: HOST CPU Init
+//
+// DESCRIPTION:
+//    This function makes the CPU lock recursive, once, so masked code may
+//    mask again and an ISR raised under the lock may mask too.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void host_CpuInit(void)
+{
+  pthread_mutexattr_t attr;
+
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&hostCpuLock, &attr);
+  pthread_mutexattr_destroy(&attr);
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: ALT IC ISR Register
+//
+// DESCRIPTION:
+//    This function records an interrupt service routine so a harness can
+//    call it when its simulated device raises the interrupt.
+//
+// INPUT:
+//   ic_id - the interrupt controller, always 0 on the host
+//   irq - the interrupt number
+//   isr - the service routine
+//   isr_context - passed to the service routine
+//   flags - unused
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 on success, -1 if the interrupt number is out of range
+//----------------------------------------------------------------------------
+int alt_ic_isr_register(unsigned int ic_id, unsigned int irq,
+                        alt_isr_func isr, void* isr_context, void* flags)
+{
+  (void)ic_id;
+  (void)flags;
+  if (irq >= HOST_NUM_IRQS)
+  {
+    return -1;
+  }
+  hostIsrTable[irq] = isr;
+  hostIsrContext[irq] = isr_context;
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ALT IRQ Disable All
+//
+// DESCRIPTION:
+//    This function takes the simulated CPU and masks the interrupts raised
+//    by the device models.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the context to give alt_irq_enable_all
+//----------------------------------------------------------------------------
+alt_irq_context alt_irq_disable_all(void)
+{
+  alt_irq_context context;
+
+  pthread_once(&hostCpuOnce, host_CpuInit);
+  pthread_mutex_lock(&hostCpuLock);
+  context = hostIrqDisabled;
+  hostIrqDisabled = TRUE;
+  return context;
+}
+
+//----------------------------------------------------------------------------
+// NAME: ALT IRQ Enable All
+//
+// DESCRIPTION:
+//    This function puts the interrupt mask back as alt_irq_disable_all
+//    found it, lets the models raise what they held back, and gives the
+//    simulated CPU up.  A model raises its interrupt with
+//    alt_irq_enable_all(alt_irq_disable_all()).
+//
+// INPUT:
+//   context - from alt_irq_disable_all
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void alt_irq_enable_all(alt_irq_context context)
+{
+  hostIrqDisabled = context;
+  if (!hostIrqDisabled && (hostIrqPending != NULL))
+  {
+    hostIrqPending();
+  }
+  pthread_mutex_unlock(&hostCpuLock);
+}
+
+//----------------------------------------------------------------------------
+// NAME: HOST IRQ Try Raise
+//
+// DESCRIPTION:
+//    This function lets a device model raise what is pending if the
+//    simulated CPU is free.  A model whose own work must go on while the
+//    game spins with the interrupts masked raises this way; the interrupt
+//    stays pending for the next alt_irq_enable_all.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the CPU was free
+//----------------------------------------------------------------------------
+int host_IrqTryRaise(void)
+{
+  pthread_once(&hostCpuOnce, host_CpuInit);
+  if (0 != pthread_mutex_trylock(&hostCpuLock))
+  {
+    return FALSE;
+  }
+  if (!hostIrqDisabled && (hostIrqPending != NULL))
+  {
+    hostIrqPending();
+  }
+  pthread_mutex_unlock(&hostCpuLock);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: HOST IO Attach
+//
+// DESCRIPTION:
+//    This function puts a device model behind the registers at base, so
+//    IORD and IOWR there call the model instead of reading memory.
+//
+// INPUT:
+//   base - the registers, e.g. JTAG_UART_0_BASE
+//   read - returns the value of a register
+//   write - takes a value written to a register
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE on success, FALSE if too many models are attached
+//----------------------------------------------------------------------------
+int host_IoAttach(volatile void* base, HostIoRead read, HostIoWrite write)
+{
+  int d;
+
+  for (d = 0; d < hostNumDevices; d++)
+  {
+    if (hostIoDevices[d].base == base)
+    {
+      break;
+    }
+  }
+  if (d == HOST_MAX_DEVICES)
+  {
+    return FALSE;
+  }
+  hostIoDevices[d].base = base;
+  hostIoDevices[d].read = read;
+  hostIoDevices[d].write = write;
+  hostNumDevices += (d == hostNumDevices);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: HOST IO Read
+//
+// DESCRIPTION:
+//    This function reads a register for IORD.
+//
+// INPUT:
+//   base - the device's registers
+//   reg - the register number
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the register's value
+//----------------------------------------------------------------------------
+unsigned int host_IoRead(volatile void* base, int reg)
+{
+  int d;
+
+  for (d = 0; d < hostNumDevices; d++)
+  {
+    if (hostIoDevices[d].base == base)
+    {
+      return hostIoDevices[d].read(reg);
+    }
+  }
+  return ((volatile unsigned int*)base)[reg];
+}
+
+//----------------------------------------------------------------------------
+// NAME: HOST IO Write
+//
+// DESCRIPTION:
+//    This function writes a register for IOWR.
+//
+// INPUT:
+//   base - the device's registers
+//   reg - the register number
+//   data - the value written
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void host_IoWrite(volatile void* base, int reg, unsigned int data)
+{
+  int d;
+
+  for (d = 0; d < hostNumDevices; d++)
+  {
+    if (hostIoDevices[d].base == base)
+    {
+      hostIoDevices[d].write(reg, data);
+      return;
+    }
+  }
+  ((volatile unsigned int*)base)[reg] = data;
+}
+
+//----------------------------------------------------------------------------
+// NAME: HOST Cycles
+//
+// DESCRIPTION:
+//    This function reads the host's cycle counter for UART_CYCLES, or
+//    counts nanoseconds where there is none.  Only differences are used,
+//    so it may wrap.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the low 32 bits of the count
+//----------------------------------------------------------------------------
+unsigned int host_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return (unsigned int)__rdtsc();
+#else
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned int)(now.tv_sec * 1000000000u + now.tv_nsec);
+#endif
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Host IO Definitions
+//
+//    FILENAME: io.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file stands in for the Altera HAL register access
+//              header so the drivers can be built on a Linux host.  IORD and
+//              IOWR go through hostregs.c, which passes them to a device
+//              model when one is attached and to plain memory otherwise.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef HOST_IO_H_
+#define HOST_IO_H_
+
+#define HOST_MAX_DEVICES      4
+
+typedef unsigned int (*HostIoRead)(int reg);
+typedef void (*HostIoWrite)(int reg, unsigned int data);
+
+typedef struct
+{
+  volatile void* base;
+  HostIoRead     read;
+  HostIoWrite    write;
+} HostIoDevice;
+
+int          host_IoAttach(volatile void* base, HostIoRead read,
+                           HostIoWrite write);
+unsigned int host_IoRead(volatile void* base, int reg);
+void         host_IoWrite(volatile void* base, int reg, unsigned int data);
+int          host_IrqTryRaise(void);
+
+// the masks and the hook used by the device models, in hostregs.c
+extern int   hostIrqDisabled;
+extern void (*hostIrqPending)(void);
+
+#define IORD(base, reg)        host_IoRead((volatile void*)(base), (reg))
+#define IOWR(base, reg, data)  host_IoWrite((volatile void*)(base), (reg), \
+                                            (data))
+
+#endif /*HOST_IO_H_*/
@@ -0,0 +1,604 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: jtaguart Functions
+//
+//    FILENAME: jtaguart.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the JTAG UART model.  A read of the data
+//              register takes a byte from the read FIFO, with RVALID set and
+//              RAVAIL holding the bytes left; a write puts a byte in the
+//              write FIFO, or loses it if the FIFO is full.  The control
+//              register reads back RE and WE, the RI and WI pending bits and
+//              WSPACE, the free entries of the write FIFO.
+//
+//              Unless the model holds them, written bytes leave the FIFO at
+//              once, as if the host read them as fast as they came.  The
+//              FIFOs have a lock of their own, so a harness thread can drain
+//              them while the game spins on WSPACE with the interrupts
+//              masked.  The interrupt is raised by calling the UART ISR on
+//              the thread that made it pending, holding the simulated CPU,
+//              never from inside the ISR itself and not while
+//              alt_irq_disable_all has masked it.
+//
+//              jtaguart_SetRate makes the model a rated link: a clock thread
+//              of its own lets the host read the write FIFO at the rate, in
+//              ticks of JTAGUART_TICK_NSEC, and every register access first
+//              catches the FIFO up to the present, so WSPACE is as the
+//              device would show it then.  The time each byte was written
+//              is kept, so the model can tell how long bytes waited in the
+//              FIFO and how long the FIFO was full.  The times are those of
+//              the host, so they are only as close as its clock and its
+//              scheduler make them.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <string.h>                   // for memset
+#include <time.h>                     // for clock_gettime
+#include <pthread.h>                  // for pthread_mutex_lock
+#include "system.h"                   // for the UART base and IRQ
+#include "nios_std_types.h"           // for standard embedded types
+#include "sys/alt_irq.h"              // for alt_irq_disable_all
+#include "io.h"                       // for host_IoAttach
+#include "jtaguart.h"                 // for jtaguart definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define JTAGUART_DATA_REG     0
+#define JTAGUART_CONTROL_REG  1
+
+
+//*****************************************************************************
+//                           Define external data
+//*****************************************************************************
+JtagUart hostJtagUart;
+
+extern alt_isr_func hostIsrTable[HOST_NUM_IRQS];
+extern void*        hostIsrContext[HOST_NUM_IRQS];
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static pthread_mutex_t jtaguartLock = PTHREAD_MUTEX_INITIALIZER;
+
+// the clock thread of a rated link
+static pthread_t       jtaguartClock;
+static volatile int    jtaguartClockRunning = FALSE;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Now
+//
+// DESCRIPTION:
+//    This function reads the host's monotonic clock.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the time in nanoseconds
+//----------------------------------------------------------------------------
+static unsigned long long jtaguart_Now(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long long)now.tv_sec * 1000000000ull + now.tv_nsec;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Send
+//
+// DESCRIPTION:
+//    This function takes bytes out of the write FIFO, as the host reading
+//    them does, and keeps the first ones for the harness to check.  Given
+//    the time, it also counts how long each byte waited and how long the
+//    FIFO had been full.  The caller holds the FIFO lock.
+//
+// INPUT:
+//   max - the most bytes to take
+//   now - the time they leave, or 0 on a link with no rate
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes taken
+//----------------------------------------------------------------------------
+static uint32 jtaguart_Send(uint32 max, unsigned long long now)
+{
+  JtagUart* uart = &hostJtagUart;
+  unsigned long long wait;
+  uint32 n;
+
+  for (n = 0; (n < max) && (uart->tx_count > 0); n++)
+  {
+    if (uart->out_length < JTAGUART_OUT_MAX)
+    {
+      uart->out[uart->out_length++] = (char)uart->tx[uart->tx_head];
+      uart->out[uart->out_length] = '\0';
+    }
+    if (now != 0)
+    {
+      wait = now - uart->tx_nsec[uart->tx_head];
+      uart->wait_nsec += wait;
+      if (wait > uart->wait_max_nsec)
+      {
+        uart->wait_max_nsec = wait;
+      }
+    }
+    uart->tx_head = (uart->tx_head + 1) & (JTAGUART_MAX_DEPTH - 1);
+    uart->tx_count--;
+  }
+  if ((n > 0) && (now != 0) && (uart->full_since != 0))
+  {
+    uart->full_nsec += now - uart->full_since;
+    uart->full_since = 0;
+  }
+  uart->sent += n;
+  return n;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Advance
+//
+// DESCRIPTION:
+//    This function lets the host of a rated link read what it has had time
+//    for since it last read.  A host with nothing to read does not save up
+//    the time.  The caller holds the FIFO lock.
+//
+// INPUT:
+//   now - the time
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes read
+//----------------------------------------------------------------------------
+static uint32 jtaguart_Advance(unsigned long long now)
+{
+  JtagUart* uart = &hostJtagUart;
+  unsigned long long owed;
+  uint32 n;
+
+  if (uart->tx_count == 0)
+  {
+    uart->clock_nsec = now;
+    return 0;
+  }
+  owed = (now - uart->clock_nsec) * uart->rate / 1000000000ull;
+  n = jtaguart_Send((owed < uart->tx_count) ? (uint32)owed : uart->tx_count,
+                    now);
+  uart->clock_nsec += n * 1000000000ull / uart->rate;
+  if (uart->tx_count == 0)
+  {
+    uart->clock_nsec = now;
+  }
+  return n;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Clock
+//
+// DESCRIPTION:
+//    This function is the clock thread of a rated link.  Each tick it lets
+//    the host read and raises the interrupt for the room that made, if the
+//    simulated CPU is free; otherwise the interrupt stays pending until
+//    the game unmasks.
+//
+// INPUT:
+//   arg - not used
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   NULL
+//----------------------------------------------------------------------------
+static void* jtaguart_Clock(void* arg)
+{
+  struct timespec pause = {0, JTAGUART_TICK_NSEC};
+  uint32 n;
+
+  (void)arg;
+  while (jtaguartClockRunning)
+  {
+    nanosleep(&pause, NULL);
+    pthread_mutex_lock(&jtaguartLock);
+    n = jtaguart_Advance(jtaguart_Now());
+    pthread_mutex_unlock(&jtaguartLock);
+    if (n > 0)
+    {
+      host_IrqTryRaise();
+    }
+  }
+  return NULL;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Stop Clock
+//
+// DESCRIPTION:
+//    This function stops the clock thread, if it runs, and waits for it.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void jtaguart_StopClock(void)
+{
+  if (jtaguartClockRunning)
+  {
+    jtaguartClockRunning = FALSE;
+    pthread_join(jtaguartClock, NULL);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Pending
+//
+// DESCRIPTION:
+//    This function tells whether the UART interrupt is pending: a byte to
+//    read with RE set, or room to write with WE set.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the interrupt is pending
+//----------------------------------------------------------------------------
+static int jtaguart_Pending(void)
+{
+  const JtagUart* uart = &hostJtagUart;
+  int pending;
+
+  pthread_mutex_lock(&jtaguartLock);
+  pending = ((uart->control & JTAGUART_RE) && (uart->rx_count > 0)) ||
+            ((uart->control & JTAGUART_WE) && (uart->tx_count < uart->depth));
+  pthread_mutex_unlock(&jtaguartLock);
+  return pending;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Read
+//
+// DESCRIPTION:
+//    This function answers a read of a UART register.
+//
+// INPUT:
+//   reg - the register number
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the register's value
+//----------------------------------------------------------------------------
+static unsigned int jtaguart_Read(int reg)
+{
+  JtagUart* uart = &hostJtagUart;
+  unsigned int value = 0;
+
+  pthread_mutex_lock(&jtaguartLock);
+  if (uart->rate > 0)
+  {
+    jtaguart_Advance(jtaguart_Now());
+  }
+  if (reg == JTAGUART_DATA_REG)
+  {
+    uart->data_reads++;
+    if (uart->rx_count > 0)
+    {
+      value = uart->rx[uart->rx_head] | JTAGUART_RVALID;
+      uart->rx_head = (uart->rx_head + 1) & (JTAGUART_MAX_DEPTH - 1);
+      uart->rx_count--;
+      value |= uart->rx_count << 16;
+    }
+  }
+  else if (reg == JTAGUART_CONTROL_REG)
+  {
+    uart->control_reads++;
+    value = uart->control;
+    if ((uart->control & JTAGUART_RE) && (uart->rx_count > 0))
+    {
+      value |= JTAGUART_RI;
+    }
+    if ((uart->control & JTAGUART_WE) && (uart->tx_count < uart->depth))
+    {
+      value |= JTAGUART_WI;
+    }
+    value |= (uart->depth - uart->tx_count) << 16;
+    if (uart->tx_count == uart->depth)
+    {
+      uart->full_reads++;
+    }
+  }
+  pthread_mutex_unlock(&jtaguartLock);
+  return value;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Write
+//
+// DESCRIPTION:
+//    This function takes a write to a UART register.
+//
+// INPUT:
+//   reg - the register number
+//   data - the value written
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void jtaguart_Write(int reg, unsigned int data)
+{
+  JtagUart* uart = &hostJtagUart;
+  unsigned long long now = 0;
+  uint32 tail;
+
+  pthread_mutex_lock(&jtaguartLock);
+  if (uart->rate > 0)
+  {
+    now = jtaguart_Now();
+    jtaguart_Advance(now);
+  }
+  if (reg == JTAGUART_DATA_REG)
+  {
+    uart->data_writes++;
+    if (uart->tx_count == uart->depth)
+    {
+      uart->overruns++;
+    }
+    else
+    {
+      tail = (uart->tx_head + uart->tx_count) & (JTAGUART_MAX_DEPTH - 1);
+      uart->tx[tail] = (uint8)data;
+      uart->tx_nsec[tail] = now;
+      uart->tx_count++;
+      if ((uart->tx_count == uart->depth) && (now != 0))
+      {
+        uart->full_since = now;
+      }
+      if (!uart->hold && (uart->rate == 0))
+      {
+        jtaguart_Send(uart->tx_count, 0);
+      }
+    }
+    pthread_mutex_unlock(&jtaguartLock);
+  }
+  else if (reg == JTAGUART_CONTROL_REG)
+  {
+    uart->control_writes++;
+    uart->control = data & (JTAGUART_RE | JTAGUART_WE);
+    pthread_mutex_unlock(&jtaguartLock);
+    alt_irq_enable_all(alt_irq_disable_all());
+  }
+  else
+  {
+    pthread_mutex_unlock(&jtaguartLock);
+  }
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Attach
+//
+// DESCRIPTION:
+//    This function empties the model and puts it behind the UART registers,
+//    with no rate.
+//
+// INPUT:
+//   depth - the entries of each FIFO, at most JTAGUART_MAX_DEPTH
+//   hold - TRUE to keep written bytes until jtaguart_Drain takes them
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void jtaguart_Attach(uint32 depth, int hold)
+{
+  jtaguart_StopClock();
+  memset(&hostJtagUart, 0, sizeof(JtagUart));
+  hostJtagUart.depth = (depth < JTAGUART_MAX_DEPTH) ? depth :
+                                                      JTAGUART_MAX_DEPTH;
+  hostJtagUart.hold = hold;
+  host_IoAttach(JTAG_UART_0_BASE, jtaguart_Read, jtaguart_Write);
+  hostIrqPending = jtaguart_Service;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Receive
+//
+// DESCRIPTION:
+//    This function puts a byte typed by the host in the read FIFO and
+//    raises the interrupt.  A byte that does not fit is refused; the JTAG
+//    host would wait and send it again.
+//
+// INPUT:
+//   byte - the byte typed
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the byte was taken, FALSE if the FIFO was full
+//----------------------------------------------------------------------------
+int jtaguart_Receive(uint8 byte)
+{
+  JtagUart* uart = &hostJtagUart;
+  int taken = FALSE;
+
+  pthread_mutex_lock(&jtaguartLock);
+  if (uart->rx_count < uart->depth)
+  {
+    uart->rx[(uart->rx_head + uart->rx_count) & (JTAGUART_MAX_DEPTH - 1)] =
+      byte;
+    uart->rx_count++;
+    taken = TRUE;
+  }
+  pthread_mutex_unlock(&jtaguartLock);
+  alt_irq_enable_all(alt_irq_disable_all());
+  return taken;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Drain
+//
+// DESCRIPTION:
+//    This function takes bytes held in the write FIFO, as the host reading
+//    them does, and raises the interrupt for the room it made.  It does not
+//    wait for the simulated CPU, so it can drain while the game spins on
+//    WSPACE with the interrupts masked.
+//
+// INPUT:
+//   max - the most bytes to take
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of bytes taken
+//----------------------------------------------------------------------------
+uint32 jtaguart_Drain(uint32 max)
+{
+  uint32 n;
+
+  pthread_mutex_lock(&jtaguartLock);
+  n = jtaguart_Send(max, 0);
+  pthread_mutex_unlock(&jtaguartLock);
+  host_IrqTryRaise();
+  return n;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Service
+//
+// DESCRIPTION:
+//    This function calls the UART ISR for as long as the interrupt is
+//    pending.  It is the pending hook of alt_irq_enable_all, so it runs
+//    holding the simulated CPU; it does nothing inside the ISR, while the
+//    interrupts are masked, or before the ISR is registered.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void jtaguart_Service(void)
+{
+  JtagUart* uart = &hostJtagUart;
+  alt_isr_func isr = hostIsrTable[JTAG_UART_0_IRQ];
+  uint32 n;
+
+  if (uart->servicing || hostIrqDisabled || (isr == NULL))
+  {
+    return;
+  }
+  uart->servicing = TRUE;
+  for (n = 0; (n < JTAGUART_MAX_RAISES) && jtaguart_Pending(); n++)
+  {
+    uart->raises++;
+    isr(hostIsrContext[JTAG_UART_0_IRQ]);
+  }
+  uart->servicing = FALSE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Clear Output
+//
+// DESCRIPTION:
+//    This function forgets the bytes kept of what was sent.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void jtaguart_ClearOutput(void)
+{
+  pthread_mutex_lock(&jtaguartLock);
+  hostJtagUart.out_length = 0;
+  hostJtagUart.out[0] = '\0';
+  pthread_mutex_unlock(&jtaguartLock);
+}
+
+//----------------------------------------------------------------------------
+// NAME: JTAGUART Set Rate
+//
+// DESCRIPTION:
+//    This function sets the rate at which the host reads the write FIFO,
+//    starting the clock thread, or with 0 stops it and lets hold decide
+//    again.  Bytes left in the FIFO when the clock stops stay there until
+//    the next write or jtaguart_Drain.
+//
+// INPUT:
+//   rate - bytes a second, or 0
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void jtaguart_SetRate(uint32 rate)
+{
+  jtaguart_StopClock();
+  pthread_mutex_lock(&jtaguartLock);
+  hostJtagUart.rate = rate;
+  hostJtagUart.clock_nsec = jtaguart_Now();
+  hostJtagUart.full_since = 0;
+  pthread_mutex_unlock(&jtaguartLock);
+  if (rate > 0)
+  {
+    jtaguartClockRunning = TRUE;
+    pthread_create(&jtaguartClock, NULL, jtaguart_Clock, NULL);
+  }
+}
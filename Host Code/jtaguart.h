@@ -0,0 +1,95 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: jtaguart Definitions
+//
+//    FILENAME: jtaguart.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the JTAG UART model,
+//              which stands behind the UART registers on a Linux host.  It
+//              keeps a write FIFO and a read FIFO and answers the data and
+//              control registers as the device does, and it raises the UART
+//              interrupt itself while the interrupt is enabled and pending.
+//              Given a rate, the host reads the write FIFO at that many
+//              bytes a second on a clock of its own, and the model keeps
+//              how long bytes waited in the FIFO and how long it was full.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef JTAGUART_MOD_H_
+#define JTAGUART_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define JTAGUART_MAX_DEPTH    1024    // power of two
+#define JTAGUART_DEPTH        64      // the FIFO depth of the board's core
+#define JTAGUART_OUT_MAX      8192    // bytes kept of what was sent
+#define JTAGUART_MAX_RAISES   100000  // ISR calls at most per service
+#define JTAGUART_TICK_NSEC    20000   // between two reads of a rated host
+
+// register bits
+#define JTAGUART_RVALID       0x00008000
+#define JTAGUART_RE           0x00000001
+#define JTAGUART_WE           0x00000002
+#define JTAGUART_RI           0x00000100
+#define JTAGUART_WI           0x00000200
+#define JTAGUART_AC           0x00000400
+
+typedef struct
+{
+  uint32 depth;                       // entries of each FIFO
+  int    hold;                        // TRUE: written bytes wait for Drain
+  uint32 rate;                        // bytes a second the host reads, 0: all
+                                      // at once, or as hold says
+  unsigned long long clock_nsec;      // the time the host has read up to
+  uint32 control;                     // RE and WE as last written
+  uint8  tx[JTAGUART_MAX_DEPTH];
+  unsigned long long tx_nsec[JTAGUART_MAX_DEPTH];  // when each was written
+  uint32 tx_head;
+  uint32 tx_count;
+  uint8  rx[JTAGUART_MAX_DEPTH];
+  uint32 rx_head;
+  uint32 rx_count;
+  int    servicing;                   // TRUE while the ISR runs
+
+  // what the drivers did, for the benchmarks
+  unsigned long long data_reads;
+  unsigned long long control_reads;
+  unsigned long long data_writes;
+  unsigned long long control_writes;
+  unsigned long long overruns;        // bytes written to a full FIFO
+  unsigned long long sent;            // bytes that left the write FIFO
+  unsigned long long raises;          // ISR calls
+  unsigned long long full_reads;      // control reads that found no WSPACE
+
+  // with a rate, for the latency benchmarks
+  unsigned long long wait_nsec;       // bytes' total time in the write FIFO
+  unsigned long long wait_max_nsec;   // the longest a byte waited
+  unsigned long long full_nsec;       // time the write FIFO was full
+  unsigned long long full_since;      // when it filled, 0 when not full
+
+  char   out[JTAGUART_OUT_MAX + 1];   // the first bytes sent, NULL ended
+  uint32 out_length;
+} JtagUart;
+
+extern JtagUart hostJtagUart;
+
+void   jtaguart_Attach(uint32 depth, int hold);
+int    jtaguart_Receive(uint8 byte);
+uint32 jtaguart_Drain(uint32 max);
+void   jtaguart_Service(void);
+void   jtaguart_ClearOutput(void);
+void   jtaguart_SetRate(uint32 rate);
+
+#endif /*JTAGUART_MOD_H_*/
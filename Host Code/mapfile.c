@@ -0,0 +1,147 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: mapfile Functions
+//
+//    FILENAME: mapfile.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the functions that map a file read-only
+//              into memory and that write one out.  A file is written under
+//              a temporary name and renamed, so a process mapping the old
+//              file never sees a partly written one.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for snprintf
+#include <fcntl.h>                    // for open
+#include <unistd.h>                   // for close
+#include <sys/mman.h>                 // for mmap
+#include <sys/stat.h>                 // for fstat
+#include "nios_std_types.h"           // for standard embedded types
+#include "mapfile.h"                  // for mapfile definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: MAPFILE Open
+//
+// DESCRIPTION:
+//    This function maps a whole file read-only.
+//
+// INPUT:
+//   path - the file to map
+//
+// OUTPUT:
+//   file - the mapping
+//
+// RETURN:
+//   TRUE on success, FALSE if the file could not be mapped
+//----------------------------------------------------------------------------
+int mapfile_Open(MapFile* file, const char* path)
+{
+  struct stat info;
+  void* data;
+  int fd;
+
+  file->data = NULL;
+  file->size = 0;
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return FALSE;
+  }
+  if ((0 != fstat(fd, &info)) || (info.st_size <= 0))
+  {
+    close(fd);
+    return FALSE;
+  }
+  data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    return FALSE;
+  }
+  file->data = data;
+  file->size = (unsigned long long)info.st_size;
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: MAPFILE Close
+//
+// DESCRIPTION:
+//    This function removes a mapping made by mapfile_Open.
+//
+// INPUT:
+//   file - the mapping, may be closed already
+//
+// OUTPUT:
+//   file - closed
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void mapfile_Close(MapFile* file)
+{
+  if (file->data != NULL)
+  {
+    munmap((void*)file->data, file->size);
+  }
+  file->data = NULL;
+  file->size = 0;
+}
+
+//----------------------------------------------------------------------------
+// NAME: MAPFILE Write
+//
+// DESCRIPTION:
+//    This function writes a block of bytes to a file, replacing it in one
+//    step once the bytes are all on disk.
+//
+// INPUT:
+//   path - the file to write
+//   data - the bytes
+//   size - the number of bytes
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE on success, FALSE if the file could not be written
+//----------------------------------------------------------------------------
+int mapfile_Write(const char* path, const void* data, uint32 size)
+{
+  char temp[4096];
+  FILE* file;
+  int ok;
+
+  snprintf(temp, sizeof(temp), "%s.tmp", path);
+  file = fopen(temp, "wb");
+  if (file == NULL)
+  {
+    return FALSE;
+  }
+  ok = (fwrite(data, 1, size, file) == size);
+  ok &= (0 == fflush(file)) && (0 == fsync(fileno(file)));
+  ok &= (0 == fclose(file));
+  if (!ok || (0 != rename(temp, path)))
+  {
+    remove(temp);
+    return FALSE;
+  }
+  return TRUE;
+}
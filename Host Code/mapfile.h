@@ -0,0 +1,38 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: mapfile Definitions
+//
+//    FILENAME: mapfile.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions for read-only file
+//              mappings on the host.  A mapped file is shared by every
+//              process that maps it and is only read from disk as its pages
+//              are touched.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef MAPFILE_MOD_H_
+#define MAPFILE_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+typedef struct
+{
+  const void*        data;            // the mapped bytes, NULL if not open
+  unsigned long long size;            // the number of bytes
+} MapFile;
+
+int  mapfile_Open(MapFile* file, const char* path);
+void mapfile_Close(MapFile* file);
+int  mapfile_Write(const char* path, const void* data, uint32 size);
+
+#endif /*MAPFILE_MOD_H_*/
@@ -0,0 +1,87 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Make Opening Book
+//
+//    FILENAME: mkbook.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the tool that builds the opening book,
+//              checks it against the scoring rules and writes it out.  Build
+//              and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/mkbook.c"
+//                    "Host Code/bookgen.c" "Host Code/mapfile.c"
+//                    "C Code/book.c" "C Code/score.c" "C Code/batch.c"
+//                    "C Code/solver.c" "C Code/engine.c" "C Code/rng.c"
+//                    -o mkbook
+//                ./mkbook [book file]
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <stdlib.h>                   // for free
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for score_Init
+#include "solver.h"                   // for solver_Init
+#include "engine.h"                   // for the 4x6 configuration
+#include "book.h"                     // for the book checks
+#include "bookgen.h"                  // for the book builder
+#include "mapfile.h"                  // for mapfile_Write
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define MKBOOK_DEFAULT_PATH   "opening.book"
+
+
+int main(int argc, char* argv[])
+{
+  const char* path = (argc > 1) ? argv[1] : MKBOOK_DEFAULT_PATH;
+  static uint32 codes[ENGINE_NUM_CODES_4x6];
+  const BookSection* section;
+  uint32 size;
+  uint8* book;
+
+  score_Init();
+  solver_Init();
+  engine_ListCodes4x6(codes);
+
+  book = bookgen_Build(&size);
+  if (book == NULL)
+  {
+    printf("out of memory\n");
+    return 1;
+  }
+  section = book_FindSection(book, size, ENGINE_PEGS_4x6, ENGINE_COLORS_4x6,
+                             ENGINE_REPEATS_4x6);
+  if ((section == NULL) ||
+      !book_CheckSection(book, section, codes, engine_Pattern4x6))
+  {
+    printf("the book does not match the scoring rules\n");
+    free(book);
+    return 1;
+  }
+  if (!mapfile_Write(path, book, size))
+  {
+    printf("cannot write %s\n", path);
+    free(book);
+    return 1;
+  }
+  printf("%s: %lu bytes, 1 section, checksum %08lx\n", path,
+         (unsigned long)size,
+         (unsigned long)((const BookHeader*)book)->checksum);
+  free(book);
+  return 0;
+} /* main */
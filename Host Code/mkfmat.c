@@ -0,0 +1,119 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Make Feedback Matrix
+//
+//    FILENAME: mkfmat.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the tool that builds the feedback matrix
+//              of a configuration, maps it back and checks it against the
+//              scoring rules.  Build and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/mkfmat.c"
+//                    "Host Code/fmatgen.c" "Host Code/mapfile.c"
+//                    "C Code/fmat.c" "C Code/engine.c" "C Code/rng.c"
+//                    -o mkfmat
+//                ./mkfmat 4x6|5x8|6x10 [matrix file]
+//
+//              The 5x8 matrix is 1 GB and the 6x10 matrix is 21 GB.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <stdlib.h>                   // for malloc
+#include <string.h>                   // for strcmp
+#include "nios_std_types.h"           // for standard embedded types
+#include "engine.h"                   // for the configurations
+#include "fmat.h"                     // for the matrix checks
+#include "fmatgen.h"                  // for the matrix builder
+#include "mapfile.h"                  // for mapped files
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define MKFMAT_SAMPLES        100000
+
+typedef struct
+{
+  const char* name;
+  int   pegs;
+  int   colors;
+  int   repeats;
+  int   num_codes;
+  int   num_feedbacks;
+  int   (*list)(uint32* codes);
+  uint8 (*score)(uint32 guess, uint32 secret);
+} MkfmatConfig;
+
+#define MKFMAT_CONFIG(name, pegs, colors, repeats)                    \
+  {#name, FMATGEN_ENGINE_ARGS(name)},
+
+static const MkfmatConfig mkfmatConfigs[] =
+{
+  ENGINE_CONFIGS(MKFMAT_CONFIG)
+};
+
+#define MKFMAT_NUM_CONFIGS (int)(sizeof(mkfmatConfigs) / \
+                                 sizeof(mkfmatConfigs[0]))
+
+
+int main(int argc, char* argv[])
+{
+  const MkfmatConfig* config = NULL;
+  char default_path[64];
+  const char* path;
+  uint32* codes;
+  MapFile file;
+  FmatView view;
+  int ok;
+  int c;
+
+  for (c = 0; (argc > 1) && (c < MKFMAT_NUM_CONFIGS); c++)
+  {
+    if (0 == strcmp(argv[1], mkfmatConfigs[c].name))
+    {
+      config = &mkfmatConfigs[c];
+    }
+  }
+  if (config == NULL)
+  {
+    printf("usage: mkfmat 4x6|5x8|6x10 [matrix file]\n");
+    return 1;
+  }
+  snprintf(default_path, sizeof(default_path), "feedback%s.fmat",
+           config->name);
+  path = (argc > 2) ? argv[2] : default_path;
+
+  codes = malloc(sizeof(uint32) * config->num_codes);
+  if ((codes == NULL) ||
+      !fmatgen_Write(path, config->pegs, config->colors, config->repeats,
+                     config->num_codes, config->num_feedbacks, config->list,
+                     config->score))
+  {
+    printf("cannot write %s\n", path);
+    free(codes);
+    return 1;
+  }
+  config->list(codes);
+  ok = mapfile_Open(&file, path) &&
+       fmat_Open(&view, file.data, file.size, config->pegs, config->colors,
+                 config->repeats) &&
+       fmat_Check(&view, codes, config->score, MKFMAT_SAMPLES);
+  printf("%s: %llu bytes, %d codes, %s\n", path, file.size,
+         config->num_codes, ok ? "checked" : "DOES NOT MATCH THE RULES");
+  mapfile_Close(&file);
+  free(codes);
+  return !ok;
+} /* main */
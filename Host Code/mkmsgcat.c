@@ -0,0 +1,513 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Make Message Catalog
+//
+//    FILENAME: mkmsgcat.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the tool that compresses the messages of
+//              msgtext.h into the tables of msgcat_tab.h.  It gives each
+//              character a canonical Huffman code from its count over all
+//              the messages, checks that every message decodes back to its
+//              text, and reports the bytes saved against keeping the
+//              messages as string literals.  Build and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/mkmsgcat.c"
+//                    -o mkmsgcat
+//                ./mkmsgcat [table file]
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <string.h>                   // for memset
+#include "nios_std_types.h"           // for standard embedded types
+#include "msgcat.h"                   // for the message ids and code limit
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define MKMSGCAT_DEFAULT_PATH "C Code/msgcat_tab.h"
+#define MKMSGCAT_SYMBOLS      256
+#define MKMSGCAT_MAX_CODED    8192    // bytes of coded text, for uint16 starts
+#define MKMSGCAT_PER_LINE     12      // table entries per line
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static const char* const mkmsgcatNames[MSGCAT_NUM_MESSAGES] =
+{
+#define MSGCAT_TEXT(id, text)  #id,
+#include "msgtext.h"
+#undef MSGCAT_TEXT
+};
+
+static const char* const mkmsgcatTexts[MSGCAT_NUM_MESSAGES] =
+{
+#define MSGCAT_TEXT(id, text)  text,
+#include "msgtext.h"
+#undef MSGCAT_TEXT
+};
+
+static uint32 mkmsgcatCounts[MKMSGCAT_SYMBOLS];   // of each character
+static uint8  mkmsgcatLengths[MKMSGCAT_SYMBOLS];  // of each code, 0 = unused
+static uint32 mkmsgcatCodes[MKMSGCAT_SYMBOLS];
+static uint8  mkmsgcatSymbols[MKMSGCAT_SYMBOLS];  // in canonical order
+static uint32 mkmsgcatNumSymbols;
+static uint32 mkmsgcatPerLength[MSGCAT_MAX_BITS + 1];
+static uint8  mkmsgcatCoded[MKMSGCAT_MAX_CODED];
+static uint32 mkmsgcatBits;                       // of coded text
+static uint16 mkmsgcatStarts[MSGCAT_NUM_MESSAGES];
+static uint16 mkmsgcatPlainLengths[MSGCAT_NUM_MESSAGES];
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: MKMSGCAT Code Lengths
+//
+// DESCRIPTION:
+//    This function builds a Huffman tree over the characters with the given
+//    weights, joining the two lightest nodes until one is left, and sets
+//    each character's code length to its depth.
+//
+// INPUT:
+//   weights - the weight of each character, 0 for unused
+//
+// OUTPUT:
+//   mkmsgcatLengths - the code lengths
+//
+// RETURN:
+//   the longest code
+//----------------------------------------------------------------------------
+static uint32 mkmsgcat_CodeLengths(const uint32* weights)
+{
+  static uint32 weight[2 * MKMSGCAT_SYMBOLS];
+  static int    parent[2 * MKMSGCAT_SYMBOLS];
+  static int    alive[2 * MKMSGCAT_SYMBOLS];
+  uint32 longest = 0;
+  uint32 depth;
+  int    nodes;
+  int    left = 0;
+  int    lightest;
+  int    second;
+  int    n;
+  int    s;
+
+  for (s = 0; s < MKMSGCAT_SYMBOLS; s++)
+  {
+    weight[s] = weights[s];
+    parent[s] = -1;
+    alive[s] = (weights[s] > 0);
+    left += alive[s];
+  }
+  nodes = MKMSGCAT_SYMBOLS;
+
+  while (left > 1)
+  {
+    lightest = -1;
+    second = -1;
+    for (n = 0; n < nodes; n++)
+    {
+      if (!alive[n])
+      {
+        continue;
+      }
+      if ((lightest < 0) || (weight[n] < weight[lightest]))
+      {
+        second = lightest;
+        lightest = n;
+      }
+      else if ((second < 0) || (weight[n] < weight[second]))
+      {
+        second = n;
+      }
+    }
+    weight[nodes] = weight[lightest] + weight[second];
+    parent[nodes] = -1;
+    alive[nodes] = TRUE;
+    parent[lightest] = nodes;
+    parent[second] = nodes;
+    alive[lightest] = FALSE;
+    alive[second] = FALSE;
+    nodes++;
+    left--;
+  }
+
+  for (s = 0; s < MKMSGCAT_SYMBOLS; s++)
+  {
+    mkmsgcatLengths[s] = 0;
+    if (weights[s] == 0)
+    {
+      continue;
+    }
+    depth = 0;
+    for (n = s; parent[n] >= 0; n = parent[n])
+    {
+      depth++;
+    }
+    mkmsgcatLengths[s] = (uint8)((depth > 0) ? depth : 1);
+    if (mkmsgcatLengths[s] > longest)
+    {
+      longest = mkmsgcatLengths[s];
+    }
+  }
+  return longest;
+}
+
+//----------------------------------------------------------------------------
+// NAME: MKMSGCAT Assign Codes
+//
+// DESCRIPTION:
+//    This function gives the canonical codes: the characters are taken by
+//    code length and then by value, and each gets the code after the one
+//    before it, doubled at each new length.  msgcat_Read only needs the
+//    number of codes of each length and the characters in this order.
+//
+// INPUT:
+//   mkmsgcatLengths - the code lengths
+//
+// OUTPUT:
+//   mkmsgcatCodes, mkmsgcatSymbols, mkmsgcatPerLength - the codes
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void mkmsgcat_AssignCodes(void)
+{
+  uint32 code = 0;
+  uint32 length;
+  int    s;
+
+  mkmsgcatNumSymbols = 0;
+  memset(mkmsgcatPerLength, 0, sizeof(mkmsgcatPerLength));
+  for (length = 1; length <= MSGCAT_MAX_BITS; length++)
+  {
+    for (s = 0; s < MKMSGCAT_SYMBOLS; s++)
+    {
+      if (mkmsgcatLengths[s] == length)
+      {
+        mkmsgcatCodes[s] = code++;
+        mkmsgcatSymbols[mkmsgcatNumSymbols++] = (uint8)s;
+        mkmsgcatPerLength[length]++;
+      }
+    }
+    code <<= 1;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: MKMSGCAT Encode
+//
+// DESCRIPTION:
+//    This function codes every message, most significant bit first, one
+//    after another in a single stream.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   mkmsgcatCoded, mkmsgcatStarts, mkmsgcatPlainLengths - the messages
+//
+// RETURN:
+//   TRUE, or FALSE if the coded text is too long
+//----------------------------------------------------------------------------
+static int mkmsgcat_Encode(void)
+{
+  const uint8* text;
+  uint32 bit;
+  int    m;
+  int    i;
+  int    b;
+
+  memset(mkmsgcatCoded, 0, sizeof(mkmsgcatCoded));
+  mkmsgcatBits = 0;
+  for (m = 0; m < MSGCAT_NUM_MESSAGES; m++)
+  {
+    text = (const uint8*)mkmsgcatTexts[m];
+    mkmsgcatStarts[m] = (uint16)mkmsgcatBits;
+    mkmsgcatPlainLengths[m] = (uint16)strlen(mkmsgcatTexts[m]);
+    for (i = 0; text[i] != '\0'; i++)
+    {
+      for (b = mkmsgcatLengths[text[i]] - 1; b >= 0; b--)
+      {
+        if (mkmsgcatBits >= 8 * MKMSGCAT_MAX_CODED)
+        {
+          return FALSE;
+        }
+        bit = (mkmsgcatCodes[text[i]] >> b) & 1;
+        mkmsgcatCoded[mkmsgcatBits >> 3] |=
+          (uint8)(bit << (7 - (mkmsgcatBits & 7)));
+        mkmsgcatBits++;
+      }
+    }
+  }
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: MKMSGCAT Check
+//
+// DESCRIPTION:
+//    This function decodes every message bit by bit from the codes, the
+//    way msgcat_Read does from the tables, and compares it with its text.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if every message decodes to its text
+//----------------------------------------------------------------------------
+static int mkmsgcat_Check(void)
+{
+  const uint8* text;
+  uint32 position;
+  uint32 code;
+  uint32 length;
+  int    found;
+  int    m;
+  int    i;
+  int    s;
+
+  for (m = 0; m < MSGCAT_NUM_MESSAGES; m++)
+  {
+    text = (const uint8*)mkmsgcatTexts[m];
+    position = mkmsgcatStarts[m];
+    for (i = 0; i < mkmsgcatPlainLengths[m]; i++)
+    {
+      code = 0;
+      found = -1;
+      for (length = 1; (length <= MSGCAT_MAX_BITS) && (found < 0); length++)
+      {
+        code = (code << 1) |
+               ((mkmsgcatCoded[position >> 3] >> (7 - (position & 7))) & 1);
+        position++;
+        for (s = 0; s < MKMSGCAT_SYMBOLS; s++)
+        {
+          if ((mkmsgcatLengths[s] == length) && (mkmsgcatCodes[s] == code))
+          {
+            found = s;
+          }
+        }
+      }
+      if (found != text[i])
+      {
+        printf("%s does not decode at character %d\n", mkmsgcatNames[m], i);
+        return FALSE;
+      }
+    }
+  }
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: MKMSGCAT Write Table
+//
+// DESCRIPTION:
+//    This function writes the entries of a table, MKMSGCAT_PER_LINE a
+//    line.
+//
+// INPUT:
+//   file - the open table file
+//   type - the C type of the entries
+//   name - the table name
+//   size - the number of entries, as written between the brackets
+//   values - the entries
+//   count - the number of entries
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void mkmsgcat_WriteTable(FILE* file, const char* type,
+                                const char* name, const char* size,
+                                const uint32* values, uint32 count)
+{
+  uint32 i;
+
+  fprintf(file, "static const %s %s[%s] =\n{", type, name, size);
+  for (i = 0; i < count; i++)
+  {
+    fprintf(file, "%s%lu%s", (i % MKMSGCAT_PER_LINE == 0) ? "\n  " : " ",
+            (unsigned long)values[i], (i + 1 < count) ? "," : "");
+  }
+  fprintf(file, "\n};\n\n");
+}
+
+//----------------------------------------------------------------------------
+// NAME: MKMSGCAT Write
+//
+// DESCRIPTION:
+//    This function writes msgcat_tab.h.
+//
+// INPUT:
+//   path - the file to write
+//   plain - the bytes the messages take as string literals
+//   packed - the bytes the tables take
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE, or FALSE if the file could not be written
+//----------------------------------------------------------------------------
+static int mkmsgcat_Write(const char* path, uint32 plain, uint32 packed)
+{
+  static uint32 values[MKMSGCAT_MAX_CODED];
+  FILE* file = fopen(path, "w");
+  uint32 bytes = (mkmsgcatBits + 7) / 8;
+  uint32 i;
+
+  if (file == NULL)
+  {
+    return FALSE;
+  }
+  fprintf(file,
+    "//*****************************************************************************\n"
+    "//*****************************************************************************\n"
+    "//*****************************    C Source Code    ***************************\n"
+    "//*****************************************************************************\n"
+    "//*****************************************************************************\n"
+    "//\n"
+    "//        NAME: msgcat Tables\n"
+    "//\n"
+    "//    FILENAME: msgcat_tab.h\n"
+    "//\n"
+    "//    DESIGNER: Nolbert Valverde\n"
+    "//\n"
+    "//     CREATED: 10/17/2026\n"
+    "//\n"
+    "// DESCRIPTION: This file contains the messages of msgtext.h Huffman coded\n"
+    "//              for msgcat.c.  It is written by mkmsgcat; do not edit it.\n"
+    "//              %d messages, %lu bytes as string literals, %lu bytes coded.\n"
+    "//\n"
+    "//*****************************************************************************\n"
+    "//*****************************************************************************\n"
+    "\n"
+    "#define MSGCAT_TAB_NUM_MESSAGES  %d\n"
+    "#define MSGCAT_TAB_NUM_SYMBOLS   %lu\n"
+    "#define MSGCAT_TAB_CODED_BYTES   %lu\n"
+    "#define MSGCAT_TAB_PLAIN_BYTES   %lu\n"
+    "#define MSGCAT_TAB_PACKED_BYTES  %lu\n"
+    "\n",
+    MSGCAT_NUM_MESSAGES, (unsigned long)plain, (unsigned long)packed,
+    MSGCAT_NUM_MESSAGES, (unsigned long)mkmsgcatNumSymbols,
+    (unsigned long)bytes, (unsigned long)plain, (unsigned long)packed);
+
+  fprintf(file, "// the number of codes of each length\n");
+  mkmsgcat_WriteTable(file, "uint8 ", "msgcatPerLength", "MSGCAT_MAX_BITS + 1",
+                      mkmsgcatPerLength, MSGCAT_MAX_BITS + 1);
+
+  fprintf(file, "// the characters in the order of their codes\n");
+  for (i = 0; i < mkmsgcatNumSymbols; i++)
+  {
+    values[i] = mkmsgcatSymbols[i];
+  }
+  mkmsgcat_WriteTable(file, "uint8 ", "msgcatSymbols",
+                      "MSGCAT_TAB_NUM_SYMBOLS", values, mkmsgcatNumSymbols);
+
+  fprintf(file, "// the first bit of each message\n");
+  for (i = 0; i < MSGCAT_NUM_MESSAGES; i++)
+  {
+    values[i] = mkmsgcatStarts[i];
+  }
+  mkmsgcat_WriteTable(file, "uint16", "msgcatStarts",
+                      "MSGCAT_TAB_NUM_MESSAGES", values, MSGCAT_NUM_MESSAGES);
+
+  fprintf(file, "// the characters of each message\n");
+  for (i = 0; i < MSGCAT_NUM_MESSAGES; i++)
+  {
+    values[i] = mkmsgcatPlainLengths[i];
+  }
+  mkmsgcat_WriteTable(file, "uint16", "msgcatLengths",
+                      "MSGCAT_TAB_NUM_MESSAGES", values, MSGCAT_NUM_MESSAGES);
+
+  fprintf(file, "// the coded messages, most significant bit first\n");
+  for (i = 0; i < bytes; i++)
+  {
+    values[i] = mkmsgcatCoded[i];
+  }
+  mkmsgcat_WriteTable(file, "uint8 ", "msgcatCoded", "MSGCAT_TAB_CODED_BYTES",
+                      values, bytes);
+
+  return (0 == fclose(file));
+}
+
+
+int main(int argc, char* argv[])
+{
+  const char* path = (argc > 1) ? argv[1] : MKMSGCAT_DEFAULT_PATH;
+  uint32 weights[MKMSGCAT_SYMBOLS];
+  uint32 plain = 0;
+  uint32 packed;
+  const uint8* text;
+  int m;
+  int s;
+
+  memset(mkmsgcatCounts, 0, sizeof(mkmsgcatCounts));
+  for (m = 0; m < MSGCAT_NUM_MESSAGES; m++)
+  {
+    plain += (uint32)strlen(mkmsgcatTexts[m]) + 1;
+    for (text = (const uint8*)mkmsgcatTexts[m]; *text != '\0'; text++)
+    {
+      mkmsgcatCounts[*text]++;
+    }
+  }
+
+  // flatten the counts until the longest code fits msgcat_Read
+  memcpy(weights, mkmsgcatCounts, sizeof(weights));
+  while (mkmsgcat_CodeLengths(weights) > MSGCAT_MAX_BITS)
+  {
+    for (s = 0; s < MKMSGCAT_SYMBOLS; s++)
+    {
+      weights[s] = (weights[s] + 1) / 2;
+    }
+  }
+  mkmsgcat_AssignCodes();
+
+  if (!mkmsgcat_Encode())
+  {
+    printf("the coded messages are over %d bytes\n", MKMSGCAT_MAX_CODED);
+    return 1;
+  }
+  if (!mkmsgcat_Check())
+  {
+    return 1;
+  }
+
+  packed = (MSGCAT_MAX_BITS + 1) + mkmsgcatNumSymbols +
+           2 * 2 * MSGCAT_NUM_MESSAGES + (mkmsgcatBits + 7) / 8;
+  if (!mkmsgcat_Write(path, plain, packed))
+  {
+    printf("cannot write %s\n", path);
+    return 1;
+  }
+  printf("%s: %d messages, %lu characters, %lu codes\n", path,
+         MSGCAT_NUM_MESSAGES, (unsigned long)(plain - MSGCAT_NUM_MESSAGES),
+         (unsigned long)mkmsgcatNumSymbols);
+  printf("string literals %6lu bytes\n", (unsigned long)plain);
+  printf("coded tables    %6lu bytes (%.2f bits a character)\n",
+         (unsigned long)packed,
+         (double)mkmsgcatBits / (plain - MSGCAT_NUM_MESSAGES));
+  printf("saved           %6ld bytes\n", (long)plain - (long)packed);
+  return 0;
+} /* main */
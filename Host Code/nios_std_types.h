@@ -0,0 +1,42 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Host Standard Types
+//
+//    FILENAME: nios_std_types.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file stands in for the Nios II BSP header of the same
+//              name so the portable game modules can be built on a Linux
+//              host.  The sizes match the board: uint32 is 32 bits wide.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef NIOS_STD_TYPES_H_
+#define NIOS_STD_TYPES_H_
+
+#include <stdint.h>                   // for fixed width types
+
+typedef uint8_t   uint8;
+typedef int8_t    int8;
+typedef uint16_t  uint16;
+typedef int16_t   int16;
+typedef uint32_t  uint32;
+typedef int32_t   int32;
+
+#ifndef TRUE
+#define TRUE  1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#endif /*NIOS_STD_TYPES_H_*/
@@ -0,0 +1,511 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: pool Functions
+//
+//    FILENAME: pool.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains a work stealing thread pool for the host
+//              and the parallel solver evaluator built on it.  A job is cut
+//              into chunks and each worker gets a contiguous block of them.
+//              A worker takes chunks from the front of its own block and,
+//              once it is empty, steals from the back of the other blocks.
+//              The front and back of a block share one atomic word, so
+//              taking a chunk is a single compare-and-swap.  The calling
+//              thread is worker 0, so a pool of one thread starts no others.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include <pthread.h>                  // for threads
+#include <stdatomic.h>                // for lock free block ranges
+#include <stdint.h>                   // for uint64_t
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for SCORE_NUM_SECRETS
+#include "batch.h"                    // for the batch kernel
+#include "solver.h"                   // for the solver evaluator
+#include "pool.h"                     // for pool definitions
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define POOL_CACHE_LINE       64
+#define POOL_SOLVER_CHUNK     16      // guesses per chunk
+
+// a block of chunks: front in the low half of the word, back in the high
+typedef struct
+{
+  _Alignas(POOL_CACHE_LINE) _Atomic uint64_t range;
+} PoolBlock;
+
+// per worker solver state, kept apart so workers never share a cache line
+typedef struct
+{
+  _Alignas(POOL_CACHE_LINE) SolverChoice best;
+  uint8 feedback[SCORE_NUM_SECRETS];
+} PoolSolverSlot;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static pthread_t       poolThreads[POOL_MAX_THREADS];
+static PoolBlock       poolBlocks[POOL_MAX_THREADS];
+static int             poolNumThreads = 0;
+
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  poolStart = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  poolDone = PTHREAD_COND_INITIALIZER;
+static uint32          poolGeneration = 0;
+static int             poolShutdown = FALSE;
+static atomic_int      poolPending;
+
+static PoolTask        poolTask;
+static void*           poolContext;
+static int             poolTotal;
+static int             poolChunk;
+
+static PoolSolverSlot  poolSolverSlots[POOL_MAX_THREADS];
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: POOL Take Chunk
+//
+// DESCRIPTION:
+//    This function removes one chunk from a block.  The owner takes from the
+//    front and thieves take from the back.
+//
+// INPUT:
+//   block - the block to take from
+//   from_back - TRUE when stealing
+//
+// OUTPUT:
+//   chunk - the chunk number taken
+//
+// RETURN:
+//   TRUE if a chunk was taken, FALSE if the block is empty
+//----------------------------------------------------------------------------
+static int pool_TakeChunk(PoolBlock* block, int from_back, int* chunk)
+{
+  uint64_t old_range = atomic_load_explicit(&block->range,
+                                            memory_order_relaxed);
+  uint64_t new_range;
+  uint32 front;
+  uint32 back;
+
+  do
+  {
+    front = (uint32)old_range;
+    back = (uint32)(old_range >> 32);
+    if (front >= back)
+    {
+      return FALSE;
+    }
+    if (from_back)
+    {
+      new_range = ((uint64_t)(back - 1) << 32) | front;
+    }
+    else
+    {
+      new_range = ((uint64_t)back << 32) | (front + 1);
+    }
+  } while (!atomic_compare_exchange_weak_explicit(&block->range, &old_range,
+                                                  new_range,
+                                                  memory_order_acq_rel,
+                                                  memory_order_relaxed));
+
+  *chunk = (int)(from_back ? back - 1 : front);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Run Chunk
+//
+// DESCRIPTION:
+//    This function runs the task on the items of one chunk.
+//
+// INPUT:
+//   worker - the worker running the chunk
+//   chunk - the chunk number
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void pool_RunChunk(int worker, int chunk)
+{
+  int first = chunk * poolChunk;
+  int last = first + poolChunk;
+  if (last > poolTotal)
+  {
+    last = poolTotal;
+  }
+  poolTask(poolContext, worker, first, last);
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Work
+//
+// DESCRIPTION:
+//    This function empties the worker's own block and then steals from the
+//    others until every block is empty.
+//
+// INPUT:
+//   worker - the worker number
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void pool_Work(int worker)
+{
+  int chunk;
+  int v;
+
+  while (pool_TakeChunk(&poolBlocks[worker], FALSE, &chunk))
+  {
+    pool_RunChunk(worker, chunk);
+  }
+  for (v = 1; v < poolNumThreads; v++)
+  {
+    int victim = (worker + v) % poolNumThreads;
+    while (pool_TakeChunk(&poolBlocks[victim], TRUE, &chunk))
+    {
+      pool_RunChunk(worker, chunk);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Worker Thread
+//
+// DESCRIPTION:
+//    This function is the body of every started thread.  It sleeps until a
+//    job is posted, works on it, and reports back when it runs out of work.
+//
+// INPUT:
+//   arg - the worker number
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   NULL
+//----------------------------------------------------------------------------
+static void* pool_WorkerThread(void* arg)
+{
+  int worker = (int)(intptr_t)arg;
+  uint32 seen = 0;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&poolLock);
+    while (!poolShutdown && (poolGeneration == seen))
+    {
+      pthread_cond_wait(&poolStart, &poolLock);
+    }
+    seen = poolGeneration;
+    if (poolShutdown)
+    {
+      pthread_mutex_unlock(&poolLock);
+      return NULL;
+    }
+    pthread_mutex_unlock(&poolLock);
+
+    pool_Work(worker);
+
+    if (atomic_fetch_sub(&poolPending, 1) == 1)
+    {
+      pthread_mutex_lock(&poolLock);
+      pthread_cond_signal(&poolDone);
+      pthread_mutex_unlock(&poolLock);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Solver Task
+//
+// DESCRIPTION:
+//    This function evaluates a range of guesses into the worker's own slot.
+//
+// INPUT:
+//   context - the candidate batch
+//   worker - the worker number
+//   first - the first guess
+//   last - one past the last guess
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void pool_SolverTask(void* context, int worker, int first, int last)
+{
+  solver_EvaluateGuesses((const BatchCandidates*)context, first, last,
+                         poolSolverSlots[worker].feedback,
+                         &poolSolverSlots[worker].best);
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Solver Evaluate
+//
+// DESCRIPTION:
+//    This function is the solver evaluator that spreads the guesses over
+//    the pool.  Every worker keeps its own best choice, and they are merged
+//    once the job is done, so no lock is taken while evaluating.
+//
+// INPUT:
+//   batch - the candidate secrets
+//
+// OUTPUT:
+//   best - the best choice over every guess
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void pool_SolverEvaluate(const BatchCandidates* batch,
+                                SolverChoice* best)
+{
+  int w;
+  for (w = 0; w < poolNumThreads; w++)
+  {
+    solver_InitChoice(&poolSolverSlots[w].best);
+  }
+  pool_Run(SOLVER_NUM_GUESSES, POOL_SOLVER_CHUNK, pool_SolverTask,
+           (void*)batch);
+  for (w = 0; w < poolNumThreads; w++)
+  {
+    if (solver_IsBetterChoice(&poolSolverSlots[w].best, best))
+    {
+      *best = poolSolverSlots[w].best;
+    }
+  }
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: POOL Create
+//
+// DESCRIPTION:
+//    This function picks the batch kernel and starts the worker threads, so
+//    no worker ever sees the kernel change.  The calling thread counts as
+//    one of them.
+//
+// INPUT:
+//   num_threads - the number of workers, 1 to POOL_MAX_THREADS
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of workers running
+//----------------------------------------------------------------------------
+int pool_Create(int num_threads)
+{
+  int w;
+
+  if (num_threads < 1)
+  {
+    num_threads = 1;
+  }
+  if (num_threads > POOL_MAX_THREADS)
+  {
+    num_threads = POOL_MAX_THREADS;
+  }
+
+  batch_Init();
+  poolShutdown = FALSE;
+  poolGeneration = 0;
+  poolNumThreads = 1;
+  for (w = 1; w < num_threads; w++)
+  {
+    if (0 != pthread_create(&poolThreads[w], NULL, pool_WorkerThread,
+                            (void*)(intptr_t)w))
+    {
+      break;
+    }
+    poolNumThreads++;
+  }
+  return poolNumThreads;
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Run
+//
+// DESCRIPTION:
+//    This function runs a task over items 0 to total - 1 in chunks and
+//    returns once every item has been run.
+//
+// INPUT:
+//   total - the number of items
+//   chunk - the number of items per chunk
+//   task - the task to run on each chunk
+//   context - passed to the task
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void pool_Run(int total, int chunk, PoolTask task, void* context)
+{
+  int num_chunks = (total + chunk - 1) / chunk;
+  int w;
+
+  poolTask = task;
+  poolContext = context;
+  poolTotal = total;
+  poolChunk = chunk;
+
+  for (w = 0; w < poolNumThreads; w++)
+  {
+    uint64_t front = (uint64_t)num_chunks * w / poolNumThreads;
+    uint64_t back = (uint64_t)num_chunks * (w + 1) / poolNumThreads;
+    atomic_store_explicit(&poolBlocks[w].range, (back << 32) | front,
+                          memory_order_relaxed);
+  }
+
+  if (poolNumThreads > 1)
+  {
+    atomic_store(&poolPending, poolNumThreads - 1);
+    pthread_mutex_lock(&poolLock);
+    poolGeneration++;
+    pthread_cond_broadcast(&poolStart);
+    pthread_mutex_unlock(&poolLock);
+  }
+
+  pool_Work(0);
+
+  if (poolNumThreads > 1)
+  {
+    pthread_mutex_lock(&poolLock);
+    while (atomic_load(&poolPending) > 0)
+    {
+      pthread_cond_wait(&poolDone, &poolLock);
+    }
+    pthread_mutex_unlock(&poolLock);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Num Threads
+//
+// DESCRIPTION:
+//    This function returns the number of workers in the pool.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of workers
+//----------------------------------------------------------------------------
+int pool_NumThreads(void)
+{
+  return poolNumThreads;
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Destroy
+//
+// DESCRIPTION:
+//    This function stops and joins the worker threads.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void pool_Destroy(void)
+{
+  int w;
+
+  pthread_mutex_lock(&poolLock);
+  poolShutdown = TRUE;
+  pthread_cond_broadcast(&poolStart);
+  pthread_mutex_unlock(&poolLock);
+
+  for (w = 1; w < poolNumThreads; w++)
+  {
+    pthread_join(poolThreads[w], NULL);
+  }
+  poolNumThreads = 0;
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Enable Solver
+//
+// DESCRIPTION:
+//    This function starts a pool and makes the solver evaluate its guesses
+//    on it.
+//
+// INPUT:
+//   num_threads - the number of workers
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the number of workers running
+//----------------------------------------------------------------------------
+int pool_EnableSolver(int num_threads)
+{
+  int started = pool_Create(num_threads);
+  solver_SetEvaluator(pool_SolverEvaluate);
+  return started;
+}
+
+//----------------------------------------------------------------------------
+// NAME: POOL Disable Solver
+//
+// DESCRIPTION:
+//    This function puts the solver back on the serial evaluator and stops
+//    the pool.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void pool_DisableSolver(void)
+{
+  solver_SetEvaluator(NULL);
+  pool_Destroy();
+}
@@ -0,0 +1,40 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: pool Definitions
+//
+//    FILENAME: pool.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the work stealing
+//              thread pool in pool.c and of the parallel solver evaluator
+//              built on it.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef POOL_MOD_H_
+#define POOL_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+#define POOL_MAX_THREADS      64
+
+// runs items [first, last) of a job on the given worker, 0 to threads - 1
+typedef void (*PoolTask)(void* context, int worker, int first, int last);
+
+int  pool_Create(int num_threads);
+void pool_Run(int total, int chunk, PoolTask task, void* context);
+int  pool_NumThreads(void);
+void pool_Destroy(void);
+
+int  pool_EnableSolver(int num_threads);
+void pool_DisableSolver(void);
+
+#endif /*POOL_MOD_H_*/
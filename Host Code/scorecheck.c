@@ -0,0 +1,198 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Score Engine Check
+//
+//    FILENAME: scorecheck.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the host program that checks the table
+//              driven scoring engine against compareCode for every pair of
+//              distinct-color codes: the feedback table, score_ScoreCodes,
+//              the pattern of score_PatternCodes and the hint of
+//              score_RenderHint must all agree with it.
+//              Main.c only builds for the board, so compareCode is kept
+//              here as it is written there.  Build and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/scorecheck.c"
+//                    "C Code/score.c" -o scorecheck
+//                ./scorecheck
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <string.h>                   // for strcmp
+#include "nios_std_types.h"           // for standard embedded types
+#include "score.h"                    // for the scoring engine
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define NUM_OF_COLORS_INCODE  4
+#define SCORECHECK_MAX_SHOWN  8       // mismatches printed in full
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static uint8 compared_answer[NUM_OF_COLORS_INCODE + 1] = "----";
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: Compare Code
+//
+// DESCRIPTION:
+//    This function compares the secret code with the user input, exactly
+//    as compareCode in Main.c does.
+//
+// INPUT:
+//   guess - the user's guess
+//   answer - the secret code
+//
+// OUTPUT:
+//   compared_answer - the hint string
+//
+// RETURN:
+//   the number of pegs in the correct position
+//----------------------------------------------------------------------------
+static int compareCode(uint8* guess, uint8* answer)
+{
+  int i;
+  int j;
+  int match_counter = 0;
+  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  {
+    compared_answer[i] = '-';
+  }
+  for (i = 0; i < NUM_OF_COLORS_INCODE; i++)
+  {
+    for (j = 0; j < NUM_OF_COLORS_INCODE; j++)
+    {
+      if ((guess[i] == answer[j]) && (i == j))
+      {
+        compared_answer[i] = 'P';
+        match_counter++;
+      }
+      else if ((guess[i] == answer[j]) && (i != j))
+      {
+        if (compared_answer[i] != 'P')
+        {
+          compared_answer[i] = 'C';
+        }
+      }
+      else
+      {
+        if ((compared_answer[i] != 'P') && (compared_answer[i] != 'C'))
+        {
+          compared_answer[i] = '-';
+        }
+      }
+    }
+  }
+  return match_counter;
+}
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: main
+//
+// DESCRIPTION:
+//    This function scores all 360 x 360 pairs both ways and prints the
+//    pairs that do not match.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   0 if every pair matched, else 1
+//----------------------------------------------------------------------------
+int main(void)
+{
+  uint8 guess_code[NUM_OF_COLORS_INCODE + 1];
+  uint8 secret_code[NUM_OF_COLORS_INCODE + 1];
+  uint8 hint[NUM_OF_COLORS_INCODE + 1];
+  uint32 mismatches = 0;
+  int guess;
+  int secret;
+  int i;
+
+  score_Init();
+  for (guess = 0; guess < SCORE_NUM_SECRETS; guess++)
+  {
+    uint16 guess_packed = score_IndexToCode(guess);
+    score_UnpackCode(guess_packed, guess_code);
+    if ((score_PackCode(guess_code) != guess_packed) ||
+        (score_CodeIndex(guess_packed) != guess))
+    {
+      printf("code %d %s does not pack back to itself\n", guess,
+             (char*)guess_code);
+      mismatches++;
+    }
+    for (secret = 0; secret < SCORE_NUM_SECRETS; secret++)
+    {
+      uint16 secret_packed = score_IndexToCode(secret);
+      uint8 expected;
+      int pattern = 0;
+      int exact;
+      int color = 0;
+
+      score_UnpackCode(secret_packed, secret_code);
+      exact = compareCode(guess_code, secret_code);
+      for (i = NUM_OF_COLORS_INCODE - 1; i >= 0; i--)
+      {
+        color += (compared_answer[i] == 'C');
+        pattern = pattern * 3 + (compared_answer[i] == 'P') * 2 +
+                  (compared_answer[i] == 'C');
+      }
+      expected = (uint8)SCORE_FEEDBACK(exact, color);
+      score_RenderHint(guess_packed, secret_packed, hint);
+
+      if ((SCORE_LOOKUP(guess, secret) != expected) ||
+          (score_ScoreCodes(guess_packed, secret_packed) != expected) ||
+          (score_PatternCodes(guess_packed, secret_packed) != pattern) ||
+          (0 != strcmp((char*)hint, (char*)compared_answer)))
+      {
+        if (mismatches < SCORECHECK_MAX_SHOWN)
+        {
+          printf("%s vs %s: compareCode %s %d/%d, table %d/%d, "
+                 "score %d/%d, pattern %d of %d, hint %s\n",
+                 (char*)guess_code, (char*)secret_code,
+                 (char*)compared_answer, exact, color,
+                 SCORE_EXACT(SCORE_LOOKUP(guess, secret)),
+                 SCORE_COLOR(SCORE_LOOKUP(guess, secret)),
+                 SCORE_EXACT(score_ScoreCodes(guess_packed, secret_packed)),
+                 SCORE_COLOR(score_ScoreCodes(guess_packed, secret_packed)),
+                 score_PatternCodes(guess_packed, secret_packed), pattern,
+                 (char*)hint);
+        }
+        mismatches++;
+      }
+    }
+  }
+
+  printf("%d x %d pairs checked against compareCode, %u mismatches\n",
+         SCORE_NUM_SECRETS, SCORE_NUM_SECRETS, (unsigned)mismatches);
+  return (mismatches == 0) ? 0 : 1;
+}
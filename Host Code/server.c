@@ -0,0 +1,950 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: CodeBreaker Server
+//
+//    FILENAME: server.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file serves CodeBreaker to many players at once over
+//              TCP and a Unix socket, from one thread and one epoll loop.
+//              Each connection has its own session of the game library in
+//              game.c and sees the same text as the UART terminal: the
+//              display functions queue the messages of a response on an
+//              output queue, and its descriptors go to the socket in one
+//              writev.  What the socket does not take waits in the
+//              connection's output buffer.  A line ends a command or a
+//              guess, as KEY2 does on the board; the line KEY1, or any line
+//              when the game asks for KEY1, stands for the KEY1 button.
+//
+//              The guess timer of every session is kept in one timer
+//              wheel, so a step never looks at the sessions that are not
+//              playing.  HINT and SOLVE run on the loop thread too, so the
+//              advisor gets SERVER_HINT_USEC instead of the board's quarter
+//              second.  Build and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/server.c"
+//                    "Host Code/wheel.c" "C Code/game.c" "C Code/display.c"
+//                    "C Code/score.c" "C Code/batch.c" "C Code/solver.c"
+//                    "C Code/engine.c" "C Code/rng.c" "C Code/cands.c"
+//                    "C Code/advisor.c" "C Code/book.c" "C Code/outq.c"
+//                    "C Code/msgcat.c" -lm -o server
+//                ./server [-p port] [-u path] [-n sessions] [-s seed]
+//
+//              -p 0 turns TCP off.  The server stops on SIGINT or SIGTERM
+//              and reports what it served.  srvload.c is its load test.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#define _GNU_SOURCE                   // for accept4
+#include <stdio.h>                    // for printf
+#include <stdlib.h>                   // for calloc
+#include <stddef.h>                   // for offsetof
+#include <string.h>                   // for memcpy
+#include <errno.h>                    // for errno
+#include <signal.h>                   // for signal
+#include <time.h>                     // for clock_gettime
+#include <unistd.h>                   // for close
+#include <fcntl.h>                    // for fcntl
+#include <sys/epoll.h>                // for epoll
+#include <sys/socket.h>               // for sockets
+#include <sys/resource.h>             // for setrlimit
+#include <sys/un.h>                   // for Unix sockets
+#include <sys/uio.h>                  // for writev
+#include <netinet/in.h>               // for TCP sockets
+#include <netinet/tcp.h>              // for TCP_NODELAY
+#include "nios_std_types.h"           // for standard embedded types
+#include "UART.h"                     // for the functions replaced here
+#include "display.h"                  // for the game's messages
+#include "outq.h"                     // for the output queue
+#include "score.h"                    // for the scoring engine
+#include "solver.h"                   // for SOLVE
+#include "advisor.h"                  // for HINT
+#include "rng.h"                      // for the session seeds
+#include "game.h"                     // for the game library
+#include "wheel.h"                    // for the guess timers
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define SERVER_DEFAULT_PORT   7777
+#define SERVER_DEFAULT_MAX    16384   // sessions
+#define SERVER_BACKLOG        4096
+#define SERVER_MAX_EVENTS     256
+#define SERVER_IN_MAX         64      // longer lines are cut
+#define SERVER_OUT_MAX        4096    // unsent text before a client is dropped
+#define SERVER_KEY1_LINE      "KEY1"
+#define SERVER_RUN_STEPS      4       // steps whose output one writev sends
+#define SERVER_HINT_USEC      2000    // HINT time, every session waits
+
+// epoll data of the listening sockets; connections use their index
+#define SERVER_TCP_ID         0xFFFFFFFF
+#define SERVER_UNIX_ID        0xFFFFFFFE
+
+typedef struct
+{
+  WheelTimer  timer;                  // first, so a timer is its connection
+  int         fd;                     // -1 when the slot is free
+  uint8       closing;                // close once the output is sent
+  uint8       watching_out;           // EPOLLOUT is asked for
+  uint16      in_length;
+  uint32      out_start;
+  uint32      out_length;
+  uint32      remaining;              // msec of the time limit left
+  GameSession session;
+  char        in[SERVER_IN_MAX];
+  char        out[SERVER_OUT_MAX];
+} ServerConn;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static ServerConn* serverConns;
+static uint32*     serverFree;        // stack of free connection indices
+static uint32      serverNumFree;
+static uint32      serverMax = SERVER_DEFAULT_MAX;
+static int         serverPoll = -1;
+static Wheel       serverWheel;
+static RngState    serverRng;
+static uint32      serverSeed = 1;
+static int         serverPort = SERVER_DEFAULT_PORT;
+static const char* serverPath = NULL;
+static volatile sig_atomic_t serverStop = FALSE;
+
+// the connection the display functions write to
+static ServerConn* serverCurrent = NULL;
+
+static long serverAccepted = 0;
+static long serverRefused = 0;
+static long serverLines = 0;
+static long serverTimeouts = 0;
+static long serverOverflows = 0;
+static long serverWrites = 0;
+static long serverPeak = 0;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Now
+//
+// DESCRIPTION:
+//    This function returns a monotonic time stamp in msec.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the time stamp
+//----------------------------------------------------------------------------
+static unsigned long long server_Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static void server_OnSignal(int signal_number)
+{
+  (void)signal_number;
+  serverStop = TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Watch
+//
+// DESCRIPTION:
+//    This function asks epoll for the events a connection needs: input
+//    always, and room to write while output is waiting.
+//
+// INPUT:
+//   conn - the connection
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Watch(ServerConn* conn)
+{
+  int want_out = (conn->out_length != 0);
+  struct epoll_event event;
+
+  if (want_out != conn->watching_out)
+  {
+    event.events = EPOLLIN | (want_out ? EPOLLOUT : 0);
+    event.data.u32 = (uint32)(conn - serverConns);
+    epoll_ctl(serverPoll, EPOLL_CTL_MOD, conn->fd, &event);
+    conn->watching_out = (uint8)want_out;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Close
+//
+// DESCRIPTION:
+//    This function closes a connection and frees its slot.
+//
+// INPUT:
+//   conn - the connection
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Close(ServerConn* conn)
+{
+  wheel_Cancel(&serverWheel, &conn->timer);
+  close(conn->fd);
+  conn->fd = -1;
+  serverFree[serverNumFree++] = (uint32)(conn - serverConns);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Flush
+//
+// DESCRIPTION:
+//    This function writes as much of a connection's output as the socket
+//    takes.  A connection that has left the game, or that does not read
+//    what it is sent, is closed once nothing more can be written.
+//
+// INPUT:
+//   conn - the connection
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   FALSE if the connection was closed, else TRUE
+//----------------------------------------------------------------------------
+static int server_Flush(ServerConn* conn)
+{
+  while (conn->out_length != 0)
+  {
+    ssize_t sent = send(conn->fd, conn->out + conn->out_start,
+                        conn->out_length, MSG_NOSIGNAL);
+    if (sent < 0)
+    {
+      if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+      {
+        break;
+      }
+      server_Close(conn);
+      return FALSE;
+    }
+    conn->out_start += (uint32)sent;
+    conn->out_length -= (uint32)sent;
+  }
+  if (conn->out_length == 0)
+  {
+    conn->out_start = 0;
+    if (conn->closing)
+    {
+      server_Close(conn);
+      return FALSE;
+    }
+  }
+  server_Watch(conn);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Keep
+//
+// DESCRIPTION:
+//    This function keeps text the socket did not take in the connection's
+//    output buffer, after what is already waiting there.  A client that
+//    lets the buffer fill is dropped.
+//
+// INPUT:
+//   conn - the connection
+//   data - the text
+//   length - its length
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Keep(ServerConn* conn, const uint8* data, uint32 length)
+{
+  if (conn->closing)
+  {
+    return;
+  }
+  if (conn->out_start + conn->out_length + length > SERVER_OUT_MAX)
+  {
+    memmove(conn->out, conn->out + conn->out_start, conn->out_length);
+    conn->out_start = 0;
+  }
+  if (conn->out_length + length > SERVER_OUT_MAX)
+  {
+    // the client is not reading; drop it once what it has is sent
+    serverOverflows++;
+    conn->closing = TRUE;
+    return;
+  }
+  memcpy(conn->out + conn->out_start + conn->out_length, data, length);
+  conn->out_length += length;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Send
+//
+// DESCRIPTION:
+//    This function is the sink of a connection's output queue.  When
+//    nothing is waiting in the output buffer the descriptors go to the
+//    socket in one writev, and only what it does not take is copied into
+//    the buffer; otherwise all of it goes after what is waiting.  A
+//    socket error closes the connection once its step is done.
+//
+// INPUT:
+//   descs - the descriptors
+//   count - the number of descriptors
+//   context - the connection
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Send(const OutDesc* descs, uint32 count, void* context)
+{
+  ServerConn* conn = (ServerConn*)context;
+  struct iovec iov[OUTQ_MAX_DESCS];
+  ssize_t sent = 0;
+  uint32 skip;
+  uint32 d;
+
+  if (conn->closing)
+  {
+    return;
+  }
+  if (conn->out_length == 0)
+  {
+    for (d = 0; d < count; d++)
+    {
+      iov[d].iov_base = (void*)descs[d].data;
+      iov[d].iov_len = descs[d].length;
+    }
+    sent = writev(conn->fd, iov, (int)count);
+    serverWrites++;
+    if (sent < 0)
+    {
+      if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+      {
+        conn->closing = TRUE;
+        return;
+      }
+      sent = 0;
+    }
+  }
+  for (d = 0; d < count; d++)
+  {
+    skip = ((size_t)sent < descs[d].length) ? (uint32)sent : descs[d].length;
+    sent -= skip;
+    server_Keep(conn, descs[d].data + skip, descs[d].length - skip);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Timer
+//
+// DESCRIPTION:
+//    This function carries out a timer action of the game.  Only the
+//    one second count down times out a guess; the faster rates blink the
+//    LEDs on the board and are ignored.
+//
+// INPUT:
+//   conn - the connection
+//   item - the timer action
+//   now - the current time in msec
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Timer(ServerConn* conn, const GameOutputItem* item,
+                         unsigned long long now)
+{
+  if (item->type == GAME_OUT_TIMER_LIMIT)
+  {
+    conn->remaining = (uint32)item->value * 1000;
+    if (wheel_IsRunning(&conn->timer))
+    {
+      wheel_Add(&serverWheel, &conn->timer, now + conn->remaining);
+    }
+  }
+  else if ((item->type == GAME_OUT_TIMER_START) && (item->value == SECOND))
+  {
+    wheel_Add(&serverWheel, &conn->timer, now + conn->remaining);
+  }
+  else if ((item->type == GAME_OUT_TIMER_STOP) &&
+           wheel_IsRunning(&conn->timer))
+  {
+    conn->remaining = (conn->timer.deadline > now) ?
+                      (uint32)(conn->timer.deadline - now) : 0;
+    wheel_Cancel(&serverWheel, &conn->timer);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Stats
+//
+// DESCRIPTION:
+//    This function shows the server's statistics to a player who asked for
+//    them with STATS.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   queue - the output of the step
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Stats(OutQueue* queue)
+{
+  char* line = outq_Reserve(queue, 160);
+
+  sprintf(line, "\nPlayers:   %lu now, %ld at most\n"
+                "Accepted:  %ld, %ld refused\n"
+                "Lines:     %ld, %ld timeouts\n",
+          (unsigned long)(serverMax - serverNumFree), serverPeak,
+          serverAccepted, serverRefused, serverLines, serverTimeouts);
+  outq_Commit(queue, (uint32)strlen(line));
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Run
+//
+// DESCRIPTION:
+//    This function steps a session with an event, and then on through the
+//    states that do not wait for the player, carrying out each step's
+//    output.  The messages of all the steps are queued and sent together,
+//    so the items they point into are kept until then.  The connection is
+//    marked for closing when the player leaves.
+//
+// INPUT:
+//   conn - the connection
+//   event - the event
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Run(ServerConn* conn, GameEvent* event)
+{
+  unsigned long long now = server_Now();
+  GameOutput outputs[SERVER_RUN_STEPS];
+  GameOutput* output;
+  OutQueue queue;
+  uint8 state;
+  int running;
+  int steps = 0;
+  int i;
+
+  outq_Init(&queue, server_Send, conn);
+  serverCurrent = conn;
+  do
+  {
+    if (steps == SERVER_RUN_STEPS)
+    {
+      outq_Drain(&queue);
+      steps = 0;
+    }
+    output = &outputs[steps++];
+    running = game_Step(&conn->session, event, output);
+    for (i = 0; i < output->count; i++)
+    {
+      server_Timer(conn, &output->items[i], now);
+      if (output->items[i].type == GAME_OUT_STATS)
+      {
+        server_Stats(&queue);
+      }
+      display_QueueOutput(&queue, &conn->session, &output->items[i]);
+    }
+    event->type = GAME_EVENT_NONE;
+    state = conn->session.state;
+  } while (running && !game_IsWaiting(state));
+  outq_Drain(&queue);
+  serverCurrent = NULL;
+
+  if (!running)
+  {
+    conn->closing = TRUE;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Line
+//
+// DESCRIPTION:
+//    This function turns a line from a client into an event for its
+//    session.
+//
+// INPUT:
+//   conn - the connection
+//   line - the line, NULL terminated, without its end of line
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Line(ServerConn* conn, const char* line)
+{
+  GameEvent event;
+  size_t length = strlen(line);
+
+  serverLines++;
+  memset(&event, 0, sizeof(event));
+  if ((conn->session.state == eWAIT_4_KEY1) ||
+      (0 == strcmp(line, SERVER_KEY1_LINE)))
+  {
+    event.type = GAME_EVENT_KEY1;
+  }
+  else
+  {
+    event.type = GAME_EVENT_LINE;
+    memcpy(event.line, line,
+           (length < GAME_LINE_MAX) ? length : GAME_LINE_MAX);
+  }
+  server_Run(conn, &event);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Read
+//
+// DESCRIPTION:
+//    This function reads what a client has sent and runs every complete
+//    line through its session, then sends the answers.  Letters are
+//    upper-cased as they are collected, as the UART does on the board.
+//
+// INPUT:
+//   conn - the connection
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Read(ServerConn* conn)
+{
+  char data[1024];
+  ssize_t got;
+  ssize_t n;
+
+  while (!conn->closing)
+  {
+    got = recv(conn->fd, data, sizeof(data), 0);
+    if (got == 0)
+    {
+      server_Close(conn);
+      return;
+    }
+    if (got < 0)
+    {
+      if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+      {
+        break;
+      }
+      server_Close(conn);
+      return;
+    }
+    for (n = 0; (n < got) && !conn->closing; n++)
+    {
+      char c = data[n];
+      if (c == '\n')
+      {
+        conn->in[conn->in_length] = '\0';
+        conn->in_length = 0;
+        server_Line(conn, conn->in);
+      }
+      else if ((c != '\r') && (conn->in_length < SERVER_IN_MAX - 1))
+      {
+        if ((c >= 'a') && (c <= 'z'))
+        {
+          c -= 'a' - 'A';
+        }
+        conn->in[conn->in_length++] = c;
+      }
+    }
+  }
+  server_Flush(conn);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Expired
+//
+// DESCRIPTION:
+//    This function is called by the timer wheel when a player runs out of
+//    time for a guess.
+//
+// INPUT:
+//   timer - the connection's timer
+//   context - not used
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Expired(WheelTimer* timer, void* context)
+{
+  ServerConn* conn = (ServerConn*)timer;
+  GameEvent event;
+
+  (void)context;
+  serverTimeouts++;
+  conn->remaining = 0;
+  event.type = GAME_EVENT_TIMEOUT;
+  server_Run(conn, &event);
+  server_Flush(conn);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Accept
+//
+// DESCRIPTION:
+//    This function accepts every waiting connection on a listening socket
+//    and starts a session for each.  When every slot is taken the
+//    connection is closed at once.
+//
+// INPUT:
+//   listener - the listening socket
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void server_Accept(int listener)
+{
+  for (;;)
+  {
+    struct epoll_event event;
+    GameOutput output;
+    OutQueue queue;
+    ServerConn* conn;
+    uint32 index;
+    int one = 1;
+    int fd;
+    int i;
+
+    fd = accept4(listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+      return;
+    }
+    if (serverNumFree == 0)
+    {
+      serverRefused++;
+      close(fd);
+      continue;
+    }
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    index = serverFree[--serverNumFree];
+    conn = &serverConns[index];
+    memset(conn, 0, offsetof(ServerConn, in));
+    conn->fd = fd;
+    event.events = EPOLLIN;
+    event.data.u32 = index;
+    epoll_ctl(serverPoll, EPOLL_CTL_ADD, fd, &event);
+
+    serverAccepted++;
+    if ((long)(serverMax - serverNumFree) > serverPeak)
+    {
+      serverPeak = (long)(serverMax - serverNumFree);
+    }
+
+    serverCurrent = conn;
+    outq_Init(&queue, server_Send, conn);
+    game_Init(&conn->session, rng_Next(&serverRng), &output);
+    for (i = 0; i < output.count; i++)
+    {
+      display_QueueOutput(&queue, &conn->session, &output.items[i]);
+    }
+    outq_Drain(&queue);
+    serverCurrent = NULL;
+    server_Flush(conn);
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Listen
+//
+// DESCRIPTION:
+//    This function opens a listening socket on a TCP port of every address,
+//    or on a Unix socket path, and adds it to the poll.
+//
+// INPUT:
+//   port - the TCP port, used when path is NULL
+//   path - the Unix socket path, or NULL
+//   id - the socket's epoll data
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the socket, or -1 on failure
+//----------------------------------------------------------------------------
+static int server_Listen(int port, const char* path, uint32 id)
+{
+  struct sockaddr_in tcp_address;
+  struct sockaddr_un unix_address;
+  struct epoll_event event;
+  int one = 1;
+  int fd;
+
+  if (path == NULL)
+  {
+    fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    memset(&tcp_address, 0, sizeof(tcp_address));
+    tcp_address.sin_family = AF_INET;
+    tcp_address.sin_addr.s_addr = htonl(INADDR_ANY);
+    tcp_address.sin_port = htons((uint16)port);
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if ((fd < 0) ||
+        (0 != bind(fd, (struct sockaddr*)&tcp_address, sizeof(tcp_address))))
+    {
+      perror("server: tcp");
+      return -1;
+    }
+  }
+  else
+  {
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    memset(&unix_address, 0, sizeof(unix_address));
+    unix_address.sun_family = AF_UNIX;
+    strncpy(unix_address.sun_path, path, sizeof(unix_address.sun_path) - 1);
+    unlink(path);
+    if ((fd < 0) ||
+        (0 != bind(fd, (struct sockaddr*)&unix_address,
+                   sizeof(unix_address))))
+    {
+      perror("server: unix");
+      return -1;
+    }
+  }
+  if (0 != listen(fd, SERVER_BACKLOG))
+  {
+    perror("server: listen");
+    return -1;
+  }
+  event.events = EPOLLIN;
+  event.data.u32 = id;
+  epoll_ctl(serverPoll, EPOLL_CTL_ADD, fd, &event);
+  return fd;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SERVER Parse Arguments
+//
+// DESCRIPTION:
+//    This function reads the command line options.
+//
+// INPUT:
+//   argc - the number of arguments
+//   argv - the arguments
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the options were valid
+//----------------------------------------------------------------------------
+static int server_ParseArguments(int argc, char* argv[])
+{
+  int a;
+  for (a = 1; a + 1 < argc; a += 2)
+  {
+    if (0 == strcmp(argv[a], "-p"))
+    {
+      serverPort = atoi(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-u"))
+    {
+      serverPath = argv[a + 1];
+    }
+    else if (0 == strcmp(argv[a], "-n"))
+    {
+      serverMax = (uint32)atol(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-s"))
+    {
+      serverSeed = (uint32)strtoul(argv[a + 1], NULL, 0);
+    }
+    else
+    {
+      return FALSE;
+    }
+  }
+  return (a == argc) && (serverMax > 0) &&
+         ((serverPort > 0) || (serverPath != NULL));
+}
+
+
+//*****************************************************************************
+//                         replaced UART functions
+//*****************************************************************************
+uint32 uart_Write(const uint8* data, uint32 length)
+{
+  if (serverCurrent != NULL)
+  {
+    server_Keep(serverCurrent, data, length);
+  }
+  return length;
+}
+
+
+//*****************************************************************************
+//                              main program
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  struct epoll_event events[SERVER_MAX_EVENTS];
+  struct rlimit files;
+  int tcp = -1;
+  int local = -1;
+  uint32 n;
+
+  if (!server_ParseArguments(argc, argv))
+  {
+    printf("usage: %s [-p port] [-u path] [-n sessions] [-s seed]\n",
+           argv[0]);
+    return 1;
+  }
+
+  // every session is a descriptor
+  if (0 == getrlimit(RLIMIT_NOFILE, &files))
+  {
+    files.rlim_cur = files.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &files);
+  }
+  signal(SIGINT, server_OnSignal);
+  signal(SIGTERM, server_OnSignal);
+  signal(SIGPIPE, SIG_IGN);
+
+  score_Init();
+  solver_Init();
+  advisor_Init();
+  display_SetHintBudget(SERVER_HINT_USEC);
+  rng_Seed(&serverRng, serverSeed);
+  wheel_Init(&serverWheel, server_Now());
+
+  serverConns = calloc(serverMax, sizeof(ServerConn));
+  serverFree = calloc(serverMax, sizeof(uint32));
+  if ((serverConns == NULL) || (serverFree == NULL))
+  {
+    printf("server: out of memory\n");
+    return 1;
+  }
+  for (n = 0; n < serverMax; n++)
+  {
+    serverConns[n].fd = -1;
+    serverFree[n] = serverMax - 1 - n;
+  }
+  serverNumFree = serverMax;
+
+  serverPoll = epoll_create1(EPOLL_CLOEXEC);
+  if ((serverPort > 0) &&
+      ((tcp = server_Listen(serverPort, NULL, SERVER_TCP_ID)) < 0))
+  {
+    return 1;
+  }
+  if ((serverPath != NULL) &&
+      ((local = server_Listen(0, serverPath, SERVER_UNIX_ID)) < 0))
+  {
+    return 1;
+  }
+  printf("server: %u sessions, tcp port %d, unix %s\n", serverMax,
+         serverPort, serverPath ? serverPath : "off");
+  fflush(stdout);
+
+  while (!serverStop)
+  {
+    int ready = epoll_wait(serverPoll, events, SERVER_MAX_EVENTS,
+                           wheel_NextTimeout(&serverWheel, server_Now()));
+    int e;
+
+    for (e = 0; e < ready; e++)
+    {
+      uint32 id = events[e].data.u32;
+      ServerConn* conn;
+
+      if (id == SERVER_TCP_ID)
+      {
+        server_Accept(tcp);
+        continue;
+      }
+      if (id == SERVER_UNIX_ID)
+      {
+        server_Accept(local);
+        continue;
+      }
+      conn = &serverConns[id];
+      if (conn->fd < 0)
+      {
+        continue;
+      }
+      if (events[e].events & (EPOLLERR | EPOLLHUP))
+      {
+        server_Close(conn);
+      }
+      else if (events[e].events & EPOLLIN)
+      {
+        server_Read(conn);
+      }
+      else if (events[e].events & EPOLLOUT)
+      {
+        server_Flush(conn);
+      }
+    }
+    wheel_Expire(&serverWheel, server_Now(), server_Expired, NULL);
+  }
+
+  printf("accepted       %ld (%ld refused, peak %ld at once)\n",
+         serverAccepted, serverRefused, serverPeak);
+  printf("lines          %ld\n", serverLines);
+  printf("timeouts       %ld\n", serverTimeouts);
+  printf("dropped        %ld (not reading)\n", serverOverflows);
+  printf("writes         %ld\n", serverWrites);
+  if (serverPath != NULL)
+  {
+    unlink(serverPath);
+  }
+  return 0;
+}
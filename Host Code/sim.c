@@ -0,0 +1,659 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Headless Game Simulation
+//
+//    FILENAME: sim.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file runs the unmodified CodeBreaker state machine in
+//              Main.c on a Linux host.  It replaces the uart, pio and timer
+//              modules: whenever the game finds its event queue empty, a
+//              simulated player posts the next line, key press or timeout.
+//              The player reads its hints from the text the game sends,
+//              just as a person at the terminal would.  After the batch of
+//              games it reports games per second, guesses per game and the
+//              time spent in each state.
+//              Build and run on Linux with:
+//
+//                gcc -O2 -c -I"Host Code" -I"C Code" -Dmain=game_Main
+//                    "C Code/Main.c" -o Main.o
+//                gcc -O2 -I"Host Code" -I"C Code" "Host Code/sim.c" Main.o
+//                    "C Code/display.c" "C Code/score.c" "C Code/batch.c"
+//                    "C Code/solver.c" "C Code/engine.c" "C Code/rng.c"
+//                    "C Code/cands.c" "C Code/advisor.c" "C Code/book.c"
+//                    "C Code/game.c" "C Code/event.c" "C Code/outq.c"
+//                    "C Code/msgcat.c" -lm -o sim
+//                ./sim [-g games] [-s seed] [-p solver|random] [-t percent]
+//
+//              -t is the chance, in percent, that the player lets the timer
+//              run out on a guess instead of pressing KEY2.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <stdlib.h>                   // for atol
+#include <string.h>                   // for strcmp
+#include <time.h>                     // for clock_gettime
+#include "nios_std_types.h"           // for standard embedded types
+#include "UART.h"                     // for the functions replaced here
+#include "pio.h"                      // for the functions replaced here
+#include "timer.h"                    // for the functions replaced here
+#include "score.h"                    // for packed codes and feedback
+#include "solver.h"                   // for the solver player
+#include "rng.h"                      // for the player's choices
+#include "event.h"                    // for posting the player's events
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+
+// state numbers from Main.c
+#define SIM_GAME_IDLE         0
+#define SIM_WAITING_4_USER    3
+#define SIM_WIN_GAME          4
+#define SIM_LOSE_GAME         5
+#define SIM_WAIT_4_KEY1       6
+#define SIM_NUM_STATES        9
+
+#define SIM_PLAYER_SOLVER     0
+#define SIM_PLAYER_RANDOM     1
+
+#define SIM_LINE_MAX          (EVENT_LINE_MAX + 1)
+#define SIM_OUTPUT_MAX        512
+#define SIM_HINT_MARKER       "hint from your guess:  "
+
+// the solver always answers the same history the same way, so its choices
+// are remembered; the history is hashed into 64 bits
+#define SIM_CACHE_SIZE        4096    // power of two
+#define SIM_HASH_START        0xCBF29CE484222325ULL
+#define SIM_HASH_PRIME        0x100000001B3ULL
+
+typedef struct
+{
+  unsigned long long history;
+  uint16 guess;
+  uint16 used;
+} SimCacheEntry;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static const char* simStateNames[SIM_NUM_STATES] =
+{
+  "eGAME_IDLE", "eINIT_GAME", "eREQUEST_GUESS", "eWAITING_4_USER",
+  "eWIN_GAME", "eLOSE_GAME", "eWAIT_4_KEY1", "eEND_GAME", "eSOLVE_GAME"
+};
+
+static int    simState = -1;
+static double simStateStart;
+static double simStateTime[SIM_NUM_STATES];
+static long   simStateEntries[SIM_NUM_STATES];
+
+static char   simOutput[SIM_OUTPUT_MAX + 1];
+static int    simOutputLength = 0;
+static uint8  simLine[SIM_LINE_MAX];
+
+static long   simGamesWanted = 100000;
+static long   simGamesStarted = 0;
+static long   simGuesses = 0;
+static long   simWins = 0;
+static long   simLosses = 0;
+static int    simPlayer = SIM_PLAYER_SOLVER;
+static uint32 simTimeoutPercent = 0;
+static uint32 simSeed = 1;
+static RngState simRng;
+
+static uint16 simCandidates[SCORE_NUM_SECRETS];
+static int    simCount = 0;
+static int    simNewGame = FALSE;
+static uint16 simLastGuess;
+static uint32 simTimerExpired = FALSE;
+static uint32 simKey2 = FALSE;
+
+static unsigned long long simHistory;
+static SimCacheEntry simCache[SIM_CACHE_SIZE];
+static int    simCacheUsed = 0;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SIM Now
+//
+// DESCRIPTION:
+//    This function returns a monotonic time stamp in seconds.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the time stamp
+//----------------------------------------------------------------------------
+static double sim_Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SIM Read Hint
+//
+// DESCRIPTION:
+//    This function finds the last hint in the game's output and keeps only
+//    the candidates that would have given the same P/C/- pattern.  The
+//    solver splits the candidates by pattern, so a player that only kept
+//    the counts of P and C could be asked the same guess forever.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void sim_ReadHint(void)
+{
+  char* hint = strstr(simOutput, SIM_HINT_MARKER);
+  int pattern = 0;
+  int kept = 0;
+  int i;
+  int n;
+
+  if (hint == NULL)
+  {
+    return;
+  }
+  hint += sizeof(SIM_HINT_MARKER) - 1;
+  for (i = SCORE_NUM_PEGS - 1; i >= 0; i--)
+  {
+    pattern = pattern * 3 + (hint[i] == 'P') * 2 + (hint[i] == 'C');
+  }
+  simHistory = (simHistory ^ (simLastGuess << 8 | pattern)) * SIM_HASH_PRIME;
+  for (n = 0; n < simCount; n++)
+  {
+    if (score_PatternCodes(simLastGuess, simCandidates[n]) == pattern)
+    {
+      simCandidates[kept++] = simCandidates[n];
+    }
+  }
+  simCount = kept;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SIM Solver Guess
+//
+// DESCRIPTION:
+//    This function returns the solver's guess for the current history,
+//    asking the solver only the first time that history is seen.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the packed guess
+//----------------------------------------------------------------------------
+static uint16 sim_SolverGuess(void)
+{
+  uint32 slot = (uint32)(simHistory >> 20) & (SIM_CACHE_SIZE - 1);
+
+  while (simCache[slot].used)
+  {
+    if (simCache[slot].history == simHistory)
+    {
+      return simCache[slot].guess;
+    }
+    slot = (slot + 1) & (SIM_CACHE_SIZE - 1);
+  }
+  if (simCacheUsed >= SIM_CACHE_SIZE / 2)
+  {
+    return solver_NextGuess(simCandidates, simCount);
+  }
+  simCacheUsed++;
+  simCache[slot].history = simHistory;
+  simCache[slot].guess = solver_NextGuess(simCandidates, simCount);
+  simCache[slot].used = TRUE;
+  return simCache[slot].guess;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SIM Choose Guess
+//
+// DESCRIPTION:
+//    This function lets the player pick its next guess and types it into
+//    the line the game will read.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void sim_ChooseGuess(void)
+{
+  int n;
+
+  if (simNewGame)
+  {
+    for (n = 0; n < SCORE_NUM_SECRETS; n++)
+    {
+      simCandidates[n] = score_IndexToCode(n);
+    }
+    simCount = SCORE_NUM_SECRETS;
+    simHistory = SIM_HASH_START;
+    simNewGame = FALSE;
+  }
+  else
+  {
+    sim_ReadHint();
+  }
+  if (simCount == 0)
+  {
+    // the hints did not add up; start over rather than stall
+    simNewGame = TRUE;
+    simCandidates[0] = score_IndexToCode(0);
+    simCount = 1;
+  }
+
+  if (simPlayer == SIM_PLAYER_SOLVER)
+  {
+    simLastGuess = sim_SolverGuess();
+  }
+  else
+  {
+    simLastGuess = simCandidates[rng_Bounded(&simRng, (uint32)simCount)];
+  }
+  score_UnpackCode(simLastGuess, simLine);
+  simGuesses++;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SIM Parse Arguments
+//
+// DESCRIPTION:
+//    This function reads the command line options.
+//
+// INPUT:
+//   argc - the number of arguments
+//   argv - the arguments
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the options were valid
+//----------------------------------------------------------------------------
+static int sim_ParseArguments(int argc, char* argv[])
+{
+  int a;
+  for (a = 1; a + 1 < argc; a += 2)
+  {
+    if (0 == strcmp(argv[a], "-g"))
+    {
+      simGamesWanted = atol(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-s"))
+    {
+      simSeed = (uint32)strtoul(argv[a + 1], NULL, 0);
+    }
+    else if (0 == strcmp(argv[a], "-t"))
+    {
+      simTimeoutPercent = (uint32)atoi(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-p") && 0 == strcmp(argv[a + 1], "random"))
+    {
+      simPlayer = SIM_PLAYER_RANDOM;
+    }
+    else if (0 == strcmp(argv[a], "-p") && 0 == strcmp(argv[a + 1], "solver"))
+    {
+      simPlayer = SIM_PLAYER_SOLVER;
+    }
+    else
+    {
+      return FALSE;
+    }
+  }
+  return (a == argc);
+}
+
+
+//*****************************************************************************
+//                          host state machine hook
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: HOST State Hook
+//
+// DESCRIPTION:
+//    This function is called by Main.c at the top of every pass through its
+//    state machine.  The time since the previous pass is charged to the
+//    state that was running.
+//
+// INPUT:
+//   state - the state about to run
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void host_StateHook(int state)
+{
+  double now = sim_Now();
+
+  if (simState >= 0)
+  {
+    simStateTime[simState] += now - simStateStart;
+  }
+  if (state != simState)
+  {
+    simStateEntries[state]++;
+    if (state == SIM_WIN_GAME)
+    {
+      simWins++;
+    }
+    else if (state == SIM_LOSE_GAME)
+    {
+      simLosses++;
+    }
+  }
+  simState = state;
+  simStateStart = now;
+}
+
+
+//----------------------------------------------------------------------------
+// NAME: HOST Event Idle
+//
+// DESCRIPTION:
+//    This function is called by event_Wait when the queue is empty.  It is
+//    the simulated player: at the menu it types the next command, during a
+//    guess it presses KEY2 or lets the timer run out, and after a game it
+//    presses KEY1.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void host_EventIdle(void)
+{
+  switch (simState)
+  {
+  case SIM_GAME_IDLE:
+    if (simGamesStarted < simGamesWanted)
+    {
+      memcpy(simLine, "PLAY", 5);
+      simGamesStarted++;
+      simNewGame = TRUE;
+    }
+    else
+    {
+      memcpy(simLine, "EXIT", 5);
+    }
+    event_Post(EVENT_LINE, simLine);
+    break;
+  case SIM_WAITING_4_USER:
+    if (rng_Bounded(&simRng, 100) < simTimeoutPercent)
+    {
+      simTimerExpired = TRUE;
+      event_Post(EVENT_TIMEOUT, NULL);
+    }
+    else
+    {
+      sim_ChooseGuess();
+      simKey2 = TRUE;
+      event_Post(EVENT_KEY2, NULL);
+    }
+    break;
+  case SIM_WAIT_4_KEY1:
+    // the player always goes straight back to the menu
+    event_Post(EVENT_KEY1, NULL);
+    break;
+  } /* switch */
+}
+
+void host_EventWake(void)
+{
+}
+
+
+//*****************************************************************************
+//                         simulated UART functions
+//*****************************************************************************
+void uart_SendString(char* msg)
+{
+  while (*msg != '\0')
+  {
+    uart_SendByte((uint8)*msg++);
+  }
+}
+
+void uart_SendByte(uint8 byte)
+{
+  if (simOutputLength < SIM_OUTPUT_MAX)
+  {
+    simOutput[simOutputLength++] = (char)byte;
+    simOutput[simOutputLength] = '\0';
+  }
+}
+
+uint32 uart_Write(const uint8* data, uint32 length)
+{
+  uint32 n;
+
+  for (n = 0; n < length; n++)
+  {
+    uart_SendByte(data[n]);
+  }
+  return length;
+}
+
+uint32 uart_WriteVector(const OutDesc* descs, uint32 count)
+{
+  uint32 written = 0;
+  uint32 d;
+
+  for (d = 0; d < count; d++)
+  {
+    written += uart_Write(descs[d].data, descs[d].length);
+  }
+  return written;
+}
+
+int uart_GetLine(uint8* line)
+{
+  (void)line;
+  return FALSE;
+}
+
+void uart_GetUserInput(uint8* user_inval, uint8 length)
+{
+  int i;
+  for (i = 0; i < length; i++)
+  {
+    user_inval[i] = (i < SIM_LINE_MAX) ? simLine[i] : 0;
+  }
+  simOutputLength = 0;
+  simOutput[0] = '\0';
+}
+
+uint32 uart_TxDropped(void)
+{
+  return 0;
+}
+
+#if(UART_STATS_ENABLE)
+void uart_GetStats(UartStats* stats)
+{
+  memset(stats, 0, sizeof(UartStats));
+}
+#endif
+
+uint32 uart_IsUserInputReady(void)
+{
+  return FALSE;
+}
+
+void uart_ClearUserInput(void)
+{
+  simOutputLength = 0;
+  simOutput[0] = '\0';
+}
+
+void uart_EnableInterrupt(void)
+{
+}
+
+void uart_ConfigInterrupt(void)
+{
+}
+
+
+//*****************************************************************************
+//                          simulated PIO functions
+//*****************************************************************************
+void pio_ClearKeyPressedFlag(int KEY)
+{
+  if (KEY == 2)
+  {
+    simKey2 = FALSE;
+  }
+}
+
+uint32 pio_IsKey1Pressed(void)
+{
+  return (simState == SIM_WAIT_4_KEY1);
+}
+
+uint32 pio_IsKey2Pressed(void)
+{
+  return simKey2;
+}
+
+void pio_ConfigInterrupt(void)
+{
+}
+
+void pio_EnableInterrupt(void)
+{
+}
+
+
+//*****************************************************************************
+//                         simulated timer functions
+//*****************************************************************************
+void timer_SetTimeLimit(int time)
+{
+  (void)time;
+  simTimerExpired = FALSE;
+}
+
+void timer_StartTimer(int freq)
+{
+  (void)freq;
+  simTimerExpired = FALSE;
+}
+
+void timer_StopTimer(void)
+{
+}
+
+void timer_ConfigureTimerInterrupt(void)
+{
+}
+
+void timer_EnableTimerInterrupt(void)
+{
+}
+
+void timer_DisableTimerInterrupt(void)
+{
+}
+
+uint32 timer_IsTimerExpired(void)
+{
+  return simTimerExpired;
+}
+
+
+//*****************************************************************************
+//                              main program
+//*****************************************************************************
+int game_Main(void);
+
+int main(int argc, char* argv[])
+{
+  double start;
+  double elapsed;
+  double accounted = 0.0;
+  long games;
+  int s;
+
+  if (!sim_ParseArguments(argc, argv))
+  {
+    printf("usage: %s [-g games] [-s seed] [-p solver|random] [-t percent]\n",
+           argv[0]);
+    return 1;
+  }
+  rng_Seed(&simRng, simSeed);
+
+  start = sim_Now();
+  game_Main();
+  elapsed = sim_Now() - start;
+
+  games = simWins + simLosses;
+  printf("games          %ld (%ld won, %ld lost)\n", games, simWins,
+         simLosses);
+  printf("games/s        %.0f\n", games / elapsed);
+  printf("guesses/game   %.3f\n", games ? (double)simGuesses / games : 0.0);
+  printf("\n%-16s %10s %12s %10s %7s\n", "state", "entries", "total ms",
+         "ns/entry", "share");
+  for (s = 0; s < SIM_NUM_STATES; s++)
+  {
+    accounted += simStateTime[s];
+  }
+  for (s = 0; s < SIM_NUM_STATES; s++)
+  {
+    if (simStateEntries[s] == 0)
+    {
+      continue;
+    }
+    printf("%-16s %10ld %12.3f %10.1f %6.1f%%\n", simStateNames[s],
+           simStateEntries[s], simStateTime[s] * 1e3,
+           simStateTime[s] * 1e9 / simStateEntries[s],
+           accounted > 0.0 ? simStateTime[s] * 100.0 / accounted : 0.0);
+  }
+  return 0;
+} /* main */
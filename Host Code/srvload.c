@@ -0,0 +1,568 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Server Load Test
+//
+//    FILENAME: srvload.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file is the load test of the CodeBreaker server.  It
+//              opens many sessions over the loopback, starts a game in
+//              each and plays guesses as fast as the server answers, every
+//              session waiting for its answer before it sends the next.
+//              With -t each session also thinks for about that many msec
+//              before each request, spread at random so the sessions do not
+//              move in step.  The offered load is then sessions / think
+//              time instead of as much as the server can take.  The think
+//              times use 1 msec wheel ticks, so they do not bunch up into
+//              bursts of their own.
+//              The response time of a request is from its send to the end
+//              of its answer, the guess prompt.  It reports requests per
+//              second and the p50, p99 and p99.9 response times.  The
+//              guesses repeat a color, so they never win and every answer
+//              ends with the prompt.  Build and run on Linux with:
+//
+//                gcc -O2 -I"Host Code" -I"C Code" -DWHEEL_TICK_MSEC=1
+//                    "Host Code/srvload.c" "Host Code/wheel.c" -o srvload
+//                ./server -n 16384 &
+//                ./srvload [-n sessions] [-r rounds] [-t msec]
+//                          [-p port | -u path]
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for printf
+#include <stdlib.h>                   // for calloc
+#include <string.h>                   // for memcmp
+#include <errno.h>                    // for errno
+#include <time.h>                     // for clock_gettime
+#include <unistd.h>                   // for close
+#include <sys/epoll.h>                // for epoll
+#include <sys/socket.h>               // for sockets
+#include <sys/resource.h>             // for setrlimit
+#include <sys/un.h>                   // for Unix sockets
+#include <netinet/in.h>               // for TCP sockets
+#include <netinet/tcp.h>              // for TCP_NODELAY
+#include <arpa/inet.h>                // for inet_addr
+#include "nios_std_types.h"           // for standard embedded types
+#include "wheel.h"                    // for the think times
+
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+#define SRVLOAD_DEFAULT_PORT  7777
+#define SRVLOAD_WAVE          256     // sessions connecting at once
+#define SRVLOAD_MAX_EVENTS    256
+#define SRVLOAD_TAIL          24      // bytes of the answer kept for matching
+
+#define SRVLOAD_WELCOME_END   "4. SOLVE\n\n"
+#define SRVLOAD_PROMPT        "Enter Your guess:"
+
+#define SRVLOAD_CONNECTING    0       // waiting for the welcome message
+#define SRVLOAD_PLAYING       1       // waiting for a guess prompt
+#define SRVLOAD_DONE          2
+
+typedef struct
+{
+  WheelTimer timer;                   // first, so a timer is its client
+  int    fd;
+  uint8  phase;
+  uint8  tail_length;
+  uint16 rounds;                      // answers still wanted
+  unsigned long long sent;            // time of the request, in nsec
+  char   tail[SRVLOAD_TAIL];
+} SrvloadClient;
+
+
+//*****************************************************************************
+//                            Define private data
+//*****************************************************************************
+static const char* srvloadGuesses[] =
+{
+  "GGGG\n", "BBRR\n", "OOYY\n", "WWGB\n", "RROO\n", "YYWW\n"
+};
+#define SRVLOAD_NUM_GUESSES (int)(sizeof(srvloadGuesses) / \
+                                  sizeof(srvloadGuesses[0]))
+
+static long        srvloadSessions = 10000;
+static long        srvloadRounds = 10;
+static long        srvloadThink = 0;
+static int         srvloadPort = SRVLOAD_DEFAULT_PORT;
+static const char* srvloadPath = NULL;
+
+static SrvloadClient* srvloadClients;
+static uint32* srvloadSamples;        // response times, in usec
+static long    srvloadNumSamples = 0;
+static long    srvloadErrors = 0;
+static Wheel   srvloadWheel;
+
+
+//*****************************************************************************
+//                             private functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Now
+//
+// DESCRIPTION:
+//    This function returns a monotonic time stamp in nsec.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the time stamp
+//----------------------------------------------------------------------------
+static unsigned long long srvload_Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static int srvload_CompareSamples(const void* a, const void* b)
+{
+  uint32 x = *(const uint32*)a;
+  uint32 y = *(const uint32*)b;
+  return (x > y) - (x < y);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Connect
+//
+// DESCRIPTION:
+//    This function opens a session to the server and adds it to the poll.
+//
+// INPUT:
+//   poll - the epoll descriptor
+//   index - the client
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the connection was started
+//----------------------------------------------------------------------------
+static int srvload_Connect(int poll, long index)
+{
+  SrvloadClient* client = &srvloadClients[index];
+  struct sockaddr_in tcp_address;
+  struct sockaddr_un unix_address;
+  struct epoll_event event;
+  int one = 1;
+  int result;
+
+  if (srvloadPath == NULL)
+  {
+    client->fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    memset(&tcp_address, 0, sizeof(tcp_address));
+    tcp_address.sin_family = AF_INET;
+    tcp_address.sin_addr.s_addr = inet_addr("127.0.0.1");
+    tcp_address.sin_port = htons((uint16)srvloadPort);
+    setsockopt(client->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    result = connect(client->fd, (struct sockaddr*)&tcp_address,
+                     sizeof(tcp_address));
+  }
+  else
+  {
+    client->fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    memset(&unix_address, 0, sizeof(unix_address));
+    unix_address.sun_family = AF_UNIX;
+    strncpy(unix_address.sun_path, srvloadPath,
+            sizeof(unix_address.sun_path) - 1);
+    result = connect(client->fd, (struct sockaddr*)&unix_address,
+                     sizeof(unix_address));
+  }
+  if ((client->fd < 0) || ((result != 0) && (errno != EINPROGRESS)))
+  {
+    perror("srvload: connect");
+    return FALSE;
+  }
+  client->phase = SRVLOAD_CONNECTING;
+  client->rounds = (uint16)srvloadRounds;
+  event.events = EPOLLIN;
+  event.data.u64 = (unsigned long long)index;
+  epoll_ctl(poll, EPOLL_CTL_ADD, client->fd, &event);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Send
+//
+// DESCRIPTION:
+//    This function sends a request and notes when it was sent.  A request
+//    is a few bytes, so it always fits in the socket.
+//
+// INPUT:
+//   client - the client
+//   line - the request
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void srvload_Send(SrvloadClient* client, const char* line)
+{
+  client->tail_length = 0;
+  client->sent = srvload_Now();
+  if (send(client->fd, line, strlen(line), MSG_NOSIGNAL) < 0)
+  {
+    srvloadErrors++;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Ends With
+//
+// DESCRIPTION:
+//    This function checks the end of what a client has received.
+//
+// INPUT:
+//   client - the client
+//   text - the text to look for
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the answer so far ends with the text
+//----------------------------------------------------------------------------
+static int srvload_EndsWith(const SrvloadClient* client, const char* text)
+{
+  int length = (int)strlen(text);
+  return (client->tail_length >= length) &&
+         (0 == memcmp(client->tail + client->tail_length - length, text,
+                      length));
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Read
+//
+// DESCRIPTION:
+//    This function reads what the server has sent to a client and keeps
+//    the last SRVLOAD_TAIL bytes of it.
+//
+// INPUT:
+//   client - the client
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   FALSE if the server closed the session, else TRUE
+//----------------------------------------------------------------------------
+static int srvload_Read(SrvloadClient* client)
+{
+  char data[4096];
+  ssize_t got;
+
+  while ((got = recv(client->fd, data, sizeof(data), 0)) > 0)
+  {
+    if (got >= SRVLOAD_TAIL)
+    {
+      memcpy(client->tail, data + got - SRVLOAD_TAIL, SRVLOAD_TAIL);
+      client->tail_length = SRVLOAD_TAIL;
+    }
+    else
+    {
+      int keep = client->tail_length + (int)got - SRVLOAD_TAIL;
+      if (keep > 0)
+      {
+        memmove(client->tail, client->tail + keep, client->tail_length - keep);
+        client->tail_length -= keep;
+      }
+      memcpy(client->tail + client->tail_length, data, got);
+      client->tail_length += (uint8)got;
+    }
+  }
+  return (got < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK));
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Answer
+//
+// DESCRIPTION:
+//    This function checks for a complete answer and, when there is one,
+//    records its response time and sends the session's next request.
+//
+// INPUT:
+//   client - the client
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE while the session is still playing
+//----------------------------------------------------------------------------
+static int srvload_Answer(SrvloadClient* client)
+{
+  if (!srvload_EndsWith(client, SRVLOAD_PROMPT))
+  {
+    return TRUE;
+  }
+  srvloadSamples[srvloadNumSamples++] =
+    (uint32)((srvload_Now() - client->sent) / 1000);
+  if (--client->rounds == 0)
+  {
+    return FALSE;
+  }
+  client->tail_length = 0;
+  if (srvloadThink > 0)
+  {
+    wheel_Add(&srvloadWheel, &client->timer, srvload_Now() / 1000000 +
+              srvloadThink / 2 + rand() % srvloadThink);
+    return TRUE;
+  }
+  srvload_Send(client, srvloadGuesses[client->rounds % SRVLOAD_NUM_GUESSES]);
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Think Over
+//
+// DESCRIPTION:
+//    This function is called by the timer wheel when a session has thought
+//    long enough, and sends PLAY or its next guess.
+//
+// INPUT:
+//   timer - the client's timer
+//   context - not used
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+static void srvload_ThinkOver(WheelTimer* timer, void* context)
+{
+  SrvloadClient* client = (SrvloadClient*)timer;
+
+  (void)context;
+  if (client->sent == 0)
+  {
+    srvload_Send(client, "PLAY\n");
+    return;
+  }
+  srvload_Send(client, srvloadGuesses[client->rounds % SRVLOAD_NUM_GUESSES]);
+}
+
+//----------------------------------------------------------------------------
+// NAME: SRVLOAD Parse Arguments
+//
+// DESCRIPTION:
+//    This function reads the command line options.
+//
+// INPUT:
+//   argc - the number of arguments
+//   argv - the arguments
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   TRUE if the options were valid
+//----------------------------------------------------------------------------
+static int srvload_ParseArguments(int argc, char* argv[])
+{
+  int a;
+  for (a = 1; a + 1 < argc; a += 2)
+  {
+    if (0 == strcmp(argv[a], "-n"))
+    {
+      srvloadSessions = atol(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-r"))
+    {
+      srvloadRounds = atol(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-t"))
+    {
+      srvloadThink = atol(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-p"))
+    {
+      srvloadPort = atoi(argv[a + 1]);
+    }
+    else if (0 == strcmp(argv[a], "-u"))
+    {
+      srvloadPath = argv[a + 1];
+    }
+    else
+    {
+      return FALSE;
+    }
+  }
+  return (a == argc) && (srvloadSessions > 0) && (srvloadRounds > 0) &&
+         (srvloadRounds < 65536);
+}
+
+
+//*****************************************************************************
+//                              main program
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  struct epoll_event events[SRVLOAD_MAX_EVENTS];
+  struct rlimit files;
+  unsigned long long start;
+  unsigned long long connected;
+  unsigned long long finished;
+  long opened = 0;
+  long waiting = 0;                   // sessions not yet playing
+  long active = 0;
+  long n;
+  int poll;
+
+  if (!srvload_ParseArguments(argc, argv))
+  {
+    printf("usage: %s [-n sessions] [-r rounds] [-t msec] "
+           "[-p port | -u path]\n", argv[0]);
+    return 1;
+  }
+  if (0 == getrlimit(RLIMIT_NOFILE, &files))
+  {
+    files.rlim_cur = files.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &files);
+  }
+
+  srvloadClients = calloc(srvloadSessions, sizeof(SrvloadClient));
+  srvloadSamples = calloc(srvloadSessions * srvloadRounds, sizeof(uint32));
+  if ((srvloadClients == NULL) || (srvloadSamples == NULL))
+  {
+    printf("srvload: out of memory\n");
+    return 1;
+  }
+  poll = epoll_create1(0);
+
+  // the sessions connect a wave at a time, so the listen backlog never
+  // overflows, and all are playing before any response is timed
+  start = srvload_Now();
+  while ((opened < srvloadSessions) || (waiting > 0))
+  {
+    int ready;
+    int e;
+
+    while ((opened < srvloadSessions) && (waiting < SRVLOAD_WAVE))
+    {
+      if (!srvload_Connect(poll, opened))
+      {
+        return 1;
+      }
+      opened++;
+      waiting++;
+    }
+    ready = epoll_wait(poll, events, SRVLOAD_MAX_EVENTS, 1000);
+    if (ready == 0)
+    {
+      printf("srvload: the server is not answering\n");
+      return 1;
+    }
+    for (e = 0; e < ready; e++)
+    {
+      SrvloadClient* client = &srvloadClients[events[e].data.u64];
+
+      if (srvload_Read(client) && (client->phase == SRVLOAD_CONNECTING))
+      {
+        if (srvload_EndsWith(client, SRVLOAD_WELCOME_END))
+        {
+          client->phase = SRVLOAD_PLAYING;
+          waiting--;
+        }
+      }
+      else if (client->phase == SRVLOAD_CONNECTING)
+      {
+        printf("srvload: the server closed session %ld\n",
+               (long)events[e].data.u64);
+        return 1;
+      }
+    }
+  }
+  connected = srvload_Now();
+  wheel_Init(&srvloadWheel, connected / 1000000);
+
+  for (n = 0; n < srvloadSessions; n++)
+  {
+    if (srvloadThink > 0)
+    {
+      wheel_Add(&srvloadWheel, &srvloadClients[n].timer,
+                connected / 1000000 + rand() % srvloadThink);
+    }
+    else
+    {
+      srvload_Send(&srvloadClients[n], "PLAY\n");
+    }
+  }
+  active = srvloadSessions;
+  while (active > 0)
+  {
+    int timeout = wheel_NextTimeout(&srvloadWheel, srvload_Now() / 1000000);
+    int ready = epoll_wait(poll, events, SRVLOAD_MAX_EVENTS,
+                           (timeout < 0) ? 5000 : timeout);
+    int e;
+
+    if ((ready == 0) && (timeout < 0))
+    {
+      printf("srvload: %ld sessions got no answer\n", active);
+      break;
+    }
+    for (e = 0; e < ready; e++)
+    {
+      SrvloadClient* client = &srvloadClients[events[e].data.u64];
+      if (client->phase == SRVLOAD_DONE)
+      {
+        continue;
+      }
+      if (!srvload_Read(client))
+      {
+        srvloadErrors++;
+      }
+      else if (srvload_Answer(client))
+      {
+        continue;
+      }
+      client->phase = SRVLOAD_DONE;
+      close(client->fd);
+      active--;
+    }
+    wheel_Expire(&srvloadWheel, srvload_Now() / 1000000, srvload_ThinkOver,
+                 NULL);
+  }
+  finished = srvload_Now();
+
+  qsort(srvloadSamples, srvloadNumSamples, sizeof(uint32),
+        srvload_CompareSamples);
+  printf("sessions       %ld over %s, %ld ms think time\n",
+         srvloadSessions, srvloadPath ? "unix" : "tcp", srvloadThink);
+  printf("connect        %.1f ms\n", (connected - start) / 1e6);
+  printf("requests       %ld (%ld errors)\n", srvloadNumSamples,
+         srvloadErrors);
+  printf("requests/s     %.0f\n",
+         srvloadNumSamples / ((finished - connected) / 1e9));
+  if (srvloadNumSamples > 0)
+  {
+    printf("p50            %u us\n", srvloadSamples[srvloadNumSamples / 2]);
+    printf("p99            %u us\n",
+           srvloadSamples[srvloadNumSamples * 99 / 100]);
+    printf("p99.9          %u us\n",
+           srvloadSamples[srvloadNumSamples * 999 / 1000]);
+    printf("max            %u us\n", srvloadSamples[srvloadNumSamples - 1]);
+  }
+  return (srvloadErrors != 0) ||
+         (srvloadNumSamples != srvloadSessions * srvloadRounds);
+}
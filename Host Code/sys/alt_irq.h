@@ -0,0 +1,35 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Host Interrupt Definitions
+//
+//    FILENAME: alt_irq.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file stands in for the Altera HAL interrupt header so
+//              the game modules can be built on a Linux host.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef HOST_ALT_IRQ_H_
+#define HOST_ALT_IRQ_H_
+
+typedef void (*alt_isr_func)(void* isr_context);
+
+int alt_ic_isr_register(unsigned int ic_id, unsigned int irq,
+                        alt_isr_func isr, void* isr_context, void* flags);
+
+// the interrupts are only masked for the harness; see hostregs.c
+typedef int alt_irq_context;
+
+alt_irq_context alt_irq_disable_all(void);
+void            alt_irq_enable_all(alt_irq_context context);
+
+#endif /*HOST_ALT_IRQ_H_*/
@@ -0,0 +1,68 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: Host System Definitions
+//
+//    FILENAME: system.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file stands in for the QSYS generated system.h so the
+//              game modules can be built on a Linux host.  The peripheral
+//              base addresses point at plain memory in hostregs.c, so the
+//              drivers run against simulated registers; a harness may also
+//              replace the uart, pio and timer modules altogether.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef HOST_SYSTEM_H_
+#define HOST_SYSTEM_H_
+
+#ifndef DEBUG_ENABLE
+#define DEBUG_ENABLE 0
+#endif
+
+// simulated peripheral registers, defined in hostregs.c
+extern unsigned int hostJtagUartRegs[2];
+extern unsigned int hostKeyRegs[4];
+extern unsigned int hostTimerRegs[6];
+extern unsigned int hostSevenSegRegs[1];
+extern unsigned int hostLedGRegs[1];
+extern unsigned int hostLedRRegs[1];
+
+#define JTAG_UART_0_BASE                      hostJtagUartRegs
+#define JTAG_UART_0_IRQ                       0
+#define JTAG_UART_0_IRQ_INTERRUPT_CONTROLLER_ID 0
+#define KEY1_KEY2_BASE                        hostKeyRegs
+#define KEY1_KEY2_IRQ                         1
+#define KEY1_KEY2_IRQ_INTERRUPT_CONTROLLER_ID 0
+#define TIMER_0_BASE                          hostTimerRegs
+#define TIMER_0_IRQ                           2
+#define TIMER_0_IRQ_INTERRUPT_CONTROLLER_ID   0
+#define SEVEN_SEG_BASE                        hostSevenSegRegs
+#define LED_G_BASE                            hostLedGRegs
+#define LED_R_BASE                            hostLedRRegs
+#define HOST_NUM_IRQS                         3
+
+// the host harness sees every pass through the main state machine
+void host_StateHook(int state);
+#define GAME_STATE_HOOK(state)  host_StateHook(state)
+
+// the host harness decides what an idle main loop does, e.g. sleep until
+// event_Post wakes it, or post the next simulated event itself
+void host_EventIdle(void);
+void host_EventWake(void);
+#define EVENT_IDLE()            host_EventIdle()
+#define EVENT_WAKE()            host_EventWake()
+
+// the cycle counter the UART driver's statistics are timed with
+unsigned int host_Cycles(void);
+#define UART_CYCLES()           host_Cycles()
+
+#endif /*HOST_SYSTEM_H_*/
@@ -0,0 +1,224 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: wheel Functions
+//
+//    FILENAME: wheel.c
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the functions of the timer wheel.  Each
+//              slot is a circular list with its head in the wheel.  A
+//              deadline more than WHEEL_SLOTS ticks away goes round the
+//              wheel and is passed over until its own turn comes.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+//                         Include Files
+//*****************************************************************************
+#include <stdio.h>                    // for NULL
+#include "nios_std_types.h"           // for standard embedded types
+#include "wheel.h"                    // for wheel definitions
+
+
+//*****************************************************************************
+//                             public functions
+//*****************************************************************************
+
+//----------------------------------------------------------------------------
+// NAME: WHEEL Init
+//
+// DESCRIPTION:
+//    This function empties a wheel.
+//
+// INPUT:
+//   now - the current time in msec
+//
+// OUTPUT:
+//   wheel - the wheel
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void wheel_Init(Wheel* wheel, unsigned long long now)
+{
+  int s;
+
+  for (s = 0; s < WHEEL_SLOTS; s++)
+  {
+    wheel->slots[s].next = &wheel->slots[s];
+    wheel->slots[s].prev = &wheel->slots[s];
+  }
+  wheel->tick = now / WHEEL_TICK_MSEC;
+  wheel->count = 0;
+}
+
+//----------------------------------------------------------------------------
+// NAME: WHEEL Add
+//
+// DESCRIPTION:
+//    This function starts a timer, or moves it if it is already running.
+//    A deadline that has passed expires on the next wheel_Expire.
+//
+// INPUT:
+//   deadline - the time the timer expires, in msec
+//
+// OUTPUT:
+//   wheel - the wheel
+//   timer - the timer
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void wheel_Add(Wheel* wheel, WheelTimer* timer, unsigned long long deadline)
+{
+  unsigned long long tick = deadline / WHEEL_TICK_MSEC;
+  WheelTimer* head;
+
+  wheel_Cancel(wheel, timer);
+  if (tick < wheel->tick)
+  {
+    tick = wheel->tick;
+  }
+  head = &wheel->slots[tick & (WHEEL_SLOTS - 1)];
+  timer->deadline = deadline;
+  timer->next = head;
+  timer->prev = head->prev;
+  head->prev->next = timer;
+  head->prev = timer;
+  wheel->count++;
+}
+
+//----------------------------------------------------------------------------
+// NAME: WHEEL Cancel
+//
+// DESCRIPTION:
+//    This function stops a timer.  A timer that is not running is left as
+//    it is.
+//
+// INPUT:
+//   none
+//
+// OUTPUT:
+//   wheel - the wheel
+//   timer - the timer
+//
+// RETURN:
+//   none
+//----------------------------------------------------------------------------
+void wheel_Cancel(Wheel* wheel, WheelTimer* timer)
+{
+  if (timer->next != NULL)
+  {
+    timer->prev->next = timer->next;
+    timer->next->prev = timer->prev;
+    timer->next = NULL;
+    timer->prev = NULL;
+    wheel->count--;
+  }
+}
+
+//----------------------------------------------------------------------------
+// NAME: WHEEL Expire
+//
+// DESCRIPTION:
+//    This function stops every timer whose deadline has passed and calls
+//    back for each.  The callback may start the expired timer again, but
+//    must not cancel other timers.
+//
+// INPUT:
+//   now - the current time in msec
+//   expired - the function called for each expired timer
+//   context - passed on to the callback
+//
+// OUTPUT:
+//   wheel - the wheel
+//
+// RETURN:
+//   the number of timers that expired
+//----------------------------------------------------------------------------
+int wheel_Expire(Wheel* wheel, unsigned long long now,
+                 void (*expired)(WheelTimer* timer, void* context),
+                 void* context)
+{
+  unsigned long long last = now / WHEEL_TICK_MSEC;
+  int fired = 0;
+
+  while (wheel->tick <= last)
+  {
+    WheelTimer* head = &wheel->slots[wheel->tick & (WHEEL_SLOTS - 1)];
+    WheelTimer* timer = head->next;
+
+    if (wheel->count == 0)
+    {
+      // nothing to pass over, so skip straight to the present
+      wheel->tick = last + 1;
+      break;
+    }
+    if (timer == head)
+    {
+      wheel->tick++;
+      continue;
+    }
+
+    // the slot is taken off the wheel before any callback runs, so a timer
+    // started again by its callback goes at least one tick later
+    head->prev->next = NULL;
+    head->next = head;
+    head->prev = head;
+    wheel->tick++;
+    while (timer != NULL)
+    {
+      WheelTimer* next = timer->next;
+      timer->next = NULL;
+      timer->prev = NULL;
+      wheel->count--;
+      if (timer->deadline / WHEEL_TICK_MSEC < wheel->tick)
+      {
+        expired(timer, context);
+        fired++;
+      }
+      else
+      {
+        wheel_Add(wheel, timer, timer->deadline);
+      }
+      timer = next;
+    }
+  }
+  return fired;
+} /* wheel_Expire */
+
+//----------------------------------------------------------------------------
+// NAME: WHEEL Next Timeout
+//
+// DESCRIPTION:
+//    This function returns how long a poll may sleep before the wheel
+//    needs to be expired again.
+//
+// INPUT:
+//   wheel - the wheel
+//   now - the current time in msec
+//
+// OUTPUT:
+//   none
+//
+// RETURN:
+//   the time to the next tick in msec, or -1 if no timer is running
+//----------------------------------------------------------------------------
+int wheel_NextTimeout(const Wheel* wheel, unsigned long long now)
+{
+  unsigned long long next = wheel->tick * WHEEL_TICK_MSEC;
+
+  if (wheel->count == 0)
+  {
+    return -1;
+  }
+  return (next > now) ? (int)(next - now) : 0;
+}
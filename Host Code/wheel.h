@@ -0,0 +1,65 @@
+//*****************************************************************************
+//*****************************************************************************
+//*****************************    C Source Code    ***************************
+//*****************************************************************************
+//*****************************************************************************
+//
+//        NAME: wheel Definitions
+//
+//    FILENAME: wheel.h
+//
+//    DESIGNER: Nolbert Valverde
+//
+//     CREATED: 10/17/2026
+//
+// DESCRIPTION: This file contains the definitions of the timer wheel used
+//              to time out many sessions at once.  Time is cut into ticks
+//              of WHEEL_TICK_MSEC, and a timer sits in the slot of the tick
+//              its deadline falls in, so adding, cancelling and expiring a
+//              timer cost the same however many are running.  Timers are
+//              part of the caller's own structures, so the wheel never
+//              allocates.
+//
+//*****************************************************************************
+//*****************************************************************************
+
+#ifndef WHEEL_MOD_H_
+#define WHEEL_MOD_H_
+
+#include "nios_std_types.h"           // for standard embedded types
+
+//*****************************************************************************
+//                        Define symbolic constants
+//*****************************************************************************
+// a build may ask for finer ticks; the slots then cover less time and
+// longer deadlines go round the wheel more often
+#ifndef WHEEL_TICK_MSEC
+#define WHEEL_TICK_MSEC       64
+#endif
+#define WHEEL_SLOTS           1024    // power of two, 65 seconds of ticks
+
+typedef struct WheelTimer
+{
+  struct WheelTimer* next;            // NULL when the timer is not running
+  struct WheelTimer* prev;
+  unsigned long long deadline;        // in msec
+} WheelTimer;
+
+typedef struct
+{
+  WheelTimer         slots[WHEEL_SLOTS];  // list heads
+  unsigned long long tick;            // the next tick to expire
+  long               count;           // timers running
+} Wheel;
+
+void wheel_Init(Wheel* wheel, unsigned long long now);
+void wheel_Add(Wheel* wheel, WheelTimer* timer, unsigned long long deadline);
+void wheel_Cancel(Wheel* wheel, WheelTimer* timer);
+int  wheel_Expire(Wheel* wheel, unsigned long long now,
+                  void (*expired)(WheelTimer* timer, void* context),
+                  void* context);
+int  wheel_NextTimeout(const Wheel* wheel, unsigned long long now);
+
+#define wheel_IsRunning(timer)  ((timer)->next != NULL)
+
+#endif /*WHEEL_MOD_H_*/